@@ -0,0 +1,328 @@
+/******************************************************************************
+ * @file    IoHwAb_AnalogSensor.c
+ * @brief   Triển khai bộ xử lý chung của các cảm biến analog
+ *
+ * @details File này thay thế các module cảm biến riêng lẻ (bàn đạp ga, tốc độ, tải
+ *          trọng, mô-men xoắn) bằng một bộ xử lý dựa trên bảng cấu hình. Trạng thái
+ *          của các cảm biến cũng được tổ chức dạng struct-of-arrays, nên việc chuyển
+ *          đổi tất cả cảm biến là một vòng lặp trên các mảng liên tiếp.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "IoHwAb_AnalogSensor.h"
+#include "MCAL/Adc.h"   // Gọi API từ MCAL để đọc giá trị từ ADC
+#include "MCAL/Dio.h"   // Gọi API từ MCAL để kiểm tra trạng thái DIO nếu cần
+#include "Os.h"         // Đồng hồ đơn điệu cho thời điểm lấy mẫu
+#include "Dlt.h"        // Log bất đồng bộ
+
+/******************************************************************************
+ * @brief   Kiểu giá trị vật lý bên trong bộ xử lý
+ *
+ * @details float khi dùng dấu phẩy động, Q16.16 khi bật IOHWAB_FIXED_POINT.
+ ******************************************************************************/
+#if (IOHWAB_FIXED_POINT == STD_ON)
+typedef IoHwAb_Q16_16Type IoHwAb_AnalogValueType;
+typedef Filter_StateS32Type IoHwAb_AnalogFilterStateType;
+#define IOHWAB_ANALOG_FROM_FLOAT(f)  IOHWAB_FLOAT_TO_Q16_16(f)
+#define IOHWAB_ANALOG_TO_FLOAT(v)    IOHWAB_Q16_16_TO_FLOAT(v)
+#else
+typedef float IoHwAb_AnalogValueType;
+typedef Filter_StateF32Type IoHwAb_AnalogFilterStateType;
+#define IOHWAB_ANALOG_FROM_FLOAT(f)  (f)
+#define IOHWAB_ANALOG_TO_FLOAT(v)    (v)
+#endif
+
+/******************************************************************************
+ * @brief   Bảng cấu hình đang được sử dụng
+ ******************************************************************************/
+static const IoHwAb_AnalogSensorConfigType* IoHwAb_AnalogConfig = NULL;
+
+/******************************************************************************
+ * @brief   Hệ số chuyển đổi và giới hạn của từng cảm biến
+ *
+ * @details Được tính một lần trong `IoHwAb_AnalogSensor_Init` (hoặc khi hiệu chuẩn lại
+ *          bằng `IoHwAb_AnalogSensor_SetFullScale`) từ bảng cấu hình, ở cùng định dạng
+ *          với giá trị vật lý để vòng chuyển đổi chỉ có phép nhân và cộng.
+ ******************************************************************************/
+static IoHwAb_AnalogValueType IoHwAb_AnalogScale[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogValueType IoHwAb_AnalogOffset[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogValueType IoHwAb_AnalogLowerLimit[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogValueType IoHwAb_AnalogUpperLimit[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogValueType IoHwAb_AnalogSubstitute[IOHWAB_NUM_ANALOG_SENSORS];
+
+/******************************************************************************
+ * @brief   Trạng thái của từng cảm biến
+ *
+ * @details Giá trị thô của lần chuyển đổi ADC gần nhất, giá trị vật lý đã lọc, trạng
+ *          thái bộ lọc, đoạn đường đặc tính được dùng lần trước và thời điểm lấy mẫu.
+ *          Tất cả các kênh được chuyển đổi trong cùng một lần đọc nhóm nên dùng chung
+ *          một thời điểm.
+ ******************************************************************************/
+static uint16_t IoHwAb_AnalogRaw[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogValueType IoHwAb_AnalogValue[IOHWAB_NUM_ANALOG_SENSORS];
+static IoHwAb_AnalogFilterStateType IoHwAb_AnalogFilter[IOHWAB_NUM_ANALOG_SENSORS];
+static Intp_CacheType IoHwAb_AnalogCurveCache[IOHWAB_NUM_ANALOG_SENSORS];
+static uint32_t IoHwAb_AnalogTimestampMs = 0U;  // Thời điểm của lần đọc thành công gần nhất
+static uint8_t IoHwAb_AnalogValid = 0U;         // 1 khi đã có ít nhất một lần đọc thành công
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo các cảm biến analog
+ *
+ * @details Lưu bảng cấu hình, tính sẵn hệ số chuyển đổi và giới hạn, kiểm tra đường
+ *          đặc tính, khởi tạo bộ lọc của từng cảm biến rồi khởi tạo ADC một lần cho
+ *          toàn bộ nhóm kênh.
+ *
+ * @param   ConfigPtr - Con trỏ tới bảng cấu hình `IoHwAb_AnalogSensorConfigType`
+ * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_Init(const IoHwAb_AnalogSensorConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_SENSOR_NULL_CONFIG);
+        return E_NOT_OK;
+    }
+
+    IoHwAb_AnalogConfig = ConfigPtr;
+    IoHwAb_AnalogValid = 0U;
+
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+        if (ConfigPtr->LowerLimit[i] > ConfigPtr->UpperLimit[i]) {
+            DLT_LOG_ERROR(DLT_MSG_IOHWAB_SENSOR_BAD_LIMITS, DLT_I32(i));
+            return E_NOT_OK;
+        }
+        IoHwAb_AnalogOffset[i] = IOHWAB_ANALOG_FROM_FLOAT(ConfigPtr->Offset[i]);
+        IoHwAb_AnalogLowerLimit[i] = IOHWAB_ANALOG_FROM_FLOAT(ConfigPtr->LowerLimit[i]);
+        IoHwAb_AnalogUpperLimit[i] = IOHWAB_ANALOG_FROM_FLOAT(ConfigPtr->UpperLimit[i]);
+        IoHwAb_AnalogSubstitute[i] = IOHWAB_ANALOG_FROM_FLOAT(ConfigPtr->SubstituteValue[i]);
+        IoHwAb_AnalogScale[i] = IOHWAB_ANALOG_FROM_FLOAT(ConfigPtr->FullScale[i] / (float)IOHWAB_ADC_MAX_VALUE);
+
+        // Kiểm tra đường đặc tính và tính sẵn nghịch đảo khoảng cách điểm chia
+        if (ConfigPtr->Curve[i] != NULL) {
+#if (IOHWAB_FIXED_POINT == STD_ON)
+            Std_ReturnType curveStatus = Intp_InitCurveS32(ConfigPtr->Curve[i]);
+#else
+            Std_ReturnType curveStatus = Intp_InitCurveF32(ConfigPtr->Curve[i]);
+#endif
+            if (curveStatus != E_OK) {
+                DLT_LOG_ERROR(DLT_MSG_IOHWAB_SENSOR_BAD_CURVE, DLT_I32(i));
+                return E_NOT_OK;
+            }
+        }
+        IoHwAb_AnalogCurveCache[i].Index = 0U;
+
+        // Khởi tạo bộ lọc theo cấu hình
+#if (IOHWAB_FIXED_POINT == STD_ON)
+        Std_ReturnType filterStatus = Filter_InitS32(&IoHwAb_AnalogFilter[i], &ConfigPtr->Filter[i]);
+#else
+        Std_ReturnType filterStatus = Filter_InitF32(&IoHwAb_AnalogFilter[i], &ConfigPtr->Filter[i]);
+#endif
+        if (filterStatus != E_OK) {
+            DLT_LOG_ERROR(DLT_MSG_IOHWAB_SENSOR_BAD_FILTER, DLT_I32(i));
+            return E_NOT_OK;
+        }
+    }
+
+    // Gọi API từ MCAL để khởi tạo ADC một lần cho cả nhóm kênh
+    Adc_ConfigType adcConfig = {
+        .Adc_Channel = ConfigPtr->Channel[0],
+        .Adc_SamplingRate = 0,
+        .Adc_Resolution = 10
+    };
+    Adc_Init(&adcConfig);
+
+    // Gọi API từ MCAL để khởi tạo DIO nếu cần
+    Dio_Init();
+
+    DLT_LOG_INFO(DLT_MSG_IOHWAB_SENSORS_INIT, DLT_I32(IOHWAB_NUM_ANALOG_SENSORS));
+
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm thay đổi khoảng giá trị vật lý của một cảm biến
+ *
+ * @details Tính lại hệ số chuyển đổi FullScale / 1023 ở định dạng của giá trị vật lý.
+ *          Giới hạn trên được dời theo dải đo mới (Offset + FullScale) để giá trị
+ *          hiệu chuẩn không bị cắt bởi giới hạn mặc định trong bảng cấu hình.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   FullScale - Khoảng giá trị vật lý ứng với toàn dải ADC
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ *          hoặc chưa khởi tạo
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_SetFullScale(IoHwAb_SensorIdType SensorId, float FullScale) {
+    if ((uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS || IoHwAb_AnalogConfig == NULL || FullScale <= 0.0f) {
+        return E_NOT_OK;
+    }
+    IoHwAb_AnalogScale[SensorId] = IOHWAB_ANALOG_FROM_FLOAT(FullScale / (float)IOHWAB_ADC_MAX_VALUE);
+    IoHwAb_AnalogUpperLimit[SensorId] = IOHWAB_ANALOG_FROM_FLOAT(IoHwAb_AnalogConfig->Offset[SensorId] + FullScale);
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm đọc và chuyển đổi tất cả cảm biến analog
+ *
+ * @details Lượt 1 chuyển đổi tuyến tính và giới hạn tất cả cảm biến trong một vòng lặp
+ *          không rẽ nhánh trên các mảng liên tiếp. Lượt 2 thay giá trị của các cảm biến
+ *          có đường đặc tính bằng giá trị nội suy và đưa mọi giá trị qua bộ lọc. Thời
+ *          điểm lấy mẫu chỉ được cập nhật khi đọc thành công, nên khi ADC lỗi các mẫu
+ *          cũ tiếp tục già đi và bị thay thế khi vượt tuổi tối đa.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_ReadAllSensors(void) {
+    const IoHwAb_AnalogSensorConfigType* config = IoHwAb_AnalogConfig;
+    if (config == NULL) {
+        return E_NOT_OK;
+    }
+
+    // Một lần chuyển đổi ADC cho tất cả các kênh
+    if (Adc_ReadGroup(config->Channel, IoHwAb_AnalogRaw, IOHWAB_NUM_ANALOG_SENSORS) != E_OK) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_ADC_GROUP_FAILED);
+        return E_NOT_OK;
+    }
+
+    // Lượt 1: chuyển đổi tuyến tính và giới hạn
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+#if (IOHWAB_FIXED_POINT == STD_ON)
+        IoHwAb_AnalogValueType value = IoHwAb_AnalogOffset[i]
+                                     + (IoHwAb_AnalogValueType)((uint32_t)IoHwAb_AnalogRaw[i] * (uint32_t)IoHwAb_AnalogScale[i]);
+#else
+        IoHwAb_AnalogValueType value = IoHwAb_AnalogOffset[i] + (float)IoHwAb_AnalogRaw[i] * IoHwAb_AnalogScale[i];
+#endif
+        value = (value < IoHwAb_AnalogLowerLimit[i]) ? IoHwAb_AnalogLowerLimit[i] : value;
+        value = (value > IoHwAb_AnalogUpperLimit[i]) ? IoHwAb_AnalogUpperLimit[i] : value;
+        IoHwAb_AnalogValue[i] = value;
+    }
+
+    // Lượt 2: đường đặc tính phi tuyến và bộ lọc
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+        if (config->Curve[i] != NULL) {
+#if (IOHWAB_FIXED_POINT == STD_ON)
+            IoHwAb_AnalogValue[i] = Intp_CurveS32(config->Curve[i], &IoHwAb_AnalogCurveCache[i],
+                                                  (int32_t)IoHwAb_AnalogRaw[i]);
+#else
+            IoHwAb_AnalogValue[i] = Intp_CurveF32(config->Curve[i], &IoHwAb_AnalogCurveCache[i],
+                                                  (float)IoHwAb_AnalogRaw[i]);
+#endif
+        }
+#if (IOHWAB_FIXED_POINT == STD_ON)
+        IoHwAb_AnalogValue[i] = Filter_UpdateS32(&IoHwAb_AnalogFilter[i], IoHwAb_AnalogValue[i]);
+#else
+        IoHwAb_AnalogValue[i] = Filter_UpdateF32(&IoHwAb_AnalogFilter[i], IoHwAb_AnalogValue[i]);
+#endif
+    }
+
+    IoHwAb_AnalogTimestampMs = Os_GetTimeMs();
+    IoHwAb_AnalogValid = 1U;
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ lấy mẫu mới nhất của một cảm biến
+ *
+ * @details Tuổi được tính bằng phép trừ không dấu nên vẫn đúng khi đồng hồ ms tràn.
+ *          Nếu chưa có mẫu hoặc mẫu quá tuổi tối đa, giá trị trả về là giá trị thay thế.
+ *
+ * @param   SensorId - ID của cảm biến (đã được kiểm tra)
+ * @param   Value - Con trỏ lưu trữ giá trị
+ * @param   TimestampMs - Con trỏ lưu trữ thời điểm lấy mẫu
+ * @param   AgeMs - Con trỏ lưu trữ tuổi của mẫu
+ * @return  IoHwAb_SensorStatusType - Trạng thái của mẫu
+ ******************************************************************************/
+static IoHwAb_SensorStatusType IoHwAb_AnalogSensor_Lookup(IoHwAb_SensorIdType SensorId, IoHwAb_AnalogValueType* Value,
+                                                          uint32_t* TimestampMs, uint32_t* AgeMs) {
+    *TimestampMs = IoHwAb_AnalogTimestampMs;
+    *AgeMs = 0U;
+    if (!IoHwAb_AnalogValid) {
+        *Value = IoHwAb_AnalogSubstitute[SensorId];
+        return IOHWAB_SENSOR_STATUS_NO_DATA;
+    }
+
+    *AgeMs = Os_GetTimeMs() - IoHwAb_AnalogTimestampMs;
+    uint32_t maxAgeMs = IoHwAb_AnalogConfig->MaxAgeMs[SensorId];
+    if (maxAgeMs != 0U && *AgeMs > maxAgeMs) {
+        *Value = IoHwAb_AnalogSubstitute[SensorId];
+        return IOHWAB_SENSOR_STATUS_STALE;
+    }
+
+    *Value = IoHwAb_AnalogValue[SensorId];
+    return IOHWAB_SENSOR_STATUS_VALID;
+}
+
+/******************************************************************************
+ * @brief   Hàm lấy mẫu mới nhất của một cảm biến kèm thời điểm và trạng thái
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Con trỏ lưu trữ mẫu
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc mẫu đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetSample(IoHwAb_SensorIdType SensorId, IoHwAb_SensorSampleType* Sample) {
+    if (Sample == NULL || (uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS || IoHwAb_AnalogConfig == NULL) {
+        return E_NOT_OK;
+    }
+    IoHwAb_AnalogValueType value;
+    Sample->Status = IoHwAb_AnalogSensor_Lookup(SensorId, &value, &Sample->TimestampMs, &Sample->AgeMs);
+    Sample->Value = IOHWAB_ANALOG_TO_FLOAT(value);
+    return (Sample->Status == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm lấy giá trị mới nhất của một cảm biến
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Value - Con trỏ lưu trữ giá trị vật lý đã lọc hoặc giá trị thay thế
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc giá trị đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetValue(IoHwAb_SensorIdType SensorId, float* Value) {
+    IoHwAb_SensorSampleType sample;
+    if (Value == NULL || (uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS || IoHwAb_AnalogConfig == NULL) {
+        return E_NOT_OK;
+    }
+    Std_ReturnType status = IoHwAb_AnalogSensor_GetSample(SensorId, &sample);
+    *Value = sample.Value;
+    return status;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   Hàm lấy mẫu mới nhất của một cảm biến dạng dấu phẩy tĩnh
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Con trỏ lưu trữ mẫu dạng Q16.16
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc mẫu đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetSampleFixed(IoHwAb_SensorIdType SensorId, IoHwAb_SensorSampleFixedType* Sample) {
+    if (Sample == NULL || (uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS || IoHwAb_AnalogConfig == NULL) {
+        return E_NOT_OK;
+    }
+    Sample->Status = IoHwAb_AnalogSensor_Lookup(SensorId, &Sample->Value, &Sample->TimestampMs, &Sample->AgeMs);
+    return (Sample->Status == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm lấy giá trị mới nhất của một cảm biến dạng dấu phẩy tĩnh
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Value - Con trỏ lưu trữ giá trị vật lý dạng Q16.16 đã lọc hoặc giá trị thay thế
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc giá trị đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetValueFixed(IoHwAb_SensorIdType SensorId, IoHwAb_Q16_16Type* Value) {
+    IoHwAb_SensorSampleFixedType sample;
+    if (Value == NULL || (uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS || IoHwAb_AnalogConfig == NULL) {
+        return E_NOT_OK;
+    }
+    Std_ReturnType status = IoHwAb_AnalogSensor_GetSampleFixed(SensorId, &sample);
+    *Value = sample.Value;
+    return status;
+}
+#endif
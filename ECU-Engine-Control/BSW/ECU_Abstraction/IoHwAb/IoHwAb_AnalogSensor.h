@@ -0,0 +1,193 @@
+/******************************************************************************
+ * @file    IoHwAb_AnalogSensor.h
+ * @brief   Header file cho bộ xử lý chung của các cảm biến analog
+ *
+ * @details Tất cả cảm biến analog (bàn đạp ga, tốc độ, tải trọng, mô-men xoắn) được
+ *          mô tả bởi một bảng cấu hình hằng dạng struct-of-arrays: mỗi cảm biến là
+ *          một cột trong các mảng kênh ADC, hệ số, độ lệch, giới hạn, đường đặc tính
+ *          và bộ lọc. `IoHwAb_ReadAllSensors` đọc toàn bộ các kênh trong một lần
+ *          chuyển đổi ADC và chuyển đổi tất cả trong một vòng lặp. Thêm một cảm
+ *          biến chỉ cần thêm một ID và một cột trong bảng cấu hình. Mỗi mẫu mang
+ *          theo thời điểm chuyển đổi và trạng thái; mẫu quá tuổi tối đa được thay
+ *          bằng giá trị thay thế của cảm biến.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef IOHWAB_ANALOGSENSOR_H
+#define IOHWAB_ANALOGSENSOR_H
+
+#include "Std_Types.h"
+#include "IoHwAb_Cfg.h"   // Chọn đường chuyển đổi float/dấu phẩy tĩnh
+#include "Intp.h"         // Đường đặc tính phi tuyến
+#include "Filter.h"       // Bộ lọc số của từng cảm biến
+
+/******************************************************************************
+ * @brief   Định danh các cảm biến analog
+ *
+ * @details Giá trị ID là chỉ số cột trong bảng cấu hình và trong các mảng trạng thái.
+ ******************************************************************************/
+typedef enum {
+    IOHWAB_SENSOR_THROTTLE = 0,   /**< Vị trí bàn đạp ga (0.0 - 1.0) */
+    IOHWAB_SENSOR_SPEED,          /**< Tốc độ xe (km/h) */
+    IOHWAB_SENSOR_LOAD,           /**< Tải trọng (kg) */
+    IOHWAB_SENSOR_TORQUE,         /**< Mô-men xoắn thực tế (Nm) */
+    IOHWAB_NUM_ANALOG_SENSORS
+} IoHwAb_SensorIdType;
+
+/******************************************************************************
+ * @brief   Trạng thái của một mẫu cảm biến
+ ******************************************************************************/
+typedef enum {
+    IOHWAB_SENSOR_STATUS_NO_DATA = 0,  /**< Chưa có lần đọc nào thành công, dùng giá trị thay thế */
+    IOHWAB_SENSOR_STATUS_VALID,        /**< Mẫu hợp lệ, tuổi không vượt quá MaxAgeMs */
+    IOHWAB_SENSOR_STATUS_STALE         /**< Mẫu quá tuổi tối đa, dùng giá trị thay thế */
+} IoHwAb_SensorStatusType;
+
+/******************************************************************************
+ * @brief   Một mẫu cảm biến kèm thời điểm và trạng thái
+ *
+ * @details TimestampMs là thời điểm chuyển đổi ADC theo đồng hồ đơn điệu của Os
+ *          (`Os_GetTimeMs`), AgeMs là tuổi của mẫu tại lúc lấy. Khi Status khác
+ *          IOHWAB_SENSOR_STATUS_VALID, Value là giá trị thay thế trong bảng cấu hình.
+ ******************************************************************************/
+typedef struct {
+    float Value;                       /**< Giá trị vật lý đã lọc hoặc giá trị thay thế */
+    uint32_t TimestampMs;              /**< Thời điểm chuyển đổi ADC (ms) */
+    uint32_t AgeMs;                    /**< Tuổi của mẫu (ms) */
+    IoHwAb_SensorStatusType Status;    /**< Trạng thái của mẫu */
+} IoHwAb_SensorSampleType;
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   Một mẫu cảm biến dạng dấu phẩy tĩnh kèm thời điểm và trạng thái
+ ******************************************************************************/
+typedef struct {
+    IoHwAb_Q16_16Type Value;           /**< Giá trị vật lý dạng Q16.16 đã lọc hoặc giá trị thay thế */
+    uint32_t TimestampMs;              /**< Thời điểm chuyển đổi ADC (ms) */
+    uint32_t AgeMs;                    /**< Tuổi của mẫu (ms) */
+    IoHwAb_SensorStatusType Status;    /**< Trạng thái của mẫu */
+} IoHwAb_SensorSampleFixedType;
+#endif
+
+/******************************************************************************
+ * @brief   Bảng cấu hình các cảm biến analog (struct-of-arrays)
+ *
+ * @details Giá trị vật lý = Offset + raw * FullScale / 1023, sau đó được giới hạn
+ *          trong [LowerLimit, UpperLimit]. Nếu cảm biến có đường đặc tính (Curve khác
+ *          NULL), giá trị vật lý được nội suy từ giá trị thô thay cho công thức tuyến
+ *          tính. Cuối cùng giá trị được đưa qua bộ lọc của cảm biến. Mẫu có tuổi lớn
+ *          hơn MaxAgeMs (0: không kiểm tra) được thay bằng SubstituteValue.
+ ******************************************************************************/
+typedef struct {
+    uint8_t Channel[IOHWAB_NUM_ANALOG_SENSORS];      /**< Kênh ADC */
+    float FullScale[IOHWAB_NUM_ANALOG_SENSORS];      /**< Khoảng giá trị vật lý ứng với toàn dải ADC (mặc định) */
+    float Offset[IOHWAB_NUM_ANALOG_SENSORS];         /**< Giá trị vật lý khi ADC = 0 */
+    float LowerLimit[IOHWAB_NUM_ANALOG_SENSORS];     /**< Giới hạn dưới của giá trị vật lý */
+    float UpperLimit[IOHWAB_NUM_ANALOG_SENSORS];     /**< Giới hạn trên của giá trị vật lý */
+#if (IOHWAB_FIXED_POINT == STD_ON)
+    Intp_CurveS32Type* Curve[IOHWAB_NUM_ANALOG_SENSORS];  /**< Đường đặc tính raw -> Q16.16, NULL nếu tuyến tính */
+#else
+    Intp_CurveF32Type* Curve[IOHWAB_NUM_ANALOG_SENSORS];  /**< Đường đặc tính raw -> giá trị vật lý, NULL nếu tuyến tính */
+#endif
+    Filter_ConfigType Filter[IOHWAB_NUM_ANALOG_SENSORS];  /**< Bộ lọc số */
+    uint32_t MaxAgeMs[IOHWAB_NUM_ANALOG_SENSORS];    /**< Tuổi tối đa của mẫu (ms), 0: không kiểm tra */
+    float SubstituteValue[IOHWAB_NUM_ANALOG_SENSORS]; /**< Giá trị thay thế khi không có mẫu hợp lệ */
+} IoHwAb_AnalogSensorConfigType;
+
+/******************************************************************************
+ * @brief   Bảng cấu hình mặc định của các cảm biến analog
+ *
+ * @details Được định nghĩa trong `IoHwAb_AnalogSensor_Cfg.c`.
+ ******************************************************************************/
+extern const IoHwAb_AnalogSensorConfigType IoHwAb_AnalogSensorConfig;
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo các cảm biến analog
+ *
+ * @details Khởi tạo ADC một lần cho tất cả các kênh, kiểm tra đường đặc tính, khởi tạo
+ *          bộ lọc và tính sẵn hệ số chuyển đổi của từng cảm biến.
+ *
+ * @param   ConfigPtr - Con trỏ tới bảng cấu hình `IoHwAb_AnalogSensorConfigType`
+ * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_Init(const IoHwAb_AnalogSensorConfigType* ConfigPtr);
+
+/******************************************************************************
+ * @brief   Hàm thay đổi khoảng giá trị vật lý của một cảm biến
+ *
+ * @details Dùng để áp dụng giá trị hiệu chuẩn (ví dụ từ NvM) sau khi khởi tạo. Hệ số
+ *          chuyển đổi và giới hạn trên được tính lại ngay, hàm đọc không có phép chia.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   FullScale - Khoảng giá trị vật lý ứng với toàn dải ADC
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ *          hoặc chưa khởi tạo
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_SetFullScale(IoHwAb_SensorIdType SensorId, float FullScale);
+
+/******************************************************************************
+ * @brief   Hàm đọc và chuyển đổi tất cả cảm biến analog
+ *
+ * @details Đọc tất cả các kênh trong một lần chuyển đổi nhóm ADC, sau đó chuyển đổi,
+ *          giới hạn và lọc tất cả cảm biến. Kết quả và thời điểm chuyển đổi được lưu
+ *          lại và lấy ra bằng `IoHwAb_AnalogSensor_GetSample`. Khi đọc lỗi, các mẫu
+ *          cũ được giữ nguyên và tiếp tục già đi.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_ReadAllSensors(void);
+
+/******************************************************************************
+ * @brief   Hàm lấy mẫu mới nhất của một cảm biến kèm thời điểm và trạng thái
+ *
+ * @details Tính tuổi của mẫu tại thời điểm gọi. Nếu chưa có mẫu hoặc mẫu quá tuổi
+ *          tối đa, Sample->Value là giá trị thay thế và hàm trả về E_NOT_OK.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Con trỏ lưu trữ mẫu
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc mẫu đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetSample(IoHwAb_SensorIdType SensorId, IoHwAb_SensorSampleType* Sample);
+
+/******************************************************************************
+ * @brief   Hàm lấy giá trị mới nhất của một cảm biến
+ *
+ * @details Như `IoHwAb_AnalogSensor_GetSample` nhưng chỉ trả về giá trị.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Value - Con trỏ lưu trữ giá trị vật lý đã lọc hoặc giá trị thay thế
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc giá trị đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetValue(IoHwAb_SensorIdType SensorId, float* Value);
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   Hàm lấy mẫu mới nhất của một cảm biến dạng dấu phẩy tĩnh
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Con trỏ lưu trữ mẫu dạng Q16.16
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc mẫu đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetSampleFixed(IoHwAb_SensorIdType SensorId, IoHwAb_SensorSampleFixedType* Sample);
+
+/******************************************************************************
+ * @brief   Hàm lấy giá trị mới nhất của một cảm biến dạng dấu phẩy tĩnh
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Value - Con trỏ lưu trữ giá trị vật lý dạng Q16.16 đã lọc hoặc giá trị thay thế
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu tham số không
+ *          hợp lệ hoặc giá trị đã được thay thế
+ ******************************************************************************/
+Std_ReturnType IoHwAb_AnalogSensor_GetValueFixed(IoHwAb_SensorIdType SensorId, IoHwAb_Q16_16Type* Value);
+#endif
+
+#endif /* IOHWAB_ANALOGSENSOR_H */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * @file    IoHwAb_AnalogSensor_Cfg.c
+ * @brief   Bảng cấu hình các cảm biến analog
+ *
+ * @details Mỗi cảm biến là một cột trong bảng: kênh ADC, khoảng giá trị vật lý, giới
+ *          hạn, đường đặc tính (nếu có), bộ lọc, tuổi tối đa của mẫu và giá trị thay
+ *          thế. Giá trị FullScale ở đây là giá trị mặc định, có thể được thay bằng giá
+ *          trị hiệu chuẩn lúc khởi tạo.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "IoHwAb_AnalogSensor.h"
+
+/******************************************************************************
+ * @brief   Đường đặc tính của bàn đạp ga
+ *
+ * @details Ánh xạ giá trị thô ADC sang vị trí bàn đạp ga, từ 0.0 (hoàn toàn thả) đến
+ *          1.0 (hoàn toàn nhấn). Đặc tính lũy tiến giúp điều khiển mịn hơn khi nhấn
+ *          nhẹ. Giá trị thô ngoài phạm vi điểm chia được giới hạn về hai đầu đường
+ *          cong. Điểm chia phải tăng dần nghiêm ngặt.
+ ******************************************************************************/
+#define THROTTLE_SENSOR_CURVE_POINTS 5U  // Số điểm chia của đường đặc tính
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+static const int32_t ThrottleSensor_CurveRaw[THROTTLE_SENSOR_CURVE_POINTS] = {
+    0, 256, 512, 768, 1023               // Giá trị ADC thô
+};
+static const int32_t ThrottleSensor_CurvePosition[THROTTLE_SENSOR_CURVE_POINTS] = {
+    0, 9830, 26214, 45875, 65536         // Vị trí bàn đạp ga dạng Q16.16 (0, 0.15, 0.40, 0.70, 1.0)
+};
+static uint32_t ThrottleSensor_CurveInvDelta[THROTTLE_SENSOR_CURVE_POINTS - 1U];
+static Intp_CurveS32Type ThrottleSensor_Curve = {
+    .Axis = { ThrottleSensor_CurveRaw, ThrottleSensor_CurveInvDelta, THROTTLE_SENSOR_CURVE_POINTS },
+    .Values = ThrottleSensor_CurvePosition
+};
+#else
+static const float ThrottleSensor_CurveRaw[THROTTLE_SENSOR_CURVE_POINTS] = {
+    0.0f, 256.0f, 512.0f, 768.0f, 1023.0f  // Giá trị ADC thô
+};
+static const float ThrottleSensor_CurvePosition[THROTTLE_SENSOR_CURVE_POINTS] = {
+    0.0f, 0.15f, 0.40f, 0.70f, 1.0f      // Vị trí bàn đạp ga
+};
+static float ThrottleSensor_CurveInvDelta[THROTTLE_SENSOR_CURVE_POINTS - 1U];
+static Intp_CurveF32Type ThrottleSensor_Curve = {
+    .Axis = { ThrottleSensor_CurveRaw, ThrottleSensor_CurveInvDelta, THROTTLE_SENSOR_CURVE_POINTS },
+    .Values = ThrottleSensor_CurvePosition
+};
+#endif
+
+/******************************************************************************
+ * @brief   Bảng cấu hình mặc định của các cảm biến analog
+ *
+ * @details Thứ tự cột theo `IoHwAb_SensorIdType`: bàn đạp ga, tốc độ, tải trọng,
+ *          mô-men xoắn.
+ ******************************************************************************/
+const IoHwAb_AnalogSensorConfigType IoHwAb_AnalogSensorConfig = {
+    .Channel    = { 0U, 1U, 2U, 3U },
+    .FullScale  = { 1.0f, 200.0f, 1000.0f, 500.0f },   // -, km/h, kg, Nm
+    .Offset     = { 0.0f, 0.0f, 0.0f, 0.0f },
+    .LowerLimit = { 0.0f, 0.0f, 0.0f, 0.0f },
+    .UpperLimit = { 1.0f, 200.0f, 1000.0f, 500.0f },
+    .Curve      = { &ThrottleSensor_Curve, NULL, NULL, NULL },
+    .Filter     = {
+        { FILTER_NONE, 0.0f, 0U },
+        { FILTER_MOVING_AVERAGE, 0.0f, 4U },   // Làm mịn nhiễu tốc độ
+        { FILTER_MEDIAN, 0.0f, 5U },           // Loại bỏ xung nhiễu của cảm biến tải trọng
+        { FILTER_IIR, 0.3f, 0U }               // Thông thấp cho mô-men xoắn thực tế
+    },
+    .MaxAgeMs   = { 50U, 100U, 200U, 50U },
+    // Giá trị thay thế an toàn: thả ga, giả định tốc độ cao (giảm mô-men), không cộng mô-men tải
+    .SubstituteValue = { 0.0f, 200.0f, 0.0f, 0.0f }
+};
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * @file    IoHwAb_Cfg.h
+ * @brief   Cấu hình lúc biên dịch và kiểu dữ liệu số thực dấu phẩy tĩnh của IoHwAb
+ *
+ * @details File này chọn đường chuyển đổi giá trị cảm biến của lớp IoHwAb:
+ *          dấu phẩy động (float) hoặc dấu phẩy tĩnh (fixed-point) cho các vi điều
+ *          khiển không có hoặc có FPU yếu. Khi bật dấu phẩy tĩnh, vị trí bàn đạp ga
+ *          được biểu diễn dạng Q15 và các đại lượng vật lý khác dạng Q16.16.
+ *          Cả hai đường chỉ dùng phép nhân với hệ số được tính sẵn lúc khởi tạo,
+ *          không còn phép chia trong đường đọc cảm biến.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author  
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef IOHWAB_CFG_H
+#define IOHWAB_CFG_H
+
+#include "Std_Types.h"
+
+/******************************************************************************
+ * @brief   Chọn đường chuyển đổi dấu phẩy tĩnh
+ *
+ * @details STD_ON: các hàm `*_ReadFixed` và `*_SetTorqueFixed` được biên dịch, các
+ *          hàm float được xây dựng trên đường dấu phẩy tĩnh. STD_OFF: chỉ có đường
+ *          float. Có thể ghi đè khi biên dịch, ví dụ `-DIOHWAB_FIXED_POINT=STD_ON`.
+ ******************************************************************************/
+#ifndef IOHWAB_FIXED_POINT
+#define IOHWAB_FIXED_POINT STD_OFF
+#endif
+
+/******************************************************************************
+ * @brief   Kiểu dữ liệu dấu phẩy tĩnh
+ *
+ * @details `IoHwAb_Q15Type` biểu diễn giá trị trong [0, 1) với 15 bit phần lẻ
+ *          (0x7FFF tương ứng 1.0). `IoHwAb_Q16_16Type` có 16 bit phần nguyên có
+ *          dấu và 16 bit phần lẻ, đủ cho các đại lượng dưới 32768.
+ ******************************************************************************/
+typedef int16_t IoHwAb_Q15Type;      /**< Số Q15 */
+typedef int32_t IoHwAb_Q16_16Type;   /**< Số Q16.16 */
+
+#define IOHWAB_Q15_ONE        0x7FFF /**< Giá trị Q15 lớn nhất, tương ứng 1.0 */
+#define IOHWAB_Q16_16_SHIFT   16     /**< Số bit phần lẻ của Q16.16 */
+
+/******************************************************************************
+ * @brief   Chuyển đổi giữa dấu phẩy tĩnh và float
+ *
+ * @details Chỉ dùng phép nhân với hằng số, dùng ở ranh giới với các thành phần
+ *          vẫn làm việc bằng float (ví dụ dịch vụ chẩn đoán).
+ ******************************************************************************/
+#define IOHWAB_Q15_TO_FLOAT(q)       ((float)(q) * (1.0f / 32767.0f))
+#define IOHWAB_Q16_16_TO_FLOAT(q)    ((float)(q) * (1.0f / 65536.0f))
+#define IOHWAB_FLOAT_TO_Q16_16(f)    ((IoHwAb_Q16_16Type)((f) * 65536.0f))
+
+/******************************************************************************
+ * @brief   Chuyển đổi giá trị Q16.16 trong [0, 1] sang Q15
+ *
+ * @details Dùng cho vị trí bàn đạp ga: bộ xử lý cảm biến analog tính mọi đại lượng
+ *          dạng Q16.16, RTE cung cấp vị trí bàn đạp ga dạng Q15.
+ ******************************************************************************/
+#define IOHWAB_Q16_16_TO_Q15(q)      ((IoHwAb_Q15Type)(((int64_t)(q) * IOHWAB_Q15_ONE) >> IOHWAB_Q16_16_SHIFT))
+
+/******************************************************************************
+ * @brief   Giá trị ADC tối đa (độ phân giải 10 bit)
+ ******************************************************************************/
+#define IOHWAB_ADC_MAX_VALUE  1023U
+
+/******************************************************************************
+ * @brief   Tần số PWM và chu kỳ của vòng điều khiển dòng điện động cơ
+ *
+ * @details Vòng dòng điện (FOC) chạy một lần mỗi chu kỳ PWM. Chu kỳ PWM tính bằng
+ *          tick của timer 72 MHz. Tần số phải nằm trong 10 - 20 kHz.
+ ******************************************************************************/
+#ifndef IOHWAB_MOTOR_PWM_FREQUENCY_HZ
+#define IOHWAB_MOTOR_PWM_FREQUENCY_HZ  16000U
+#endif
+#if (IOHWAB_MOTOR_PWM_FREQUENCY_HZ < 10000U) || (IOHWAB_MOTOR_PWM_FREQUENCY_HZ > 20000U)
+#error "IOHWAB_MOTOR_PWM_FREQUENCY_HZ must be within 10 - 20 kHz"
+#endif
+#define IOHWAB_MOTOR_PWM_TIMER_HZ      72000000UL
+#define IOHWAB_MOTOR_PWM_PERIOD_TICKS  ((uint16_t)(IOHWAB_MOTOR_PWM_TIMER_HZ / IOHWAB_MOTOR_PWM_FREQUENCY_HZ))
+#define IOHWAB_MOTOR_PWM_PERIOD_NS     (1000000000UL / IOHWAB_MOTOR_PWM_FREQUENCY_HZ)
+
+#endif /* IOHWAB_CFG_H */
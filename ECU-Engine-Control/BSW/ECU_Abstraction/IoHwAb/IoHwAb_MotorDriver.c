@@ -3,24 +3,51 @@
  * @brief   Triển khai các API phần cứng trừu tượng cho bộ điều khiển mô-tơ
  *
  * @details File này chứa các hàm để khởi tạo và điều chỉnh mô-men xoắn của mô-tơ.
- *          Các API trong file này cung cấp giao diện phần cứng trừu tượng cho
- *          bộ điều khiển mô-tơ, giúp phần mềm điều khiển mô-men xoắn thông qua
- *          các API của MCAL PWM. Bao gồm hàm khởi tạo cấu hình mô-tơ và hàm
- *          thiết lập mô-men xoắn dựa trên duty cycle PWM.
+ *          Mô-men xoắn yêu cầu được chuyển thành dòng trục q tham chiếu; vòng điều
+ *          khiển dòng điện định hướng từ trường (FOC) chạy ở tần số PWM đọc dòng pha
+ *          và góc rotor, điều chỉnh dòng d/q bằng hai bộ PI và điều chế vector không
+ *          gian ra ba kênh PWM của cầu nghịch lưu thông qua MCAL.
  *
  * @version 1.0
  * @date    2024-10-25
- * 
- * @author  
+ *
+ * @author
  *          HALA Academy
  *          Tong Xuan Hoang
  ******************************************************************************/
 
 #include "IoHwAb_MotorDriver.h"
-#include "Pwm.h"  // Gọi API PWM từ MCAL
-#include <stdio.h>
+#include "Pwm.h"        // Gọi API PWM từ MCAL
+#include "MCAL/Adc.h"   // Đọc dòng pha và góc rotor từ MCAL
+#include "Foc.h"        // Các khối tính toán FOC dấu phẩy tĩnh
+#include "Os.h"         // Đồng hồ đơn điệu để đo thời gian chu kỳ
+#include "Dlt.h"        // Log bất đồng bộ
 #include <stdlib.h>
 
+/******************************************************************************
+ * @brief   Hệ số và giới hạn của bộ PI dòng điện
+ *
+ * @details Hệ số dạng Q12 (4096 = 1.0), Ki là hệ số tích phân theo một chu kỳ PWM.
+ *          Giới hạn điện áp 1/sqrt(3) của điện áp DC bus là biên của vùng điều chế
+ *          tuyến tính của SVM.
+ ******************************************************************************/
+#define MOTORDRIVER_CURRENT_KP       2048   /**< 0.5 */
+#define MOTORDRIVER_CURRENT_KI       205    /**< 0.05 mỗi chu kỳ */
+#define MOTORDRIVER_VOLTAGE_LIMIT    FOC_Q15_INV_SQRT3
+
+/******************************************************************************
+ * @brief   Số chu kỳ của phép đo hiệu năng khi khởi tạo
+ ******************************************************************************/
+#define MOTORDRIVER_BENCHMARK_CYCLES 20000U
+
+/******************************************************************************
+ * @brief   Số chu kỳ của một lượt đo khi tìm thời gian lớn nhất
+ *
+ * @details Mọi lượt chạy lại cùng một chuỗi dữ liệu vào, nên nhánh chậm của FOC xuất
+ *          hiện trong mọi lượt còn việc bị OS ngắt thì không.
+ ******************************************************************************/
+#define MOTORDRIVER_BENCHMARK_PASS_CYCLES 1000U
+
 /******************************************************************************
  * @brief   Biến cấu hình hiện tại của bộ điều khiển mô-tơ
  *
@@ -32,52 +59,336 @@
  ******************************************************************************/
 static MotorDriver_ConfigType MotorDriver_CurrentConfig;
 
+/******************************************************************************
+ * @brief   Hệ số chuyển đổi từ mô-men xoắn sang dòng trục q (Q15)
+ *
+ * @details Bằng 32767 / Motor_MaxTorque, được tính một lần khi khởi tạo. Với dấu phẩy
+ *          tĩnh, hệ số có thêm 8 bit phần lẻ nên tích với mô-men xoắn Q16.16 dịch
+ *          phải 24 bit cho ra dòng Q15.
+ ******************************************************************************/
+#if (IOHWAB_FIXED_POINT == STD_ON)
+static uint32_t MotorDriver_CurrentScaleQ8 = 0U;
+#else
+static float MotorDriver_CurrentScale = 0.0f;
+#endif
+
+/******************************************************************************
+ * @brief   Dữ liệu dùng chung giữa luồng SWC và vòng dòng điện
+ *
+ * @details Dòng q tham chiếu được ghi bởi `IoHwAb_MotorDriver_SetTorque` và đọc một
+ *          lần đầu mỗi chu kỳ của vòng dòng điện. Kiểu 16 bit được đọc/ghi nguyên tử.
+ ******************************************************************************/
+static volatile int16_t MotorDriver_IqRef = 0;
+static volatile uint8_t MotorDriver_Ready = 0U;
+
+/******************************************************************************
+ * @brief   Trạng thái của vòng dòng điện và thống kê thời gian thực thi
+ *
+ * @details Chỉ được truy cập từ luồng điều khiển dòng điện (sau khi khởi tạo).
+ ******************************************************************************/
+static Foc_StateType MotorDriver_Foc;
+static MotorDriver_StatsType MotorDriver_Stats;
+
+/******************************************************************************
+ * @brief   Hàm nội bộ khởi tạo hệ số PI cho một vòng dòng điện
+ *
+ * @param   State - Trạng thái vòng dòng điện
+ * @return  void
+ ******************************************************************************/
+static void MotorDriver_InitCurrentLoop(Foc_StateType* State) {
+    State->PiD.Kp = MOTORDRIVER_CURRENT_KP;
+    State->PiD.Ki = MOTORDRIVER_CURRENT_KI;
+    State->PiD.Limit = MOTORDRIVER_VOLTAGE_LIMIT;
+    State->PiQ = State->PiD;
+    State->IdRef = 0;
+    State->IqRef = 0;
+    Foc_Reset(State);
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ tính hệ số mô-men xoắn - dòng điện từ mô-men xoắn tối đa
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+static void MotorDriver_UpdateCurrentScale(void) {
+#if (IOHWAB_FIXED_POINT == STD_ON)
+    MotorDriver_CurrentScaleQ8 = ((uint32_t)FOC_Q15_ONE << 8) / MotorDriver_CurrentConfig.Motor_MaxTorque;
+#else
+    MotorDriver_CurrentScale = (float)FOC_Q15_ONE / (float)MotorDriver_CurrentConfig.Motor_MaxTorque;
+#endif
+}
+
+/******************************************************************************
+ * @brief   Hàm đo thời gian thực thi của một chu kỳ FOC
+ *
+ * @details Chạy `Cycles` chu kỳ của vòng dòng điện trên một trạng thái riêng với dòng
+ *          và góc tổng hợp (không truy cập MCAL), đo từng chu kỳ bằng đồng hồ đơn điệu.
+ *          Các chu kỳ được chia thành các lượt MOTORDRIVER_BENCHMARK_PASS_CYCLES chu kỳ,
+ *          mỗi lượt bắt đầu lại từ cùng trạng thái và dữ liệu vào. Thời gian lớn nhất
+ *          là giá trị nhỏ nhất trong các lượt của thời gian lớn nhất mỗi lượt: chu kỳ
+ *          chậm do dữ liệu lặp lại ở mọi lượt, còn chu kỳ bị OS ngắt (trên máy chủ)
+ *          chỉ làm hỏng một vài lượt.
+ *
+ * @param   Cycles - Số chu kỳ cần chạy
+ * @param   Result - Con trỏ lưu trữ kết quả đo
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_Benchmark(uint32_t Cycles, MotorDriver_BenchmarkType* Result) {
+    if (Result == NULL || Cycles == 0U) {
+        return E_NOT_OK;
+    }
+
+    Foc_StateType state;
+    uint16_t duty[3];
+    volatile uint32_t sink = 0U;  // Giữ kết quả để trình biên dịch không bỏ vòng lặp
+    uint16_t angle = 0U;
+    int16_t ia = 0, ib = 0;
+    uint64_t totalNs = 0U;
+    uint64_t maxNs = UINT64_MAX;
+    uint64_t passMaxNs = 0U;
+
+    for (uint32_t i = 0; i < Cycles; i++) {
+        if (i % MOTORDRIVER_BENCHMARK_PASS_CYCLES == 0U) {
+            // Lượt mới: bắt đầu lại từ cùng trạng thái và dữ liệu vào
+            MotorDriver_InitCurrentLoop(&state);
+            state.IqRef = 16384;
+            angle = 0U;
+            ia = 0;
+            ib = 0;
+            passMaxNs = 0U;
+        }
+
+        uint64_t start = Os_GetTimeNs();
+        Foc_Step(&state, ia, ib, angle, IOHWAB_MOTOR_PWM_PERIOD_TICKS, duty);
+        angle = (uint16_t)(angle + 819U);
+        ia = (int16_t)(state.Vd >> 1);
+        ib = (int16_t)(state.Vq >> 1);
+        sink += duty[0];
+        uint64_t cycleNs = Os_GetTimeNs() - start;
+
+        totalNs += cycleNs;
+        passMaxNs = (cycleNs > passMaxNs) ? cycleNs : passMaxNs;
+        if ((i + 1U) % MOTORDRIVER_BENCHMARK_PASS_CYCLES == 0U || i + 1U == Cycles) {
+            maxNs = (passMaxNs < maxNs) ? passMaxNs : maxNs;
+        }
+    }
+    (void)sink;
+
+    Result->AverageNs = (uint32_t)(totalNs / Cycles);
+    Result->MaxNs = (maxNs > UINT32_MAX) ? UINT32_MAX : (uint32_t)maxNs;
+    Result->PeriodNs = IOHWAB_MOTOR_PWM_PERIOD_NS;
+    Result->LoadPercent = (uint32_t)(((uint64_t)Result->AverageNs * 100U) / Result->PeriodNs);
+    return E_OK;
+}
+
 /******************************************************************************
  * @brief   Hàm khởi tạo bộ điều khiển mô-tơ với cấu hình
  *
- * @details Hàm này nhận vào một cấu trúc cấu hình cho bộ điều khiển mô-tơ và
- *          thiết lập mô-tơ dựa trên các thông số cấu hình được cung cấp. Cấu hình
- *          sẽ được lưu vào biến toàn cục `MotorDriver_CurrentConfig`, bao gồm kênh PWM
- *          và mô-men xoắn tối đa. Sau đó, hàm sẽ khởi tạo kênh PWM thông qua API MCAL
- *          với các thông số ban đầu như chu kỳ và tỷ lệ nhiệm vụ (duty cycle).
+ * @details Hàm này lưu cấu hình, tính sẵn hệ số mô-men xoắn - dòng điện, khởi tạo
+ *          ba kênh PWM của cầu nghịch lưu ở tần số PWM với duty 50% (điện áp pha
+ *          bằng 0) và vòng dòng điện. Sau đó đo thời gian của một chu kỳ FOC và báo
+ *          lỗi nếu thời gian trung bình chiếm quá nửa chu kỳ PWM hoặc chu kỳ chậm nhất
+ *          không kết thúc trong một chu kỳ PWM.
  *
  * @param   ConfigPtr - Con trỏ tới cấu trúc `MotorDriver_ConfigType` chứa cấu hình của mô-tơ
  * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
 Std_ReturnType IoHwAb_MotorDriver_Init(const MotorDriver_ConfigType* ConfigPtr) {
     if (ConfigPtr == NULL) {
-        printf("Error: Null configuration pointer passed to IoHwAb_MotorDriver_Init.\n");
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_MOTOR_NULL_CONFIG);
+        return E_NOT_OK;
+    }
+
+    if (ConfigPtr->Motor_MaxTorque == 0U) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_MOTOR_BAD_MAX_TORQUE);
+        return E_NOT_OK;
+    }
+
+    if ((uint32_t)ConfigPtr->Motor_Channel + 3U > PWM_MAX_CHANNELS) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_MOTOR_BAD_CHANNELS, DLT_U32(ConfigPtr->Motor_Channel), DLT_U32(ConfigPtr->Motor_Channel + 2));
         return E_NOT_OK;
     }
 
+    MotorDriver_Ready = 0U;
+
     // Lưu cấu hình MotorDriver
     MotorDriver_CurrentConfig.Motor_Channel = ConfigPtr->Motor_Channel;
     MotorDriver_CurrentConfig.Motor_MaxTorque = ConfigPtr->Motor_MaxTorque;
 
-    // Gọi API từ MCAL để khởi tạo PWM
-    Pwm_ConfigType pwmConfig = {
-        .Pwm_Channel = MotorDriver_CurrentConfig.Motor_Channel,
-        .Pwm_Period = 1000, // 1 giây (1000ms)
-        .Pwm_DutyCycle = 0  // Khởi tạo với duty cycle = 0%
-    };
-    Pwm_Init(&pwmConfig);
+    // Tính sẵn hệ số mô-men xoắn - dòng điện để hàm đặt mô-men xoắn không còn phép chia
+    MotorDriver_UpdateCurrentScale();
+
+    // Gọi API từ MCAL để khởi tạo ba kênh PWM của pha A, B, C
+    for (uint8_t phase = 0; phase < 3U; phase++) {
+        Pwm_ConfigType pwmConfig = {
+            .Pwm_Channel = (uint8_t)(MotorDriver_CurrentConfig.Motor_Channel + phase),
+            .Pwm_Period = IOHWAB_MOTOR_PWM_PERIOD_TICKS,           // Chu kỳ PWM (tick timer)
+            .Pwm_DutyCycle = IOHWAB_MOTOR_PWM_PERIOD_TICKS / 2U    // 50%: điện áp pha bằng 0
+        };
+        Pwm_Init(&pwmConfig);
+    }
+
+    // Khởi tạo vòng dòng điện
+    Foc_Init();
+    MotorDriver_InitCurrentLoop(&MotorDriver_Foc);
+    MotorDriver_IqRef = 0;
+    MotorDriver_Stats.Cycles = 0U;
+    MotorDriver_Stats.MaxExecNs = 0U;
+    MotorDriver_Stats.TotalExecNs = 0U;
+
+    // Đo thời gian một chu kỳ FOC so với chu kỳ PWM
+    MotorDriver_BenchmarkType benchmark;
+    (void)IoHwAb_MotorDriver_Benchmark(MOTORDRIVER_BENCHMARK_CYCLES, &benchmark);
+
+    // Log thông tin cấu hình MotorDriver
+    DLT_LOG_INFO(DLT_MSG_IOHWAB_MOTOR_INIT, DLT_U32(MotorDriver_CurrentConfig.Motor_Channel),
+                 DLT_U32(MotorDriver_CurrentConfig.Motor_Channel + 1), DLT_U32(MotorDriver_CurrentConfig.Motor_Channel + 2),
+                 DLT_U32(MotorDriver_CurrentConfig.Motor_MaxTorque), DLT_U32(IOHWAB_MOTOR_PWM_FREQUENCY_HZ));
+    DLT_LOG_INFO(DLT_MSG_IOHWAB_MOTOR_FOC_CYCLE, DLT_U32(benchmark.AverageNs), DLT_U32(benchmark.LoadPercent),
+                 DLT_U32(benchmark.PeriodNs), DLT_U32(benchmark.MaxNs));
+
+    if ((uint64_t)benchmark.AverageNs * 2U > benchmark.PeriodNs || benchmark.MaxNs > benchmark.PeriodNs) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_MOTOR_FOC_TOO_SLOW);
+        return E_NOT_OK;
+    }
+
+    MotorDriver_Ready = 1U;
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm thay đổi mô-men xoắn tối đa của mô-tơ
+ *
+ * @details Dùng để áp dụng giá trị hiệu chuẩn sau khi khởi tạo bằng bảng cấu hình
+ *          mặc định. Dòng tham chiếu hiện tại được giữ nguyên đến lần đặt mô-men
+ *          xoắn tiếp theo. Phải được gọi từ cùng task với `IoHwAb_MotorDriver_SetTorque`.
+ *
+ * @param   MaxTorque - Mô-men xoắn tối đa mới (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu giá trị không hợp lệ
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_SetMaxTorque(uint16_t MaxTorque) {
+    if (MaxTorque == 0U) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_MOTOR_BAD_MAX_TORQUE);
+        return E_NOT_OK;
+    }
+
+    MotorDriver_CurrentConfig.Motor_MaxTorque = MaxTorque;
+    MotorDriver_UpdateCurrentScale();
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm thực hiện một chu kỳ của vòng dòng điện
+ *
+ * @details Được gọi một lần mỗi chu kỳ PWM (tương ứng ngắt PWM trên phần cứng). Đọc
+ *          dòng pha và góc rotor, chạy Clarke/Park, PI d/q, Park ngược và SVM rồi ghi
+ *          duty cho ba kênh PWM. Không in ra màn hình, không cấp phát bộ nhớ.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void IoHwAb_MotorDriver_ControlStep(void) {
+    if (!MotorDriver_Ready) {
+        return;
+    }
+
+    uint64_t start = Os_GetTimeNs();
+
+    int16_t ia, ib;
+    uint16_t angle;
+    uint16_t duty[3];
+    if (Adc_ReadMotorFeedback(MotorDriver_CurrentConfig.Motor_Channel, &ia, &ib, &angle) != E_OK) {
+        // Không có phản hồi: đưa điện áp pha về 0 và xóa tích phân
+        duty[0] = duty[1] = duty[2] = IOHWAB_MOTOR_PWM_PERIOD_TICKS / 2U;
+        Foc_Reset(&MotorDriver_Foc);
+    } else {
+        MotorDriver_Foc.IqRef = MotorDriver_IqRef;
+        Foc_Step(&MotorDriver_Foc, ia, ib, angle, IOHWAB_MOTOR_PWM_PERIOD_TICKS, duty);
+    }
+    Pwm_SetPhaseDutyCycles(MotorDriver_CurrentConfig.Motor_Channel, duty);
+
+    uint32_t execNs = (uint32_t)(Os_GetTimeNs() - start);
+    MotorDriver_Stats.Cycles++;
+    MotorDriver_Stats.TotalExecNs += execNs;
+    MotorDriver_Stats.MaxExecNs = (execNs > MotorDriver_Stats.MaxExecNs) ? execNs : MotorDriver_Stats.MaxExecNs;
+}
+
+/******************************************************************************
+ * @brief   Hàm lấy thống kê thời gian thực thi của vòng dòng điện
+ *
+ * @param   Stats - Con trỏ lưu trữ thống kê
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_GetStats(MotorDriver_StatsType* Stats) {
+    if (Stats == NULL) {
+        return E_NOT_OK;
+    }
+    *Stats = MotorDriver_Stats;
+    return E_OK;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   Hàm điều chỉnh mô-men xoắn của mô-tơ với giá trị dấu phẩy tĩnh
+ *
+ * @details Kiểm tra mô-men xoắn Q16.16 nằm trong [0, Motor_MaxTorque], sau đó tính
+ *          dòng trục q tham chiếu bằng phép nhân 64 bit với hệ số đã tính sẵn. Vòng
+ *          dòng điện sử dụng giá trị mới từ chu kỳ PWM tiếp theo.
+ *
+ * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu dạng Q16.16 (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu thiết lập thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_SetTorqueFixed(IoHwAb_Q16_16Type TorqueValue) {
+    // Kiểm tra giá trị mô-men xoắn hợp lệ
+    if (TorqueValue < 0 ||
+        TorqueValue > ((IoHwAb_Q16_16Type)MotorDriver_CurrentConfig.Motor_MaxTorque << IOHWAB_Q16_16_SHIFT)) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_TORQUE_OUT_OF_RANGE, DLT_F32(IOHWAB_Q16_16_TO_FLOAT(TorqueValue)),
+                      DLT_U32(MotorDriver_CurrentConfig.Motor_MaxTorque));
+        return E_NOT_OK;
+    }
 
-    // In ra thông tin cấu hình MotorDriver
-    printf("Motor Driver Initialized with Configuration:\n");
-    printf(" - Motor Channel: %d\n", MotorDriver_CurrentConfig.Motor_Channel);
-    printf(" - Max Torque: %d Nm\n", MotorDriver_CurrentConfig.Motor_MaxTorque);
+    // Tính dòng trục q tham chiếu: Q16.16 * Q8 >> 24 cho ra Q15
+    int32_t iqRef = (int32_t)(((uint64_t)(uint32_t)TorqueValue * MotorDriver_CurrentScaleQ8) >> 24);
+    MotorDriver_IqRef = (int16_t)((iqRef > FOC_Q15_ONE) ? FOC_Q15_ONE : iqRef);
+
+    // Log giá trị mô-men xoắn đã đặt
+    DLT_LOG_DEBUG(DLT_MSG_IOHWAB_SET_TORQUE, DLT_F32(IOHWAB_Q16_16_TO_FLOAT(TorqueValue)),
+                  DLT_U32(MotorDriver_CurrentConfig.Motor_Channel), DLT_U32(MotorDriver_CurrentConfig.Motor_Channel + 2),
+                  DLT_I32(MotorDriver_IqRef));
 
     return E_OK;
 }
 
+/******************************************************************************
+ * @brief   Hàm điều chỉnh mô-men xoắn của mô-tơ
+ *
+ * @details Kiểm tra phạm vi của giá trị float (để phép chuyển sang Q16.16 không tràn)
+ *          rồi đặt mô-men xoắn qua đường dấu phẩy tĩnh.
+ *
+ * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu thiết lập thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_SetTorque(float TorqueValue) {
+    // Kiểm tra giá trị mô-men xoắn hợp lệ
+    if (TorqueValue < 0.0f || TorqueValue > MotorDriver_CurrentConfig.Motor_MaxTorque) {
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_TORQUE_OUT_OF_RANGE, DLT_F32(TorqueValue), DLT_U32(MotorDriver_CurrentConfig.Motor_MaxTorque));
+        return E_NOT_OK;
+    }
+
+    return IoHwAb_MotorDriver_SetTorqueFixed(IOHWAB_FLOAT_TO_Q16_16(TorqueValue));
+}
+
+#else
+
 /******************************************************************************
  * @brief   Hàm điều chỉnh mô-men xoắn của mô-tơ
  *
  * @details Hàm này điều chỉnh mô-men xoắn của mô-tơ dựa trên giá trị yêu cầu.
  *          Trước tiên, hàm sẽ kiểm tra xem giá trị mô-men xoắn có nằm trong phạm
  *          vi cho phép (từ 0 đến mô-men xoắn tối đa của cấu hình hiện tại). Nếu hợp lệ,
- *          hàm sẽ tính toán duty cycle (tỷ lệ nhiệm vụ) dựa trên giá trị mô-men xoắn 
- *          và thiết lập duty cycle này cho PWM của mô-tơ thông qua API MCAL.
+ *          hàm sẽ tính dòng trục q tham chiếu tỉ lệ với mô-men xoắn; vòng dòng điện
+ *          sử dụng giá trị mới từ chu kỳ PWM tiếp theo.
  *
  * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu (Nm)
  * @return  Std_ReturnType - Trả về E_OK nếu thiết lập thành công, E_NOT_OK nếu có lỗi
@@ -85,18 +396,18 @@ Std_ReturnType IoHwAb_MotorDriver_Init(const MotorDriver_ConfigType* ConfigPtr)
 Std_ReturnType IoHwAb_MotorDriver_SetTorque(float TorqueValue) {
     // Kiểm tra giá trị mô-men xoắn hợp lệ
     if (TorqueValue < 0.0f || TorqueValue > MotorDriver_CurrentConfig.Motor_MaxTorque) {
-        printf("Error: Torque value %.2f Nm out of range (Max: %d Nm).\n", TorqueValue, MotorDriver_CurrentConfig.Motor_MaxTorque);
+        DLT_LOG_ERROR(DLT_MSG_IOHWAB_TORQUE_OUT_OF_RANGE, DLT_F32(TorqueValue), DLT_U32(MotorDriver_CurrentConfig.Motor_MaxTorque));
         return E_NOT_OK;
     }
 
-    // Tính toán tỷ lệ nhiệm vụ (duty cycle) dựa trên mô-men xoắn
-    uint16_t dutyCycle = (uint16_t)((TorqueValue / MotorDriver_CurrentConfig.Motor_MaxTorque) * 100);
-
-    // Gọi API từ MCAL để cài đặt duty cycle của PWM
-    Pwm_SetDutyCycle(MotorDriver_CurrentConfig.Motor_Channel, dutyCycle);
+    // Tính dòng trục q tham chiếu dựa trên mô-men xoắn
+    MotorDriver_IqRef = (int16_t)(TorqueValue * MotorDriver_CurrentScale);
 
-    // In ra giá trị mô-men xoắn đã đặt
-    printf("Setting Motor Torque to %.2f Nm on Channel %d\n", TorqueValue, MotorDriver_CurrentConfig.Motor_Channel);
+    // Log giá trị mô-men xoắn đã đặt
+    DLT_LOG_DEBUG(DLT_MSG_IOHWAB_SET_TORQUE, DLT_F32(TorqueValue), DLT_U32(MotorDriver_CurrentConfig.Motor_Channel),
+                  DLT_U32(MotorDriver_CurrentConfig.Motor_Channel + 2), DLT_I32(MotorDriver_IqRef));
 
     return E_OK;
 }
+
+#endif /* IOHWAB_FIXED_POINT */
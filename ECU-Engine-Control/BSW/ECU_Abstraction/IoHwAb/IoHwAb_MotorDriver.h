@@ -17,6 +17,7 @@
 #define IOHWAB_MOTORDRIVER_H
 
 #include "Std_Types.h"
+#include "IoHwAb_Cfg.h"   // Chọn đường chuyển đổi float/dấu phẩy tĩnh
 
 /******************************************************************************
  * @brief   Cấu hình cho bộ điều khiển mô-tơ
@@ -26,10 +27,31 @@
  *          xoắn tối đa mà mô-tơ có thể tạo ra.
  ******************************************************************************/
 typedef struct {
-    uint8_t Motor_Channel;      /**< Kênh PWM điều khiển mô-tơ */
+    uint8_t Motor_Channel;      /**< Kênh PWM pha A; pha B, C dùng hai kênh kế tiếp */
     uint16_t Motor_MaxTorque;   /**< Mô-men xoắn tối đa (Nm) */
 } MotorDriver_ConfigType;
 
+/******************************************************************************
+ * @brief   Thống kê thời gian thực thi của vòng dòng điện
+ *
+ * @details Được cập nhật mỗi lần gọi `IoHwAb_MotorDriver_ControlStep`.
+ ******************************************************************************/
+typedef struct {
+    uint32_t Cycles;            /**< Số chu kỳ đã chạy */
+    uint32_t MaxExecNs;         /**< Thời gian thực thi lớn nhất của một chu kỳ (ns) */
+    uint64_t TotalExecNs;       /**< Tổng thời gian thực thi (ns) */
+} MotorDriver_StatsType;
+
+/******************************************************************************
+ * @brief   Kết quả đo hiệu năng của một chu kỳ FOC
+ ******************************************************************************/
+typedef struct {
+    uint32_t AverageNs;         /**< Thời gian trung bình của một chu kỳ (ns) */
+    uint32_t MaxNs;             /**< Thời gian lớn nhất của một chu kỳ (ns), đã lọc nhiễu do OS */
+    uint32_t PeriodNs;          /**< Chu kỳ PWM (ns) */
+    uint32_t LoadPercent;       /**< Tỉ lệ thời gian trung bình trên chu kỳ PWM (%), có thể lớn hơn 100 */
+} MotorDriver_BenchmarkType;
+
 /******************************************************************************
  * @brief   Hàm khởi tạo bộ điều khiển mô-tơ
  *
@@ -41,15 +63,71 @@ typedef struct {
  ******************************************************************************/
 Std_ReturnType IoHwAb_MotorDriver_Init(const MotorDriver_ConfigType* ConfigPtr);
 
+/******************************************************************************
+ * @brief   Hàm thay đổi mô-men xoắn tối đa của mô-tơ
+ *
+ * @details Áp dụng giá trị hiệu chuẩn sau khi khởi tạo; hệ số mô-men xoắn - dòng điện
+ *          được tính lại.
+ *
+ * @param   MaxTorque - Mô-men xoắn tối đa mới (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu giá trị không hợp lệ
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_SetMaxTorque(uint16_t MaxTorque);
+
+/******************************************************************************
+ * @brief   Hàm thực hiện một chu kỳ của vòng dòng điện FOC
+ *
+ * @details Phải được gọi một lần mỗi chu kỳ PWM (`IOHWAB_MOTOR_PWM_PERIOD_NS`), tương
+ *          ứng ngắt PWM trên phần cứng. Không làm gì trước khi khởi tạo thành công.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void IoHwAb_MotorDriver_ControlStep(void);
+
+/******************************************************************************
+ * @brief   Hàm lấy thống kê thời gian thực thi của vòng dòng điện
+ *
+ * @param   Stats - Con trỏ lưu trữ thống kê
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_GetStats(MotorDriver_StatsType* Stats);
+
+/******************************************************************************
+ * @brief   Hàm đo thời gian thực thi của một chu kỳ FOC
+ *
+ * @details Chạy vòng dòng điện trên dữ liệu tổng hợp, không truy cập phần cứng, và
+ *          đo thời gian trung bình và lớn nhất của một chu kỳ.
+ *
+ * @param   Cycles - Số chu kỳ cần chạy
+ * @param   Result - Con trỏ lưu trữ kết quả đo
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_Benchmark(uint32_t Cycles, MotorDriver_BenchmarkType* Result);
+
 /******************************************************************************
  * @brief   Hàm điều chỉnh mô-men xoắn của mô-tơ
  *
  * @details Hàm này điều chỉnh mô-men xoắn của mô-tơ theo giá trị yêu cầu.
- *          Mô-men xoắn sẽ được thiết lập dựa trên giá trị TorqueValue đầu vào.
+ *          Mô-men xoắn được chuyển thành dòng trục q tham chiếu cho vòng
+ *          dòng điện FOC.
  *
  * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu (Nm)
  * @return  Std_ReturnType - Trả về E_OK nếu thiết lập thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
 Std_ReturnType IoHwAb_MotorDriver_SetTorque(float TorqueValue);
 
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   Hàm điều chỉnh mô-men xoắn của mô-tơ với giá trị dấu phẩy tĩnh
+ *
+ * @details Giống `IoHwAb_MotorDriver_SetTorque` nhưng nhận mô-men xoắn dạng Q16.16,
+ *          dòng tham chiếu được tính bằng phép nhân số nguyên với hệ số tính sẵn.
+ *
+ * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu dạng Q16.16 (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu thiết lập thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType IoHwAb_MotorDriver_SetTorqueFixed(IoHwAb_Q16_16Type TorqueValue);
+#endif
+
 #endif /* IOHWAB_MOTORDRIVER_H */
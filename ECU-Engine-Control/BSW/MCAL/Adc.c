@@ -15,6 +15,32 @@
  ******************************************************************************/
 
 #include "Adc.h"
+#include "Pwm.h"   // Đọc lại duty PWM để mô phỏng dòng pha
+#include "Dlt.h"   // Log bất đồng bộ
+#include "Os.h"    // Thời gian chuyển đổi nhóm theo đồng hồ của Os
+
+/******************************************************************************
+ * @brief   Tham số mô phỏng động cơ cho phản hồi dòng điện
+ *
+ * @details Mỗi pha được mô phỏng như tải RL bậc nhất: dòng tiến về
+ *          ADC_SIM_MOTOR_GAIN * điện áp pha với hằng số thời gian 2^ADC_SIM_MOTOR_TAU_SHIFT
+ *          chu kỳ PWM. Rotor quay đều ADC_SIM_MOTOR_ANGLE_STEP mỗi lần lấy mẫu.
+ ******************************************************************************/
+#define ADC_SIM_MOTOR_GAIN        3      /**< Dòng / điện áp pha, dạng (GAIN / 2) */
+#define ADC_SIM_MOTOR_TAU_SHIFT   4      /**< Hằng số thời gian 16 chu kỳ PWM */
+#define ADC_SIM_MOTOR_ANGLE_STEP  819U   /**< 200 Hz điện ở 16 kHz */
+
+static volatile int32_t Adc_SimPhaseCurrent[3];  // Dòng pha mô phỏng, Q15 (đọc bởi mô hình xe)
+static uint16_t Adc_SimRotorAngle;      // Góc điện mô phỏng
+
+/******************************************************************************
+ * @brief   Tín hiệu vào mô phỏng của các kênh ADC
+ *
+ * @details Giá trị do mô hình xe ghi; kênh chưa được nối trả về giá trị ngẫu nhiên
+ *          như một đầu vào thả nổi.
+ ******************************************************************************/
+static volatile uint16_t Adc_SimInput[ADC_MAX_CHANNELS];
+static volatile uint8_t Adc_SimInputConnected[ADC_MAX_CHANNELS];
 
 /******************************************************************************
  * @brief   Biến cấu hình hiện tại của bộ chuyển đổi ADC
@@ -43,7 +69,7 @@ static Adc_ConfigType Adc_CurrentConfig;  // Lưu trữ cấu hình hiện tại
  ******************************************************************************/
 void Adc_Init(const Adc_ConfigType* ConfigPtr) {
     if (ConfigPtr == NULL) {
-        printf("Error: Null configuration pointer passed to Adc_Init.\n");
+        DLT_LOG_ERROR(DLT_MSG_ADC_NULL_CONFIG);
         return;
     }
 
@@ -55,11 +81,9 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr) {
     // Khởi tạo seed cho việc sinh số ngẫu nhiên để mô phỏng ADC
     srand(time(0));
 
-    // In ra thông tin cấu hình ADC
-    printf("ADC Initialized with Configuration:\n");
-    printf(" - Channel: %d\n", Adc_CurrentConfig.Adc_Channel);
-    printf(" - Sampling Rate: %d Hz\n", Adc_CurrentConfig.Adc_SamplingRate);
-    printf(" - Resolution: %d-bit\n", Adc_CurrentConfig.Adc_Resolution);
+    // Log thông tin cấu hình ADC
+    DLT_LOG_INFO(DLT_MSG_ADC_INIT, DLT_U32(Adc_CurrentConfig.Adc_Channel), DLT_U32(Adc_CurrentConfig.Adc_SamplingRate),
+                 DLT_U32(Adc_CurrentConfig.Adc_Resolution));
 }
 
 /******************************************************************************
@@ -70,22 +94,131 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr) {
  *          để mô phỏng thời gian lấy mẫu thực tế. Giá trị ADC ngẫu nhiên 
  *          được sinh từ 0 đến 1023, giả lập độ phân giải 10-bit của ADC.
  *
- * @param   channel - Kênh ADC cần đọc giá trị
- * @return  int - Giá trị ADC đọc được (0-1023)
+ * @param   Channel - Kênh ADC cần đọc giá trị
+ * @param   Value - Con trỏ lưu trữ giá trị ADC đọc được (0-1023)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
  ******************************************************************************/
-int Adc_ReadChannel(int channel) {
-    int adc_value = 0;
+Std_ReturnType Adc_ReadChannel(uint8_t Channel, uint16_t* Value) {
+    if (Value == NULL) {
+        return E_NOT_OK;
+    }
 
     // Gọi hàm delay để mô phỏng thời gian đọc ADC
     Delay(500);  // Tạo độ trễ 500ms để mô phỏng
 
     // Giả lập giá trị ngẫu nhiên từ 0 đến 1023 (giá trị ADC 10-bit)
-    adc_value = rand() % 1024;
+    *Value = (uint16_t)(rand() % 1024);
+
+    // Log giá trị đọc được từ kênh ADC
+    DLT_LOG_DEBUG(DLT_MSG_ADC_READ_CHANNEL, DLT_U32(Channel), DLT_U32(*Value));
+
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Đọc một nhóm kênh ADC trong một lần chuyển đổi (mô phỏng)
+ *
+ * @details Mô phỏng một lần chuyển đổi dạng scan: độ trễ 1ms được tính một lần
+ *          cho cả nhóm, sau đó mỗi kênh nhận tín hiệu của mô hình xe nếu kênh đã được
+ *          nối, ngược lại một giá trị ngẫu nhiên 10-bit. Hàm được gọi định kỳ từ task
+ *          thu thập cảm biến nên không in ra màn hình.
+ *
+ * @param   Channels - Mảng các kênh ADC cần đọc
+ * @param   Values - Mảng lưu trữ giá trị đọc được
+ * @param   Count - Số kênh trong nhóm
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Adc_ReadGroup(const uint8_t* Channels, uint16_t* Values, uint8_t Count) {
+    if (Channels == NULL || Values == NULL || Count == 0U) {
+        return E_NOT_OK;
+    }
+
+    // Một lần chờ chuyển đổi cho cả nhóm (không chờ khi mô phỏng theo đồng hồ ảo)
+    Os_Delay(1);
+
+    for (uint8_t i = 0; i < Count; i++) {
+        uint8_t channel = Channels[i];
+        if (channel < ADC_MAX_CHANNELS && Adc_SimInputConnected[channel]) {
+            Values[i] = Adc_SimInput[channel];
+        } else {
+            Values[i] = (uint16_t)(rand() % 1024);
+        }
+    }
+
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Đọc phản hồi của động cơ cho vòng điều khiển dòng điện (mô phỏng)
+ *
+ * @details Điện áp pha được tính từ duty hiện tại của ba kênh PWM (trừ đi trung bình
+ *          để bỏ thành phần thứ tự không), sau đó dòng mỗi pha được cập nhật theo mô
+ *          hình RL bậc nhất.
+ *
+ * @param   PwmChannel - Kênh PWM của pha A
+ * @param   Ia - Con trỏ lưu trữ dòng pha A (Q15)
+ * @param   Ib - Con trỏ lưu trữ dòng pha B (Q15)
+ * @param   Angle - Con trỏ lưu trữ góc điện của rotor
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Adc_ReadMotorFeedback(uint8_t PwmChannel, int16_t* Ia, int16_t* Ib, uint16_t* Angle) {
+    if (Ia == NULL || Ib == NULL || Angle == NULL) {
+        return E_NOT_OK;
+    }
 
-    // In giá trị đọc được từ kênh ADC
-    printf("Reading ADC Channel %d: Value = %d\n", channel, adc_value);
+    uint16_t duty[3], period = 0;
+    for (uint8_t i = 0; i < 3U; i++) {
+        if (Pwm_GetOutput((uint8_t)(PwmChannel + i), &duty[i], &period) != E_OK || period == 0U) {
+            return E_NOT_OK;
+        }
+    }
 
-    return adc_value;
+    // Điện áp pha so với trung tính, Q15 theo điện áp DC bus
+    int32_t mean = ((int32_t)duty[0] + duty[1] + duty[2]) / 3;
+    for (uint8_t i = 0; i < 3U; i++) {
+        int32_t voltage = (((int32_t)duty[i] - mean) << 15) / (int32_t)period;
+        int32_t target = (voltage * ADC_SIM_MOTOR_GAIN) >> 1;
+        Adc_SimPhaseCurrent[i] += (target - Adc_SimPhaseCurrent[i]) >> ADC_SIM_MOTOR_TAU_SHIFT;
+    }
+
+    Adc_SimRotorAngle = (uint16_t)(Adc_SimRotorAngle + ADC_SIM_MOTOR_ANGLE_STEP);
+
+    // Giới hạn theo dải đo của bộ khuếch đại dòng
+    for (uint8_t i = 0; i < 2U; i++) {
+        Adc_SimPhaseCurrent[i] = (Adc_SimPhaseCurrent[i] > 32767) ? 32767 : Adc_SimPhaseCurrent[i];
+        Adc_SimPhaseCurrent[i] = (Adc_SimPhaseCurrent[i] < -32768) ? -32768 : Adc_SimPhaseCurrent[i];
+    }
+    *Ia = (int16_t)Adc_SimPhaseCurrent[0];
+    *Ib = (int16_t)Adc_SimPhaseCurrent[1];
+    *Angle = Adc_SimRotorAngle;
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Đọc dòng pha của mô phỏng động cơ (mô phỏng)
+ *
+ * @param   Current - Mảng lưu trữ dòng pha A, B, C (Q15)
+ * @return  void
+ ******************************************************************************/
+void Adc_GetSimulatedPhaseCurrents(int32_t Current[3]) {
+    for (uint8_t i = 0; i < 3U; i++) {
+        Current[i] = Adc_SimPhaseCurrent[i];
+    }
+}
+
+/******************************************************************************
+ * @brief   Nối một kênh ADC với tín hiệu của mô hình xe (mô phỏng)
+ *
+ * @param   Channel - Kênh ADC
+ * @param   Value - Giá trị ADC thô (0-1023)
+ * @return  void
+ ******************************************************************************/
+void Adc_SetSimulatedInput(uint8_t Channel, uint16_t Value) {
+    if (Channel >= ADC_MAX_CHANNELS) {
+        return;
+    }
+    Adc_SimInput[Channel] = (Value > 1023U) ? 1023U : Value;
+    Adc_SimInputConnected[Channel] = 1U;
 }
 
 /******************************************************************************
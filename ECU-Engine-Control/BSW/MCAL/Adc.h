@@ -23,6 +23,11 @@
 #include <unistd.h>  // Thư viện hỗ trợ hàm sleep (sử dụng cho delay)
 #include "Std_Types.h"
 
+/******************************************************************************
+ * @brief   Số kênh của bộ chuyển đổi ADC
+ ******************************************************************************/
+#define ADC_MAX_CHANNELS 16U
+
 /******************************************************************************
  * @brief   Cấu trúc chứa thông tin cấu hình của ADC
  *
@@ -50,13 +55,68 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr);
 /******************************************************************************
  * @brief   Đọc giá trị từ kênh ADC cụ thể
  *
- * @details Hàm này đọc giá trị từ kênh ADC được chỉ định và trả về kết quả. 
- *          Giá trị đọc được là một số nguyên đại diện cho tín hiệu analog.
+ * @details Hàm này đọc giá trị từ kênh ADC được chỉ định và lưu kết quả vào biến
+ *          con trỏ đầu vào. Giá trị đọc được là một số nguyên đại diện cho tín hiệu analog.
+ *
+ * @param   Channel - Kênh ADC cần đọc giá trị
+ * @param   Value - Con trỏ lưu trữ giá trị đọc được (0-1023)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Adc_ReadChannel(uint8_t Channel, uint16_t* Value);
+
+/******************************************************************************
+ * @brief   Đọc một nhóm kênh ADC trong một lần chuyển đổi
+ *
+ * @details Chuyển đổi tuần tự tất cả các kênh trong nhóm (scan mode) và lưu kết quả
+ *          theo đúng thứ tự của mảng `Channels`. Thời gian chờ chuyển đổi chỉ tính
+ *          một lần cho cả nhóm thay vì một lần cho mỗi kênh.
+ *
+ * @param   Channels - Mảng các kênh ADC cần đọc
+ * @param   Values - Mảng lưu trữ giá trị đọc được, cùng số phần tử với `Channels`
+ * @param   Count - Số kênh trong nhóm
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Adc_ReadGroup(const uint8_t* Channels, uint16_t* Values, uint8_t Count);
+
+/******************************************************************************
+ * @brief   Đọc phản hồi của động cơ cho vòng điều khiển dòng điện
+ *
+ * @details Lấy mẫu đồng thời dòng pha A, B và góc điện của rotor (resolver), đồng
+ *          bộ với tâm chu kỳ PWM. Dòng điện dạng Q15, 1.0 tương ứng dòng ở mô-men
+ *          tối đa; góc 65536 = một vòng điện. Hàm không chờ và không in ra màn hình
+ *          để gọi được ở tần số PWM.
  *
- * @param   channel - Kênh ADC cần đọc giá trị
- * @return  int - Giá trị đọc từ kênh ADC
+ * @param   PwmChannel - Kênh PWM của pha A (dùng cho mô phỏng dòng điện)
+ * @param   Ia - Con trỏ lưu trữ dòng pha A
+ * @param   Ib - Con trỏ lưu trữ dòng pha B
+ * @param   Angle - Con trỏ lưu trữ góc điện của rotor
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Adc_ReadMotorFeedback(uint8_t PwmChannel, int16_t* Ia, int16_t* Ib, uint16_t* Angle);
+
+/******************************************************************************
+ * @brief   Đọc dòng pha của mô phỏng động cơ (mô phỏng)
+ *
+ * @details Dòng ba pha hiện tại của mô hình RL được cập nhật trong
+ *          `Adc_ReadMotorFeedback`, không lượng tử hóa và không giới hạn theo dải đo.
+ *          Dùng bởi mô hình xe để tính mô-men xoắn của động cơ.
+ *
+ * @param   Current - Mảng lưu trữ dòng pha A, B, C (Q15)
+ * @return  void
+ ******************************************************************************/
+void Adc_GetSimulatedPhaseCurrents(int32_t Current[3]);
+
+/******************************************************************************
+ * @brief   Nối một kênh ADC với tín hiệu của mô hình xe (mô phỏng)
+ *
+ * @details Sau lần gọi đầu tiên, `Adc_ReadGroup` trả về giá trị này cho kênh thay
+ *          vì giá trị ngẫu nhiên. Được gọi định kỳ bởi mô hình xe (Plant).
+ *
+ * @param   Channel - Kênh ADC
+ * @param   Value - Giá trị ADC thô (0-1023)
+ * @return  void
  ******************************************************************************/
-int Adc_ReadChannel(int channel);
+void Adc_SetSimulatedInput(uint8_t Channel, uint16_t Value);
 
 /******************************************************************************
  * @brief   Hàm tạo độ trễ (delay)
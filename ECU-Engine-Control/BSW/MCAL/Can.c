@@ -15,6 +15,25 @@
  ******************************************************************************/
 
 #include "Can.h"
+#include "Dlt.h"   // Log bất đồng bộ
+
+/******************************************************************************
+ * @brief   Hàm gộp 4 byte dữ liệu CAN thành một giá trị 32-bit để log
+ *
+ * @details Byte đầu tiên nằm ở vị trí cao nhất; các byte vượt quá độ dài thông
+ *          điệp được coi là 0.
+ *
+ * @param   message - Con trỏ tới thông điệp CAN
+ * @param   offset - Vị trí byte đầu tiên (0 hoặc 4)
+ * @return  uint32_t - Giá trị 32-bit của 4 byte dữ liệu
+ ******************************************************************************/
+static inline uint32_t Can_PackData(const Can_MessageType* message, int offset) {
+    uint32_t packed = 0U;
+    for (int i = offset; i < offset + 4; i++) {
+        packed = (packed << 8) | ((i < message->length) ? ((uint32_t)message->data[i] & 0xFFU) : 0U);
+    }
+    return packed;
+}
 
 /******************************************************************************
  * @brief   Hàm khởi tạo giao tiếp CAN
@@ -28,7 +47,7 @@
  * @return  void
  ******************************************************************************/
 void Can_Init(void) {
-    printf("CAN Initialized.\n");
+    DLT_LOG_INFO(DLT_MSG_CAN_INIT);
 }
 
 /******************************************************************************
@@ -47,14 +66,9 @@ void Can_SendMessage(Can_MessageType* message) {
     // Gọi hàm delay để mô phỏng thời gian gửi CAN
     Can_Delay(200);  // Tạo độ trễ 200ms để mô phỏng
 
-    // In ra thông tin thông điệp được gửi
-    printf("CAN Message Sent:\n");
-    printf("ID: %d, Data Length: %d, Data: [", message->id, message->length);
-    for (int i = 0; i < message->length; i++) {
-        printf("%d", message->data[i]);
-        if (i < message->length - 1) printf(", ");
-    }
-    printf("]\n");
+    // Log thông tin thông điệp được gửi
+    DLT_LOG_DEBUG(DLT_MSG_CAN_SENT, DLT_U32(message->id), DLT_U32(message->length),
+                  DLT_U32(Can_PackData(message, 0)), DLT_U32(Can_PackData(message, 4)));
 }
 
 /******************************************************************************
@@ -85,14 +99,9 @@ Can_MessageType Can_ReceiveMessage(void) {
         message.data[i] = rand() % 256;  // Giả lập dữ liệu ngẫu nhiên (0 - 255)
     }
 
-    // In ra thông tin thông điệp nhận được
-    printf("CAN Message Received:\n");
-    printf("ID: %d, Data Length: %d, Data: [", message.id, message.length);
-    for (int i = 0; i < message.length; i++) {
-        printf("%d", message.data[i]);
-        if (i < message.length - 1) printf(", ");
-    }
-    printf("]\n");
+    // Log thông tin thông điệp nhận được
+    DLT_LOG_DEBUG(DLT_MSG_CAN_RECEIVED, DLT_U32(message.id), DLT_U32(message.length),
+                  DLT_U32(Can_PackData(&message, 0)), DLT_U32(Can_PackData(&message, 4)));
 
     return message;
 }
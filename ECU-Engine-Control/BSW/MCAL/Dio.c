@@ -18,6 +18,7 @@
  ******************************************************************************/
 
 #include "Dio.h"
+#include "Dlt.h"   // Log bất đồng bộ
 
 /******************************************************************************
  * @brief   Khởi tạo giao diện DIO (Digital Input/Output)
@@ -33,7 +34,7 @@
 void Dio_Init(void) {
     // Khởi tạo seed cho random số ngẫu nhiên
     srand(time(0));
-    printf("DIO Initialized.\n");
+    DLT_LOG_INFO(DLT_MSG_DIO_INIT);
 }
 
 /******************************************************************************
@@ -57,8 +58,8 @@ Dio_LevelType Dio_ReadChannel(int channel) {
     // Giả lập trạng thái ngẫu nhiên của DIO (0 hoặc 1)
     dio_value = (rand() % 2) ? DIO_HIGH : DIO_LOW;
 
-    // In trạng thái đọc được từ kênh DIO
-    printf("Reading DIO Channel %d: Value = %d\n", channel, dio_value);
+    // Log trạng thái đọc được từ kênh DIO
+    DLT_LOG_DEBUG(DLT_MSG_DIO_READ, DLT_I32(channel), DLT_I32(dio_value));
 
     return dio_value;
 }
@@ -80,8 +81,8 @@ void Dio_WriteChannel(int channel, Dio_LevelType level) {
     // Gọi hàm delay để mô phỏng thời gian ghi DIO
     Dio_Delay(100);  // Tạo độ trễ 100ms để mô phỏng
 
-    // In trạng thái được ghi vào kênh DIO
-    printf("Writing DIO Channel %d: Value = %d\n", channel, level);
+    // Log trạng thái được ghi vào kênh DIO
+    DLT_LOG_DEBUG(DLT_MSG_DIO_WRITE, DLT_I32(channel), DLT_I32(level));
 }
 
 /******************************************************************************
@@ -0,0 +1,211 @@
+/******************************************************************************
+ * @file    Fls.c
+ * @brief   Triển khai driver bộ nhớ flash mô phỏng (Flash Driver)
+ *
+ * @details File này mô phỏng bộ nhớ flash bằng một file được ánh xạ vào bộ nhớ
+ *          qua `mmap`. Các thao tác đọc/ghi thao tác trực tiếp trên vùng ánh xạ
+ *          nên không cần bộ đệm trung gian, và hệ điều hành tự đồng bộ nội dung
+ *          xuống file. Ngữ nghĩa flash (xóa theo sector, ghi chỉ xóa bit) được
+ *          kiểm tra để phát hiện lỗi lập trình giống như trên phần cứng thật.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author  
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+#include "Fls.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static uint8_t* Fls_Memory = NULL;                      /**< Vùng nhớ ánh xạ của flash */
+static int Fls_FileDescriptor = -1;                     /**< File lưu nội dung flash */
+static uint32_t Fls_EraseCount[FLS_SECTOR_COUNT];       /**< Số lần xóa của từng sector */
+
+/******************************************************************************
+ * @brief   Kiểm tra một vùng địa chỉ có nằm trọn trong flash hay không
+ ******************************************************************************/
+static Std_ReturnType Fls_CheckRange(uint32_t Address, uint32_t Length) {
+    uint32_t offset = Address - FLS_BASE_ADDRESS;  // Địa chỉ dưới base sẽ tràn thành số rất lớn
+    if (Fls_Memory == NULL || offset > FLS_TOTAL_SIZE || Length > FLS_TOTAL_SIZE - offset) {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Khởi tạo bộ nhớ flash mô phỏng
+ *
+ * @details Hàm mở file flash theo cấu hình. Nếu file mới được tạo (kích thước nhỏ
+ *          hơn FLS_TOTAL_SIZE), file được mở rộng và toàn bộ nội dung được xóa về
+ *          0xFF. Sau đó file được ánh xạ vào bộ nhớ với chế độ MAP_SHARED.
+ *
+ * @param   ConfigPtr - Con trỏ tới cấu trúc `Fls_ConfigType` chứa cấu hình FLS
+ * @return  Std_ReturnType - E_OK nếu khởi tạo thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Init(const Fls_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL || ConfigPtr->FilePath == NULL || Fls_Memory != NULL) {
+        return E_NOT_OK;
+    }
+
+    int fd = open(ConfigPtr->FilePath, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        printf("FLS: cannot open %s\n", ConfigPtr->FilePath);
+        return E_NOT_OK;
+    }
+
+    struct stat st;
+    uint8_t isNewFile = 0;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return E_NOT_OK;
+    }
+    if ((uint64_t)st.st_size < FLS_TOTAL_SIZE) {
+        if (ftruncate(fd, (off_t)FLS_TOTAL_SIZE) != 0) {
+            close(fd);
+            return E_NOT_OK;
+        }
+        isNewFile = 1;
+    }
+
+    void* memory = mmap(NULL, FLS_TOTAL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        close(fd);
+        return E_NOT_OK;
+    }
+
+    Fls_Memory = (uint8_t*)memory;
+    Fls_FileDescriptor = fd;
+    memset(Fls_EraseCount, 0, sizeof(Fls_EraseCount));
+    if (isNewFile) {
+        memset(Fls_Memory, FLS_ERASED_VALUE, FLS_TOTAL_SIZE);  // Flash mới xuất xưởng ở trạng thái xóa
+    }
+
+    printf("FLS Initialized: %lu KB in %lu sectors (%s)\n",
+           (unsigned long)(FLS_TOTAL_SIZE / 1024UL), (unsigned long)FLS_SECTOR_COUNT, ConfigPtr->FilePath);
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Giải phóng bộ nhớ flash mô phỏng
+ *
+ * @details Đồng bộ toàn bộ vùng ánh xạ xuống file rồi hủy ánh xạ và đóng file.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Fls_DeInit(void) {
+    if (Fls_Memory == NULL) {
+        return;
+    }
+    msync(Fls_Memory, FLS_TOTAL_SIZE, MS_SYNC);
+    munmap(Fls_Memory, FLS_TOTAL_SIZE);
+    close(Fls_FileDescriptor);
+    Fls_Memory = NULL;
+    Fls_FileDescriptor = -1;
+}
+
+/******************************************************************************
+ * @brief   Xóa một vùng flash
+ *
+ * @details Hàm kiểm tra vùng cần xóa căn theo sector, sau đó đưa mọi byte về
+ *          FLS_ERASED_VALUE và tăng bộ đếm số lần xóa của từng sector.
+ *
+ * @param   TargetAddress - Địa chỉ bắt đầu (căn theo sector)
+ * @param   Length - Số byte cần xóa (bội số của kích thước sector)
+ * @return  Std_ReturnType - E_OK nếu xóa thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Fls_Erase(uint32_t TargetAddress, uint32_t Length) {
+    if (Fls_CheckRange(TargetAddress, Length) != E_OK || Length == 0 ||
+        ((TargetAddress - FLS_BASE_ADDRESS) % FLS_SECTOR_SIZE) != 0 || (Length % FLS_SECTOR_SIZE) != 0) {
+        return E_NOT_OK;
+    }
+
+    uint32_t offset = TargetAddress - FLS_BASE_ADDRESS;
+    memset(&Fls_Memory[offset], FLS_ERASED_VALUE, Length);
+    for (uint32_t sector = offset / FLS_SECTOR_SIZE; sector < (offset + Length) / FLS_SECTOR_SIZE; sector++) {
+        Fls_EraseCount[sector]++;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Ghi dữ liệu vào flash
+ *
+ * @details Hàm kiểm tra trước toàn bộ vùng đích: nếu một byte nguồn có bit 1 mà
+ *          byte đích tương ứng đã là 0 thì thao tác ghi bị từ chối mà không thay
+ *          đổi flash. Ngược lại dữ liệu được sao chép thẳng vào vùng ánh xạ.
+ *
+ * @param   TargetAddress - Địa chỉ đích trong flash
+ * @param   SourceAddressPtr - Con trỏ tới dữ liệu nguồn
+ * @param   Length - Số byte cần ghi
+ * @return  Std_ReturnType - E_OK nếu ghi thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Write(uint32_t TargetAddress, const uint8_t* SourceAddressPtr, uint32_t Length) {
+    if (SourceAddressPtr == NULL || Fls_CheckRange(TargetAddress, Length) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    uint8_t* target = &Fls_Memory[TargetAddress - FLS_BASE_ADDRESS];
+    for (uint32_t i = 0; i < Length; i++) {
+        if ((target[i] & SourceAddressPtr[i]) != SourceAddressPtr[i]) {
+            return E_NOT_OK;  // Không thể lập trình bit 0 lên 1 khi chưa xóa
+        }
+    }
+    memcpy(target, SourceAddressPtr, Length);
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Đọc dữ liệu từ flash
+ *
+ * @param   SourceAddress - Địa chỉ nguồn trong flash
+ * @param   TargetAddressPtr - Con trỏ tới bộ đệm nhận dữ liệu
+ * @param   Length - Số byte cần đọc
+ * @return  Std_ReturnType - E_OK nếu đọc thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Read(uint32_t SourceAddress, uint8_t* TargetAddressPtr, uint32_t Length) {
+    if (TargetAddressPtr == NULL || Fls_CheckRange(SourceAddress, Length) != E_OK) {
+        return E_NOT_OK;
+    }
+    memcpy(TargetAddressPtr, &Fls_Memory[SourceAddress - FLS_BASE_ADDRESS], Length);
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Kiểm tra một vùng flash đã ở trạng thái xóa hay chưa
+ *
+ * @param   TargetAddress - Địa chỉ bắt đầu
+ * @param   Length - Số byte cần kiểm tra
+ * @return  Std_ReturnType - E_OK nếu mọi byte bằng FLS_ERASED_VALUE, ngược lại E_NOT_OK
+ ******************************************************************************/
+Std_ReturnType Fls_BlankCheck(uint32_t TargetAddress, uint32_t Length) {
+    if (Fls_CheckRange(TargetAddress, Length) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    const uint8_t* target = &Fls_Memory[TargetAddress - FLS_BASE_ADDRESS];
+    for (uint32_t i = 0; i < Length; i++) {
+        if (target[i] != FLS_ERASED_VALUE) {
+            return E_NOT_OK;
+        }
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Lấy số lần đã xóa của một sector
+ *
+ * @param   SectorIndex - Chỉ số sector
+ * @return  uint32_t - Số lần xóa kể từ khi khởi tạo (0 nếu chỉ số không hợp lệ)
+ ******************************************************************************/
+uint32_t Fls_GetEraseCount(uint32_t SectorIndex) {
+    if (SectorIndex >= FLS_SECTOR_COUNT) {
+        return 0;
+    }
+    return Fls_EraseCount[SectorIndex];
+}
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * @file    Fls.h
+ * @brief   Header file cho driver bộ nhớ flash mô phỏng (Flash Driver)
+ *
+ * @details File này định nghĩa cấu hình và các API của mô-đun FLS. Bộ nhớ flash
+ *          được mô phỏng bằng một file ánh xạ vào bộ nhớ (memory-mapped file) và
+ *          tuân theo ngữ nghĩa của flash thật: chỉ xóa được theo từng sector
+ *          (mọi byte trở về 0xFF), và thao tác ghi chỉ có thể chuyển bit từ 1 về 0.
+ *          Nội dung flash được giữ lại giữa các lần chạy chương trình.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author  
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef FLS_H
+#define FLS_H
+
+#include "Std_Types.h"
+
+/******************************************************************************
+ * @brief   Thông số của bộ nhớ flash mô phỏng
+ ******************************************************************************/
+#define FLS_BASE_ADDRESS    0x00000000UL   /**< Địa chỉ logic đầu tiên của flash */
+#define FLS_TOTAL_SIZE      0x01000000UL   /**< Dung lượng flash: 16 MB */
+#define FLS_SECTOR_SIZE     0x00001000UL   /**< Kích thước một sector xóa: 4 KB */
+#define FLS_SECTOR_COUNT    (FLS_TOTAL_SIZE / FLS_SECTOR_SIZE)
+#define FLS_ERASED_VALUE    0xFFU          /**< Giá trị của byte sau khi xóa */
+
+/******************************************************************************
+ * @brief   Cấu trúc cấu hình cho mô-đun FLS
+ *
+ * @details Cấu trúc `Fls_ConfigType` chứa đường dẫn tới file dùng để lưu nội dung
+ *          flash mô phỏng. File được tạo mới và xóa trắng (0xFF) nếu chưa tồn tại.
+ ******************************************************************************/
+typedef struct {
+    const char* FilePath;   /**< Đường dẫn file lưu nội dung flash */
+} Fls_ConfigType;
+
+/******************************************************************************
+ * @brief   Khởi tạo bộ nhớ flash mô phỏng
+ *
+ * @details Mở (hoặc tạo mới) file flash và ánh xạ toàn bộ vào bộ nhớ.
+ *
+ * @param   ConfigPtr - Con trỏ tới cấu trúc `Fls_ConfigType` chứa cấu hình FLS
+ * @return  Std_ReturnType - E_OK nếu khởi tạo thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Init(const Fls_ConfigType* ConfigPtr);
+
+/******************************************************************************
+ * @brief   Giải phóng bộ nhớ flash mô phỏng
+ *
+ * @details Đồng bộ nội dung xuống file và hủy ánh xạ bộ nhớ.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Fls_DeInit(void);
+
+/******************************************************************************
+ * @brief   Xóa một vùng flash
+ *
+ * @details Địa chỉ và độ dài phải căn theo FLS_SECTOR_SIZE. Mọi byte trong vùng
+ *          được đưa về FLS_ERASED_VALUE và bộ đếm số lần xóa của sector tăng lên.
+ *
+ * @param   TargetAddress - Địa chỉ bắt đầu (căn theo sector)
+ * @param   Length - Số byte cần xóa (bội số của kích thước sector)
+ * @return  Std_ReturnType - E_OK nếu xóa thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Fls_Erase(uint32_t TargetAddress, uint32_t Length);
+
+/******************************************************************************
+ * @brief   Ghi dữ liệu vào flash
+ *
+ * @details Dữ liệu được ghi trực tiếp vào vùng nhớ ánh xạ. Thao tác ghi thất bại
+ *          nếu cần chuyển một bit từ 0 lên 1 (vùng đích chưa được xóa).
+ *
+ * @param   TargetAddress - Địa chỉ đích trong flash
+ * @param   SourceAddressPtr - Con trỏ tới dữ liệu nguồn
+ * @param   Length - Số byte cần ghi
+ * @return  Std_ReturnType - E_OK nếu ghi thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Write(uint32_t TargetAddress, const uint8_t* SourceAddressPtr, uint32_t Length);
+
+/******************************************************************************
+ * @brief   Đọc dữ liệu từ flash
+ *
+ * @param   SourceAddress - Địa chỉ nguồn trong flash
+ * @param   TargetAddressPtr - Con trỏ tới bộ đệm nhận dữ liệu
+ * @param   Length - Số byte cần đọc
+ * @return  Std_ReturnType - E_OK nếu đọc thành công, E_NOT_OK nếu thất bại
+ ******************************************************************************/
+Std_ReturnType Fls_Read(uint32_t SourceAddress, uint8_t* TargetAddressPtr, uint32_t Length);
+
+/******************************************************************************
+ * @brief   Kiểm tra một vùng flash đã ở trạng thái xóa hay chưa
+ *
+ * @param   TargetAddress - Địa chỉ bắt đầu
+ * @param   Length - Số byte cần kiểm tra
+ * @return  Std_ReturnType - E_OK nếu mọi byte bằng FLS_ERASED_VALUE, ngược lại E_NOT_OK
+ ******************************************************************************/
+Std_ReturnType Fls_BlankCheck(uint32_t TargetAddress, uint32_t Length);
+
+/******************************************************************************
+ * @brief   Lấy số lần đã xóa của một sector
+ *
+ * @details Bộ đếm chỉ được lưu trong RAM và dùng để theo dõi độ mòn của flash.
+ *
+ * @param   SectorIndex - Chỉ số sector
+ * @return  uint32_t - Số lần xóa kể từ khi khởi tạo (0 nếu chỉ số không hợp lệ)
+ ******************************************************************************/
+uint32_t Fls_GetEraseCount(uint32_t SectorIndex);
+
+#endif // FLS_H
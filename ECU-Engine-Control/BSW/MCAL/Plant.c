@@ -0,0 +1,244 @@
+/******************************************************************************
+ * @file    Plant.c
+ * @brief   Triển khai mô hình xe (plant) dùng trong mô phỏng vòng kín
+ *
+ * @details Các hàm tính trên mảng (`Plant_Step`, `Plant_UpdateSensors`) chỉ dùng
+ *          phép toán trên các mảng liên tiếp và phép chọn thay cho rẽ nhánh để được
+ *          vector hóa. Phiên bản ECU là một nhóm một xe, nối với mô phỏng động cơ
+ *          (đầu vào mô-men, từ duty PWM) và ADC mô phỏng (đầu ra cảm biến).
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "Plant.h"
+#include "Adc.h"   // Kênh ADC mô phỏng nhận giá trị cảm biến, dòng pha của động cơ
+#include <math.h>
+
+/******************************************************************************
+ * @brief   Cấu hình đang dùng của phiên bản ECU
+ ******************************************************************************/
+static const Plant_ConfigType* Plant_CurrentConfig = NULL;
+
+/******************************************************************************
+ * @brief   Dữ liệu của phiên bản ECU (một xe)
+ ******************************************************************************/
+static float Plant_EcuThrottle;
+static float Plant_EcuMotorTorque;
+static float Plant_EcuPayload;
+static float Plant_EcuGrade;
+static float Plant_EcuSpeed;
+static float Plant_EcuAcceleration;
+static uint32_t Plant_EcuNoiseState;
+static uint16_t Plant_EcuSensorRaw[PLANT_NUM_SENSORS];
+static uint32_t Plant_EcuStepCount;   /**< Số bước trong chu kỳ hiện tại của hồ sơ lái, dùng làm thời gian */
+static uint32_t Plant_EcuProfileSteps; /**< Số bước của một chu kỳ hồ sơ lái */
+
+static Plant_VehicleArrayType Plant_Ecu = {
+    .Count = 1U,
+    .Throttle = &Plant_EcuThrottle,
+    .MotorTorque = &Plant_EcuMotorTorque,
+    .Payload = &Plant_EcuPayload,
+    .Grade = &Plant_EcuGrade,
+    .Speed = &Plant_EcuSpeed,
+    .Acceleration = &Plant_EcuAcceleration,
+    .NoiseState = &Plant_EcuNoiseState,
+    .SensorRaw = { &Plant_EcuSensorRaw[PLANT_SENSOR_THROTTLE], &Plant_EcuSensorRaw[PLANT_SENSOR_SPEED],
+                   &Plant_EcuSensorRaw[PLANT_SENSOR_LOAD], &Plant_EcuSensorRaw[PLANT_SENSOR_TORQUE] }
+};
+
+/******************************************************************************
+ * @brief   Khởi tạo mô hình
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu cấu hình không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Plant_Init(const Plant_ConfigType* Config) {
+    if (Config == NULL || !(Config->VehicleMass > 0.0f) || !(Config->WheelRadius > 0.0f) ||
+        !(Config->StepTime > 0.0f) || Config->DriverProfile == NULL || Config->NoiseSeed == 0U) {
+        return E_NOT_OK;
+    }
+    for (uint8_t s = 0; s < PLANT_NUM_SENSORS; s++) {
+        if (Config->SensorCurve[s] == NULL || Intp_InitCurveF32(Config->SensorCurve[s]) != E_OK) {
+            return E_NOT_OK;
+        }
+    }
+    if (Intp_InitCurveF32(Config->DriverProfile) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    // Phiên bản ECU: xe đứng yên trên đường bằng, tải trọng theo cấu hình
+    Plant_EcuThrottle = 0.0f;
+    Plant_EcuMotorTorque = 0.0f;
+    Plant_EcuPayload = Config->DriverPayload;
+    Plant_EcuGrade = 0.0f;
+    Plant_EcuSpeed = 0.0f;
+    Plant_EcuAcceleration = 0.0f;
+    Plant_EcuNoiseState = Config->NoiseSeed;   // xorshift32 dừng ở 0
+    Plant_EcuStepCount = 0U;
+    Plant_CurrentConfig = Config;
+
+    // Hồ sơ lái lặp lại theo chu kỳ bằng điểm chia cuối của trục thời gian, làm tròn tới
+    // số bước nguyên để bộ đếm bước quay vòng mà không mất độ chính xác khi chạy lâu
+    const Intp_AxisF32Type* profileAxis = &Config->DriverProfile->Axis;
+    float profileSteps = profileAxis->Points[profileAxis->Count - 1U] / Config->StepTime + 0.5f;
+    Plant_EcuProfileSteps = (profileSteps >= 1.0f) ? (uint32_t)profileSteps : 1U;
+
+    // Nối các kênh ADC với cảm biến của mô hình ngay, trước lần đọc đầu tiên của ECU
+    Plant_UpdateSensors(Config, &Plant_Ecu);
+    for (uint8_t s = 0; s < PLANT_NUM_SENSORS; s++) {
+        Adc_SetSimulatedInput(Config->SensorChannel[s], Plant_EcuSensorRaw[s]);
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Tích phân một bước cố định cho toàn bộ các xe
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @param   Vehicles - Dữ liệu của nhóm xe
+ * @return  void
+ ******************************************************************************/
+void Plant_Step(const Plant_ConfigType* Config, Plant_VehicleArrayType* Vehicles) {
+    // Hằng số của bước, tính một lần cho cả nhóm
+    const float driveGain = Config->GearRatio * Config->DrivelineEfficiency / Config->WheelRadius;
+    const float drag = Config->DragCoefficient;
+    const float rolling = Config->RollingResistance;
+    const float massEmpty = Config->VehicleMass;
+    const float dt = Config->StepTime;
+
+    const float* restrict motorTorque = Vehicles->MotorTorque;
+    const float* restrict payload = Vehicles->Payload;
+    const float* restrict grade = Vehicles->Grade;
+    float* restrict speed = Vehicles->Speed;
+    float* restrict acceleration = Vehicles->Acceleration;
+
+    for (uint32_t i = 0; i < Vehicles->Count; i++) {
+        float mass = massEmpty + payload[i];
+        float v = speed[i];
+        float force = motorTorque[i] * driveGain                     // Lực kéo tại bánh xe
+                    - drag * v * v                                   // Cản gió
+                    - mass * PLANT_GRAVITY * (rolling + grade[i]);   // Cản lăn và độ dốc
+        float a = force / mass;
+        float next = v + a * dt;
+        next = (next > 0.0f) ? next : 0.0f;                          // Không lùi khi đứng yên
+        acceleration[i] = (next - v) / dt;
+        speed[i] = next;
+    }
+}
+
+/******************************************************************************
+ * @brief   Tạo giá trị ADC của các cảm biến cho toàn bộ các xe
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @param   Vehicles - Dữ liệu của nhóm xe
+ * @return  void
+ ******************************************************************************/
+void Plant_UpdateSensors(const Plant_ConfigType* Config, Plant_VehicleArrayType* Vehicles) {
+    // Nhiễu đều trong [-NoiseAmplitude, NoiseAmplitude] từ 24 bit cao của bộ sinh
+    const float noiseScale = 2.0f * Config->NoiseAmplitude / 16777216.0f;
+    const float noiseOffset = -Config->NoiseAmplitude + 0.5f;   // + 0.5 để làm tròn khi lượng tử hóa
+    float physical[INTP_BLOCK_CHUNK];
+    float raw[INTP_BLOCK_CHUNK];
+
+    for (uint32_t start = 0; start < Vehicles->Count; start += INTP_BLOCK_CHUNK) {
+        uint32_t n = Vehicles->Count - start;
+        n = (n < INTP_BLOCK_CHUNK) ? n : INTP_BLOCK_CHUNK;
+        uint32_t* restrict noiseState = &Vehicles->NoiseState[start];
+
+        for (uint8_t s = 0; s < PLANT_NUM_SENSORS; s++) {
+            // Giá trị vật lý của cảm biến theo đơn vị của nó
+            const float* source;
+            switch (s) {
+                case PLANT_SENSOR_THROTTLE: source = &Vehicles->Throttle[start]; break;
+                case PLANT_SENSOR_LOAD:     source = &Vehicles->Payload[start]; break;
+                case PLANT_SENSOR_TORQUE:   source = &Vehicles->MotorTorque[start]; break;
+                default:
+                    for (uint32_t j = 0; j < n; j++) {
+                        physical[j] = Vehicles->Speed[start + j] * 3.6f;   // m/s -> km/h
+                    }
+                    source = physical;
+                    break;
+            }
+
+            Intp_CacheType cache = { 0U };
+            Intp_CurveBlockF32(Config->SensorCurve[s], &cache, source, raw, n);
+
+            // Nhiễu (xorshift32 của từng xe) và lượng tử hóa về dải ADC
+            uint16_t* restrict out = &Vehicles->SensorRaw[s][start];
+            for (uint32_t j = 0; j < n; j++) {
+                uint32_t x = noiseState[j];
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                noiseState[j] = x;
+                float value = raw[j] + (float)(x >> 8) * noiseScale + noiseOffset;
+                value = (value > 0.0f) ? value : 0.0f;
+                value = (value < PLANT_ADC_MAX_VALUE) ? value : PLANT_ADC_MAX_VALUE;
+                out[j] = (uint16_t)value;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * @brief   Tính mô-men xoắn của động cơ từ dòng pha mô phỏng
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @return  float - Mô-men xoắn của động cơ (Nm)
+ ******************************************************************************/
+float Plant_GetMotorTorque(const Plant_ConfigType* Config) {
+    int32_t phase[3];
+    Adc_GetSimulatedPhaseCurrents(phase);
+
+    // Biến đổi Clarke (bất biến biên độ), dòng Q15 -> 1.0 = dòng ở mô-men tối đa
+    float alpha = (2.0f * (float)phase[0] - (float)phase[1] - (float)phase[2]) / (3.0f * 32768.0f);
+    float beta = ((float)phase[1] - (float)phase[2]) * (0.57735027f / 32768.0f);   // 1 / sqrt(3)
+    float current = sqrtf(alpha * alpha + beta * beta);
+    current = (current < 1.0f) ? current : 1.0f;   // Dòng tối đa của bộ nghịch lưu
+    return current * Config->MotorTorquePerCurrent;
+}
+
+/******************************************************************************
+ * @brief   Dữ liệu của phiên bản ECU (một xe)
+ *
+ * @param   void
+ * @return  const Plant_VehicleArrayType* - Con trỏ tới dữ liệu của phiên bản ECU
+ ******************************************************************************/
+const Plant_VehicleArrayType* Plant_GetEcuVehicle(void) {
+    return &Plant_Ecu;
+}
+
+/******************************************************************************
+ * @brief   Một bước của phiên bản ECU
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Plant_MainFunction(void) {
+    const Plant_ConfigType* config = Plant_CurrentConfig;
+    if (config == NULL) {
+        return;
+    }
+
+    // Bộ đếm bước quay vòng theo chu kỳ hồ sơ lái trước khi đổi sang float, nên thời gian
+    // không bị lượng tử hóa khi chạy lâu (float chỉ biểu diễn chính xác số nguyên tới 2^24)
+    float timeS = (float)Plant_EcuStepCount * config->StepTime;
+    if (++Plant_EcuStepCount >= Plant_EcuProfileSteps) {
+        Plant_EcuStepCount = 0U;
+    }
+
+    static Intp_CacheType profileCache;
+    Plant_EcuThrottle = Intp_CurveF32(config->DriverProfile, &profileCache, timeS);
+    Plant_EcuMotorTorque = Plant_GetMotorTorque(config);
+
+    Plant_Step(config, &Plant_Ecu);
+    Plant_UpdateSensors(config, &Plant_Ecu);
+
+    for (uint8_t s = 0; s < PLANT_NUM_SENSORS; s++) {
+        Adc_SetSimulatedInput(config->SensorChannel[s], Plant_EcuSensorRaw[s]);
+    }
+}
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * @file    Plant.h
+ * @brief   Header file cho mô hình xe (plant) dùng trong mô phỏng vòng kín
+ *
+ * @details Mô hình chuyển động dọc của xe và hệ truyền động: mô-men động cơ -> lực
+ *          kéo tại bánh xe -> gia tốc -> tốc độ, với lực cản gió, lực cản lăn, độ dốc
+ *          và khối lượng gồm cả tải trọng. Mô hình được tích phân với bước cố định và
+ *          tạo giá trị ADC của các cảm biến (bàn đạp ga, tốc độ, tải trọng, mô-men xoắn)
+ *          theo đặc tính của cảm biến thật, nên các mẫu ADC phản ánh đúng mô-men mà ECU
+ *          điều khiển thay vì giá trị ngẫu nhiên. Mô-men xoắn của động cơ được lấy từ
+ *          dòng pha mà mô phỏng điện trong Adc tạo ra từ duty PWM của vòng dòng điện.
+ *
+ *          Dữ liệu của các xe được tổ chức dạng structure-of-arrays: mỗi đại lượng là
+ *          một mảng liên tiếp, một lần gọi `Plant_Step` tính cho toàn bộ các xe trong
+ *          một vòng lặp không rẽ nhánh để trình biên dịch vector hóa (SIMD). ECU mô
+ *          phỏng dùng một phiên bản một xe qua `Plant_MainFunction`.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef PLANT_H
+#define PLANT_H
+
+#include "Std_Types.h"
+#include "Intp.h"
+
+/******************************************************************************
+ * @brief   Các hằng số của mô hình
+ ******************************************************************************/
+#define PLANT_STEP_MS        1U        /**< Bước tích phân của phiên bản ECU (ms) */
+#define PLANT_ADC_MAX_VALUE  1023.0f   /**< Giá trị ADC tối đa (10-bit) */
+#define PLANT_GRAVITY        9.81f     /**< Gia tốc trọng trường (m/s^2) */
+
+/******************************************************************************
+ * @brief   Các cảm biến do mô hình tạo ra
+ ******************************************************************************/
+typedef enum {
+    PLANT_SENSOR_THROTTLE = 0,   /**< Vị trí bàn đạp ga (0.0 - 1.0) */
+    PLANT_SENSOR_SPEED,          /**< Tốc độ xe (km/h) */
+    PLANT_SENSOR_LOAD,           /**< Tải trọng (kg) */
+    PLANT_SENSOR_TORQUE,         /**< Mô-men xoắn của động cơ (Nm) */
+    PLANT_NUM_SENSORS
+} Plant_SensorIdType;
+
+/******************************************************************************
+ * @brief   Cấu hình của mô hình
+ *
+ * @details Tham số vật lý dùng chung cho mọi xe trong một mảng; đặc tính cảm biến
+ *          là đường cong giá trị vật lý -> giá trị ADC thô (nghịch đảo của đường đặc
+ *          tính mà IoHwAb dùng).
+ ******************************************************************************/
+typedef struct {
+    float VehicleMass;           /**< Khối lượng xe không tải (kg) */
+    float WheelRadius;           /**< Bán kính bánh xe (m) */
+    float GearRatio;             /**< Tỉ số truyền động cơ -> bánh xe */
+    float DrivelineEfficiency;   /**< Hiệu suất hệ truyền động (0..1) */
+    float DragCoefficient;       /**< 0.5 * mật độ không khí * Cd * diện tích cản (kg/m) */
+    float RollingResistance;     /**< Hệ số cản lăn */
+    float StepTime;              /**< Bước tích phân (s) */
+    float NoiseAmplitude;        /**< Biên độ nhiễu đều của cảm biến (LSB) */
+    float MotorTorquePerCurrent; /**< Mô-men ứng với dòng Q15 bằng 1.0 (Nm) */
+    uint8_t SensorChannel[PLANT_NUM_SENSORS];            /**< Kênh ADC của từng cảm biến */
+    Intp_CurveF32Type* SensorCurve[PLANT_NUM_SENSORS];   /**< Giá trị vật lý -> ADC thô */
+    Intp_CurveF32Type* DriverProfile;                    /**< Bàn đạp ga theo thời gian (s) của phiên bản ECU */
+    float DriverPayload;         /**< Tải trọng của phiên bản ECU (kg) */
+    uint32_t NoiseSeed;          /**< Giá trị khởi đầu của bộ sinh nhiễu của phiên bản ECU, khác 0 */
+} Plant_ConfigType;
+
+/******************************************************************************
+ * @brief   Dữ liệu của một nhóm xe dạng structure-of-arrays
+ *
+ * @details Mọi mảng có `Count` phần tử và do nơi gọi cấp phát. Đầu vào được ghi
+ *          trước mỗi bước, trạng thái được `Plant_Step` cập nhật, giá trị ADC được
+ *          `Plant_UpdateSensors` ghi.
+ ******************************************************************************/
+typedef struct {
+    uint32_t Count;                              /**< Số xe */
+    float* Throttle;                             /**< Đầu vào: vị trí bàn đạp ga của người lái (0..1) */
+    float* MotorTorque;                          /**< Đầu vào: mô-men xoắn của động cơ (Nm) */
+    float* Payload;                              /**< Đầu vào: tải trọng (kg) */
+    float* Grade;                                /**< Đầu vào: độ dốc (sin của góc dốc, dương khi lên dốc) */
+    float* Speed;                                /**< Trạng thái: tốc độ xe (m/s), không âm */
+    float* Acceleration;                         /**< Đầu ra: gia tốc của bước vừa tính (m/s^2) */
+    uint32_t* NoiseState;                        /**< Trạng thái bộ sinh nhiễu của từng xe, khác 0 */
+    uint16_t* SensorRaw[PLANT_NUM_SENSORS];      /**< Đầu ra: giá trị ADC thô của từng cảm biến */
+} Plant_VehicleArrayType;
+
+/******************************************************************************
+ * @brief   Cấu hình mặc định của mô hình (Plant_Cfg.c)
+ ******************************************************************************/
+extern const Plant_ConfigType Plant_Config;
+
+/******************************************************************************
+ * @brief   Khởi tạo mô hình
+ *
+ * @details Kiểm tra tham số và tính sẵn các đường đặc tính cảm biến. Phiên bản ECU
+ *          bắt đầu đứng yên và được nối vào các kênh ADC mô phỏng.
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu cấu hình không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Plant_Init(const Plant_ConfigType* Config);
+
+/******************************************************************************
+ * @brief   Tích phân một bước cố định cho toàn bộ các xe
+ *
+ * @details Euler bán ẩn: gia tốc tính từ lực kéo và lực cản tại tốc độ hiện tại,
+ *          tốc độ mới được giới hạn không âm (xe không lùi khi lực kéo nhỏ hơn lực
+ *          cản lúc đứng yên).
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @param   Vehicles - Dữ liệu của nhóm xe
+ * @return  void
+ ******************************************************************************/
+void Plant_Step(const Plant_ConfigType* Config, Plant_VehicleArrayType* Vehicles);
+
+/******************************************************************************
+ * @brief   Tạo giá trị ADC của các cảm biến cho toàn bộ các xe
+ *
+ * @details Chuyển giá trị vật lý qua đường đặc tính cảm biến, cộng nhiễu đều (bộ
+ *          sinh riêng của từng xe, lặp lại được theo giá trị khởi đầu) rồi lượng tử
+ *          hóa về dải ADC 10-bit.
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @param   Vehicles - Dữ liệu của nhóm xe
+ * @return  void
+ ******************************************************************************/
+void Plant_UpdateSensors(const Plant_ConfigType* Config, Plant_VehicleArrayType* Vehicles);
+
+/******************************************************************************
+ * @brief   Tính mô-men xoắn của động cơ từ dòng pha mô phỏng
+ *
+ * @details Dòng pha do mô phỏng điện trong Adc tính từ duty của ba kênh PWM pha
+ *          (tải RL, có trễ). Biên độ vector dòng (biến đổi Clarke, không phụ thuộc
+ *          góc rotor) được đổi sang mô-men; vòng dòng điện giữ dòng trục d bằng 0
+ *          nên biên độ dòng là dòng trục q.
+ *
+ * @param   Config - Con trỏ tới cấu hình của mô hình
+ * @return  float - Mô-men xoắn của động cơ (Nm)
+ ******************************************************************************/
+float Plant_GetMotorTorque(const Plant_ConfigType* Config);
+
+/******************************************************************************
+ * @brief   Dữ liệu của phiên bản ECU (một xe)
+ *
+ * @details Dùng để đọc trạng thái của xe (mô-men xoắn thật của động cơ, tốc độ) khi
+ *          đánh giá vòng điều khiển; không ghi vào các mảng từ bên ngoài.
+ *
+ * @param   void
+ * @return  const Plant_VehicleArrayType* - Con trỏ tới dữ liệu của phiên bản ECU
+ ******************************************************************************/
+const Plant_VehicleArrayType* Plant_GetEcuVehicle(void);
+
+/******************************************************************************
+ * @brief   Một bước của phiên bản ECU
+ *
+ * @details Đọc bàn đạp ga theo hồ sơ lái, mô-men xoắn của động cơ, tích phân một bước
+ *          rồi ghi giá trị cảm biến vào các kênh ADC mô phỏng. Gọi mỗi PLANT_STEP_MS.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Plant_MainFunction(void);
+
+#endif /* PLANT_H */
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * @file    Plant_Cfg.c
+ * @brief   Bảng cấu hình của mô hình xe (plant)
+ *
+ * @details Tham số của một xe điện cỡ nhỏ, đặc tính của các cảm biến (nghịch đảo
+ *          của đường đặc tính trong `IoHwAb_AnalogSensor_Cfg.c` với dải đo hiệu chuẩn
+ *          mặc định) và hồ sơ lái của phiên bản ECU.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "Plant.h"
+
+/******************************************************************************
+ * @brief   Đặc tính của các cảm biến: giá trị vật lý -> giá trị ADC thô
+ *
+ * @details Bàn đạp ga phi tuyến theo đường đặc tính của IoHwAb; tốc độ, tải trọng
+ *          và mô-men xoắn tuyến tính trên dải đo 200 km/h, 1000 kg, 500 Nm.
+ ******************************************************************************/
+#define PLANT_THROTTLE_CURVE_POINTS 5U
+#define PLANT_LINEAR_CURVE_POINTS   2U
+
+static const float Plant_ThrottlePosition[PLANT_THROTTLE_CURVE_POINTS] = { 0.0f, 0.15f, 0.40f, 0.70f, 1.0f };
+static const float Plant_ThrottleRaw[PLANT_THROTTLE_CURVE_POINTS] = { 0.0f, 256.0f, 512.0f, 768.0f, 1023.0f };
+static float Plant_ThrottleInvDelta[PLANT_THROTTLE_CURVE_POINTS - 1U];
+static Intp_CurveF32Type Plant_ThrottleCurve = {
+    .Axis = { Plant_ThrottlePosition, Plant_ThrottleInvDelta, PLANT_THROTTLE_CURVE_POINTS },
+    .Values = Plant_ThrottleRaw
+};
+
+static const float Plant_LinearRaw[PLANT_LINEAR_CURVE_POINTS] = { 0.0f, 1023.0f };
+
+static const float Plant_SpeedRange[PLANT_LINEAR_CURVE_POINTS] = { 0.0f, 200.0f };     // km/h
+static float Plant_SpeedInvDelta[PLANT_LINEAR_CURVE_POINTS - 1U];
+static Intp_CurveF32Type Plant_SpeedCurve = {
+    .Axis = { Plant_SpeedRange, Plant_SpeedInvDelta, PLANT_LINEAR_CURVE_POINTS },
+    .Values = Plant_LinearRaw
+};
+
+static const float Plant_LoadRange[PLANT_LINEAR_CURVE_POINTS] = { 0.0f, 1000.0f };     // kg
+static float Plant_LoadInvDelta[PLANT_LINEAR_CURVE_POINTS - 1U];
+static Intp_CurveF32Type Plant_LoadCurve = {
+    .Axis = { Plant_LoadRange, Plant_LoadInvDelta, PLANT_LINEAR_CURVE_POINTS },
+    .Values = Plant_LinearRaw
+};
+
+static const float Plant_TorqueRange[PLANT_LINEAR_CURVE_POINTS] = { 0.0f, 500.0f };    // Nm
+static float Plant_TorqueInvDelta[PLANT_LINEAR_CURVE_POINTS - 1U];
+static Intp_CurveF32Type Plant_TorqueCurve = {
+    .Axis = { Plant_TorqueRange, Plant_TorqueInvDelta, PLANT_LINEAR_CURVE_POINTS },
+    .Values = Plant_LinearRaw
+};
+
+/******************************************************************************
+ * @brief   Hồ sơ lái của phiên bản ECU
+ *
+ * @details Vị trí bàn đạp ga theo thời gian (s): tăng tốc, giữ ga, nhả ga rồi tăng
+ *          tốc mạnh. Hồ sơ lặp lại sau điểm chia cuối.
+ ******************************************************************************/
+#define PLANT_DRIVER_PROFILE_POINTS 8U
+
+static const float Plant_DriverTime[PLANT_DRIVER_PROFILE_POINTS] = {
+    0.0f, 1.0f, 6.0f, 8.0f, 12.0f, 13.0f, 18.0f, 20.0f
+};
+static const float Plant_DriverThrottle[PLANT_DRIVER_PROFILE_POINTS] = {
+    0.0f, 0.5f, 0.5f, 0.25f, 0.25f, 0.9f, 0.9f, 0.0f
+};
+static float Plant_DriverInvDelta[PLANT_DRIVER_PROFILE_POINTS - 1U];
+static Intp_CurveF32Type Plant_DriverCurve = {
+    .Axis = { Plant_DriverTime, Plant_DriverInvDelta, PLANT_DRIVER_PROFILE_POINTS },
+    .Values = Plant_DriverThrottle
+};
+
+/******************************************************************************
+ * @brief   Cấu hình mặc định của mô hình
+ ******************************************************************************/
+const Plant_ConfigType Plant_Config = {
+    .VehicleMass = 1200.0f,
+    .WheelRadius = 0.3f,
+    .GearRatio = 9.0f,
+    .DrivelineEfficiency = 0.92f,
+    .DragCoefficient = 0.4f,             // 0.5 * 1.2 kg/m^3 * Cd 0.3 * 2.2 m^2
+    .RollingResistance = 0.012f,
+    .StepTime = (float)PLANT_STEP_MS / 1000.0f,
+    .NoiseAmplitude = 2.0f,
+    .MotorTorquePerCurrent = 300.0f,     // Mô-men tối đa của động cơ (Rte_MotorDriverConfig)
+    .SensorChannel = { 0U, 1U, 2U, 3U }, // Như IoHwAb_AnalogSensorConfig
+    .SensorCurve = { &Plant_ThrottleCurve, &Plant_SpeedCurve, &Plant_LoadCurve, &Plant_TorqueCurve },
+    .DriverProfile = &Plant_DriverCurve,
+    .DriverPayload = 400.0f,
+    .NoiseSeed = 0x12345678U
+};
@@ -2,7 +2,8 @@
  * @file    Pwm.c
  * @brief   Triển khai các API cho giao diện PWM (Pulse Width Modulation)
  *
- * @details File này chứa các hàm khởi tạo và điều chỉnh tỷ lệ nhiệm vụ cho kênh PWM.
+ * @details File này chứa các hàm khởi tạo và điều chỉnh tỷ lệ nhiệm vụ cho kênh PWM
+ *          (chu kỳ và duty tính bằng tick của timer).
  *          Các hàm mô phỏng việc khởi tạo cấu hình PWM, bao gồm thiết lập kênh, 
  *          chu kỳ, và tỷ lệ nhiệm vụ (duty cycle), cùng với việc điều chỉnh duty cycle 
  *          của kênh PWM đã khởi tạo. Mục đích của file này là để hỗ trợ kiểm thử và 
@@ -15,14 +16,25 @@
  *          Tong Xuan Hoang
  ******************************************************************************/
 #include "Pwm.h"
-#include <stdio.h>
+#include "Dlt.h"   // Log bất đồng bộ
+#include <stddef.h>
+
+/******************************************************************************
+ * @brief   Thanh ghi mô phỏng của các kênh PWM
+ *
+ * @details Chu kỳ và giá trị so sánh hiện tại của từng kênh. Các kênh pha của
+ *          động cơ được ghi từ luồng điều khiển dòng điện và được đọc lại bởi
+ *          mô phỏng cảm biến dòng trong Adc.
+ ******************************************************************************/
+static volatile uint16_t Pwm_Period[PWM_MAX_CHANNELS];
+static volatile uint16_t Pwm_Duty[PWM_MAX_CHANNELS];
 
 /******************************************************************************
  * @brief   Khởi tạo kênh PWM với cấu hình
  *
  * @details Hàm này nhận vào một cấu trúc cấu hình `Pwm_ConfigType` và thực hiện
  *          khởi tạo kênh PWM theo các thông số trong cấu hình đó. Cấu hình bao gồm
- *          kênh PWM, chu kỳ và tỷ lệ nhiệm vụ (duty cycle). Sau khi khởi tạo, 
+ *          kênh PWM, chu kỳ và giá trị so sánh ban đầu (tick). Sau khi khởi tạo, 
  *          hàm in ra thông tin cấu hình của kênh PWM để xác nhận rằng PWM đã được
  *          khởi tạo với thông số mong muốn.
  *
@@ -30,22 +42,70 @@
  * @return  void
  ******************************************************************************/
 void Pwm_Init(const Pwm_ConfigType* ConfigPtr) {
-    printf("PWM Initialized for Channel %d with Period %d ms and Duty Cycle %d%%\n", 
-           ConfigPtr->Pwm_Channel, ConfigPtr->Pwm_Period, ConfigPtr->Pwm_DutyCycle);
+    if (ConfigPtr->Pwm_Channel < PWM_MAX_CHANNELS) {
+        Pwm_Period[ConfigPtr->Pwm_Channel] = ConfigPtr->Pwm_Period;
+        Pwm_Duty[ConfigPtr->Pwm_Channel] = ConfigPtr->Pwm_DutyCycle;
+    }
+    DLT_LOG_INFO(DLT_MSG_PWM_INIT, DLT_U32(ConfigPtr->Pwm_Channel), DLT_U32(ConfigPtr->Pwm_Period),
+                 DLT_U32(ConfigPtr->Pwm_DutyCycle));
 }
 
 /******************************************************************************
  * @brief   Cài đặt tỷ lệ nhiệm vụ (duty cycle) cho kênh PWM
  *
  * @details Hàm này cho phép điều chỉnh tỷ lệ nhiệm vụ (duty cycle) của một kênh PWM cụ thể.
- *          Giá trị `DutyCycle` được cung cấp trong tham số sẽ xác định tỷ lệ phần trăm 
- *          của chu kỳ mà kênh PWM này sẽ ở mức cao. Sau khi cài đặt, hàm in ra thông tin 
- *          của kênh PWM cùng với tỷ lệ nhiệm vụ mới để xác nhận thay đổi.
+ *          Giá trị `DutyCycle` là giá trị so sánh (tick): kênh ở mức cao trong
+ *          DutyCycle tick của mỗi chu kỳ. Giá trị lớn hơn chu kỳ được giới hạn về chu
+ *          kỳ. Sau khi cài đặt, hàm log giá trị so sánh mới để xác nhận thay đổi.
  *
  * @param   Channel - Kênh PWM cần cài đặt tỷ lệ nhiệm vụ
- * @param   DutyCycle - Tỷ lệ nhiệm vụ mới cho kênh PWM (tính bằng phần trăm)
+ * @param   DutyCycle - Giá trị so sánh mới cho kênh PWM (tick, trong [0, chu kỳ])
  * @return  void
  ******************************************************************************/
 void Pwm_SetDutyCycle(uint8_t Channel, uint16_t DutyCycle) {
-    printf("PWM Channel %d set to Duty Cycle: %d%%\n", Channel, DutyCycle);
+    if (Channel >= PWM_MAX_CHANNELS) {
+        return;
+    }
+    if (DutyCycle > Pwm_Period[Channel]) {
+        DutyCycle = Pwm_Period[Channel];
+    }
+    Pwm_Duty[Channel] = DutyCycle;
+    DLT_LOG_DEBUG(DLT_MSG_PWM_SET_DUTY, DLT_U32(Channel), DLT_U32(DutyCycle));
+}
+
+/******************************************************************************
+ * @brief   Cài đặt đồng thời duty cho ba kênh PWM của cầu nghịch lưu 3 pha
+ *
+ * @details Ghi giá trị so sánh của ba kênh liên tiếp. Trên phần cứng ba thanh ghi
+ *          được nạp cùng lúc ở đầu chu kỳ PWM tiếp theo (preload). Không in ra màn
+ *          hình vì hàm được gọi ở tần số PWM.
+ *
+ * @param   Channel - Kênh PWM của pha A
+ * @param   Duty - Mảng 3 giá trị so sánh của pha A, B, C (tick)
+ * @return  void
+ ******************************************************************************/
+void Pwm_SetPhaseDutyCycles(uint8_t Channel, const uint16_t Duty[3]) {
+    if ((uint32_t)Channel + 3U > PWM_MAX_CHANNELS) {
+        return;
+    }
+    Pwm_Duty[Channel] = Duty[0];
+    Pwm_Duty[Channel + 1U] = Duty[1];
+    Pwm_Duty[Channel + 2U] = Duty[2];
+}
+
+/******************************************************************************
+ * @brief   Đọc lại chu kỳ và giá trị so sánh hiện tại của một kênh PWM
+ *
+ * @param   Channel - Kênh PWM
+ * @param   Duty - Con trỏ lưu trữ giá trị so sánh hiện tại
+ * @param   Period - Con trỏ lưu trữ chu kỳ của kênh
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu kênh không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Pwm_GetOutput(uint8_t Channel, uint16_t* Duty, uint16_t* Period) {
+    if (Channel >= PWM_MAX_CHANNELS || Duty == NULL || Period == NULL) {
+        return E_NOT_OK;
+    }
+    *Duty = Pwm_Duty[Channel];
+    *Period = Pwm_Period[Channel];
+    return E_OK;
 }
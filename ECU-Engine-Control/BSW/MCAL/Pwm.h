@@ -4,8 +4,9 @@
  *
  * @details File này định nghĩa các cấu trúc và API cần thiết để khởi tạo và điều chỉnh
  *          kênh PWM. API cung cấp khả năng thiết lập cấu hình PWM, bao gồm kênh, chu kỳ,
- *          và tỷ lệ nhiệm vụ (duty cycle). Tỷ lệ nhiệm vụ có thể được thay đổi bằng cách
- *          sử dụng hàm `Pwm_SetDutyCycle` để điều chỉnh đầu ra PWM theo nhu cầu của ứng dụng.
+ *          và duty cycle. Chu kỳ và duty đều tính bằng tick của timer: duty là giá trị
+ *          so sánh trong [0, chu kỳ], tỷ lệ nhiệm vụ là duty / chu kỳ. Duty có thể được
+ *          thay đổi bằng `Pwm_SetDutyCycle` để điều chỉnh đầu ra PWM theo nhu cầu của ứng dụng.
  * 
  * @version 1.0
  * @date    2024-10-25
@@ -19,6 +20,11 @@
 
 #include "Std_Types.h"
 
+/******************************************************************************
+ * @brief   Số kênh PWM của bộ timer
+ ******************************************************************************/
+#define PWM_MAX_CHANNELS 8U
+
 /******************************************************************************
  * @brief   Cấu trúc cấu hình cho PWM
  *
@@ -27,8 +33,8 @@
  ******************************************************************************/
 typedef struct {
     uint8_t Pwm_Channel;       /**< Kênh PWM */
-    uint16_t Pwm_Period;       /**< Chu kỳ PWM */
-    uint16_t Pwm_DutyCycle;    /**< Tỷ lệ nhiệm vụ (duty cycle) của PWM */
+    uint16_t Pwm_Period;       /**< Chu kỳ PWM (tick) */
+    uint16_t Pwm_DutyCycle;    /**< Giá trị so sánh ban đầu (tick, trong [0, Pwm_Period]) */
 } Pwm_ConfigType;
 
 /******************************************************************************
@@ -47,13 +53,36 @@ void Pwm_Init(const Pwm_ConfigType* ConfigPtr);
  * @brief   Cài đặt tỷ lệ nhiệm vụ (duty cycle) cho kênh PWM
  *
  * @details Hàm này cho phép điều chỉnh tỷ lệ nhiệm vụ của một kênh PWM cụ thể.
- *          Tham số `DutyCycle` được sử dụng để thiết lập phần trăm tỷ lệ nhiệm vụ,
- *          thay đổi đầu ra PWM theo yêu cầu của ứng dụng.
+ *          Tham số `DutyCycle` là giá trị so sánh mới (tick); tỷ lệ nhiệm vụ bằng
+ *          DutyCycle / chu kỳ của kênh.
  *
  * @param   Channel - Kênh PWM cần cài đặt tỷ lệ nhiệm vụ
- * @param   DutyCycle - Tỷ lệ nhiệm vụ mới cho kênh PWM (tính bằng phần trăm)
+ * @param   DutyCycle - Giá trị so sánh mới cho kênh PWM (tick, trong [0, chu kỳ])
  * @return  void
  ******************************************************************************/
 void Pwm_SetDutyCycle(uint8_t Channel, uint16_t DutyCycle);
 
+/******************************************************************************
+ * @brief   Cài đặt đồng thời duty cho ba kênh PWM của cầu nghịch lưu 3 pha
+ *
+ * @details Ghi giá trị so sánh (tính bằng tick, trong [0, Period]) cho ba kênh liên
+ *          tiếp bắt đầu từ `Channel`. Hàm chỉ ghi thanh ghi, không in ra màn hình,
+ *          để gọi được ở tần số PWM (10 - 20 kHz) từ vòng điều khiển dòng điện.
+ *
+ * @param   Channel - Kênh PWM của pha A (pha B, C là Channel + 1, Channel + 2)
+ * @param   Duty - Mảng 3 giá trị so sánh của pha A, B, C (tick)
+ * @return  void
+ ******************************************************************************/
+void Pwm_SetPhaseDutyCycles(uint8_t Channel, const uint16_t Duty[3]);
+
+/******************************************************************************
+ * @brief   Đọc lại chu kỳ và giá trị so sánh hiện tại của một kênh PWM
+ *
+ * @param   Channel - Kênh PWM
+ * @param   Duty - Con trỏ lưu trữ giá trị so sánh hiện tại
+ * @param   Period - Con trỏ lưu trữ chu kỳ của kênh
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu kênh không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Pwm_GetOutput(uint8_t Channel, uint16_t* Duty, uint16_t* Period);
+
 #endif /* PWM_H */
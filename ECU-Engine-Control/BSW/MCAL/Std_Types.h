@@ -68,3 +68,14 @@ typedef uint8_t Std_ReturnType;
  *          con trỏ không trỏ đến bất kỳ đối tượng hợp lệ nào trong bộ nhớ.
  ******************************************************************************/
 #define NULL_PTR    ((void*)0)
+
+/* Standard On/Off */
+/******************************************************************************
+ * @brief   Giá trị bật/tắt cho các tùy chọn cấu hình lúc biên dịch
+ * @details STD_ON và STD_OFF được dùng trong các file cấu hình để bật hoặc tắt
+ *          một tính năng, ví dụ `#if (IOHWAB_FIXED_POINT == STD_ON)`.
+ ******************************************************************************/
+#define STD_ON      1U
+#define STD_OFF     0U
+
+#endif /* STD_TYPES_H */
@@ -1,51 +1,1097 @@
 #include "Dcm.h"
 #include "Dem.h"  // Sử dụng Dem để xử lý chẩn đoán lỗi
+#include "Rte_TorqueControl.h"  // DataServices cung cấp dữ liệu cho các DID
+#include "Can.h"                // Gửi khung periodic DID qua CAN
+#include "Os.h"                 // Đồng hồ hệ thống và delay cho task DCM
+#include <stdlib.h>
+
+// Mặt nạ dùng để sinh key từ seed trong SecurityAccess
+#define DCM_SECURITY_KEY_MASK 0x5A3CC3A5UL
+
+// Trạng thái nội bộ của DCM
+static uint8_t Dcm_ActiveSession = DCM_DEFAULT_SESSION;
+static uint8_t Dcm_SecurityLevel = DCM_SEC_LEVEL_LOCKED;
+static uint32_t Dcm_SecuritySeed = 0;
+static uint8_t Dcm_SeedRequested = 0;
+static uint8_t Dcm_FailedAttempts = 0;
+static uint8_t Dcm_SecurityDelayActive = 0;     // 1 khi đang trong thời gian khóa SecurityAccess
+static uint32_t Dcm_SecurityDelayStartMs = 0;   // Thời điểm bắt đầu khóa
+static int Dcm_DtcReportIndex = 0;  // Vị trí DTC kế tiếp khi ReadDTCInformation đang pending
+// Bản chụp DTC lúc bắt đầu ReadDTCInformation: sự kiện được báo hoặc xóa giữa các lần pending
+// không làm lệch hay lặp DTC trong phản hồi
+static uint32_t Dcm_DtcSnapshot[MAX_DIAGNOSTIC_EVENTS];
+static uint8_t Dcm_DtcSnapshotStatus[MAX_DIAGNOSTIC_EVENTS];
+static int Dcm_DtcSnapshotCount = 0;
+
+static Std_ReturnType Dcm_DiagnosticSessionControl(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_EcuReset(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_ClearDiagnosticInformation(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_ReadDtcInformation(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_ReadDataByIdentifier(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_ReadDataByPeriodicIdentifier(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_SecurityAccess(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_TesterPresent(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_RequestDownload(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_TransferData(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+static Std_ReturnType Dcm_RequestTransferExit(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+
+// Bảng cấu hình dịch vụ: SID -> hàm xử lý, phiên và mức bảo mật yêu cầu
+static const Dcm_ServiceConfigType Dcm_ServiceTable[] = {
+    /* sid,                        minLen, subFunc, sessionMask,                         securityLevel,        handler */
+    { DIAGNOSTIC_SESSION_CONTROL,  2,      1,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_DiagnosticSessionControl },
+    { ECU_RESET,                   2,      1,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_EcuReset },
+    { CLEAR_DTC,                   4,      0,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_ClearDiagnosticInformation },
+    { READ_DTC,                    2,      1,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_ReadDtcInformation },
+    { READ_DATA_BY_IDENTIFIER,     3,      0,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_ReadDataByIdentifier },
+    { READ_DATA_BY_PERIODIC_IDENTIFIER, 2, 0,   DCM_SES_EXTENDED,                    DCM_SEC_LEVEL_LOCKED, Dcm_ReadDataByPeriodicIdentifier },  // 2A 04: dừng tất cả
+    { SECURITY_ACCESS,             2,      1,       DCM_SES_PROGRAMMING | DCM_SES_EXTENDED, DCM_SEC_LEVEL_LOCKED, Dcm_SecurityAccess },
+    { TESTER_PRESENT,              2,      1,       DCM_SES_ALL,                         DCM_SEC_LEVEL_LOCKED, Dcm_TesterPresent },
+    { REQUEST_DOWNLOAD,            5,      0,       DCM_SES_PROGRAMMING,                 DCM_SEC_LEVEL_1,      Dcm_RequestDownload },
+    { TRANSFER_DATA,               2,      0,       DCM_SES_PROGRAMMING,                 DCM_SEC_LEVEL_1,      Dcm_TransferData },
+    { REQUEST_TRANSFER_EXIT,       1,      0,       DCM_SES_PROGRAMMING,                 DCM_SEC_LEVEL_1,      Dcm_RequestTransferExit },
+};
+
+#define DCM_NUM_SERVICES (sizeof(Dcm_ServiceTable) / sizeof(Dcm_ServiceTable[0]))
+
+// Bảng DID, sắp xếp tăng dần theo mã DID để tra cứu nhị phân
+static const Dcm_DidConfigType Dcm_DidTable[] = {
+    /* did,                       length, factor,  readData */
+    { DCM_DID_THROTTLE_POSITION,  2,      1000.0f, Rte_Call_DataServices_ThrottlePosition_ReadData },
+    { DCM_DID_VEHICLE_SPEED,      2,      100.0f,  Rte_Call_DataServices_VehicleSpeed_ReadData },
+    { DCM_DID_LOAD_WEIGHT,        2,      10.0f,   Rte_Call_DataServices_LoadWeight_ReadData },
+    { DCM_DID_ACTUAL_TORQUE,      2,      10.0f,   Rte_Call_DataServices_ActualTorque_ReadData },
+    { DCM_DID_DESIRED_TORQUE,     2,      10.0f,   Rte_Call_DataServices_DesiredTorque_ReadData },
+    { DCM_DID_TORQUE_COMMAND,     2,      10.0f,   Rte_Call_DataServices_TorqueCommand_ReadData },
+};
+
+#define DCM_NUM_DIDS (sizeof(Dcm_DidTable) / sizeof(Dcm_DidTable[0]))
+
+// Một khe truyền periodic đã được tính sẵn: DID nguồn và phần đầu khung CAN
+typedef struct {
+    const Dcm_DidConfigType* didConfig; // DID cung cấp dữ liệu
+    uint8_t pdid;                       // Byte thấp của periodic DID (byte đầu khung)
+    uint8_t frameLength;                // Độ dài khung CAN = 1 + độ dài dữ liệu DID
+} Dcm_PeriodicSlotType;
+
+// Danh sách dày đặc các khe đang hoạt động của một tốc độ truyền
+typedef struct {
+    Dcm_PeriodicSlotType slots[DCM_PDID_MAX_SCHEDULED];
+    uint8_t count;        // Số khe đang hoạt động
+    uint16_t periodTicks; // Chu kỳ truyền tính theo số lần gọi Dcm_MainFunction
+    uint16_t countdown;   // Số tick còn lại đến lần truyền tiếp theo
+} Dcm_PeriodicRateType;
+
+// Lịch truyền của ba tốc độ: chậm, trung bình, nhanh (chỉ số = transmissionMode - 1)
+static Dcm_PeriodicRateType Dcm_PeriodicRates[3];
+// Vị trí của từng pDID trong lịch: tốc độ (0: không hoạt động) và chỉ số khe
+static uint8_t Dcm_PeriodicRateOf[256];
+static uint8_t Dcm_PeriodicSlotOf[256];
+static uint8_t Dcm_PeriodicScheduledCount = 0;
+
+// Bảng tra SID -> vị trí trong Dcm_ServiceTable (0: không hỗ trợ), dựng lúc khởi tạo
+static uint8_t Dcm_ServiceIndex[256];
+
+// Yêu cầu đang được xử lý cùng ngữ cảnh của nó
+typedef struct {
+    const Dcm_ServiceConfigType* service;
+    Dcm_MsgContextType msgContext;
+    uint8_t sid;
+    uint8_t* response;  // Bộ đệm phản hồi đầy đủ (bắt đầu từ SID phản hồi)
+} Dcm_ActiveRequestType;
+
+// Một phần tử trong hàng đợi yêu cầu
+typedef struct {
+    uint8_t data[DCM_MAX_REQUEST_LENGTH];
+    uint16_t length;
+    uint32_t rxTimeMs;  // Thời điểm nhận yêu cầu, mốc tính P2
+} Dcm_QueuedRequestType;
+
+// Hàng đợi vòng có giới hạn giữa bên gửi yêu cầu và task DCM
+static Dcm_QueuedRequestType Dcm_RequestQueue[DCM_REQUEST_QUEUE_LENGTH];
+static uint8_t Dcm_QueueHead = 0;
+static uint8_t Dcm_QueueTail = 0;
+static uint8_t Dcm_QueueCount = 0;
+static pthread_mutex_t Dcm_QueueLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Dcm_QueueCond;
+static volatile uint8_t Dcm_TaskRunning = 0;
+
+// Trạng thái của task DCM (chỉ được truy cập trong task DCM)
+static uint8_t Dcm_RxBuffer[DCM_MAX_REQUEST_LENGTH];
+static uint16_t Dcm_RxLength = 0;
+static uint32_t Dcm_RxTimeMs = 0;
+static uint8_t Dcm_TxBuffer[DCM_MAX_RESPONSE_LENGTH];
+static Dcm_ActiveRequestType Dcm_ActiveRequest;
+static uint8_t Dcm_RequestActive = 0;
+static uint8_t Dcm_PendingCount = 0;
+static uint32_t Dcm_PendingDeadlineMs = 0;
+static Dcm_ResponseCallbackType Dcm_ResponseCallback = NULL;
+
+static void Dcm_PeriodicStopAll(void);
+static void Dcm_DownloadAbort(void);
+static Std_ReturnType Dcm_CallHandler(Dcm_ActiveRequestType* active, Dcm_OpStatusType opStatus,
+                                      uint16_t* responseLength);
 
 // Khởi tạo hệ thống DCM
 void Dcm_Init(void) {
+    memset(Dcm_ServiceIndex, 0, sizeof(Dcm_ServiceIndex));
+    for (uint8_t i = 0; i < DCM_NUM_SERVICES; i++) {
+        Dcm_ServiceIndex[Dcm_ServiceTable[i].sid] = (uint8_t)(i + 1);
+    }
+
+    Dcm_ActiveSession = DCM_DEFAULT_SESSION;
+    Dcm_SecurityLevel = DCM_SEC_LEVEL_LOCKED;
+    Dcm_SeedRequested = 0;
+    Dcm_FailedAttempts = 0;
+    Dcm_SecurityDelayActive = 0;
+
+    // Tính sẵn chu kỳ truyền (theo tick) cho từng tốc độ
+    static const uint16_t ratePeriodMs[3] = { DCM_PDID_SLOW_RATE_MS, DCM_PDID_MEDIUM_RATE_MS, DCM_PDID_FAST_RATE_MS };
+    for (uint8_t i = 0; i < 3; i++) {
+        uint16_t ticks = (uint16_t)(ratePeriodMs[i] / DCM_MAIN_FUNCTION_PERIOD_MS);
+        Dcm_PeriodicRates[i].periodTicks = (ticks == 0) ? 1 : ticks;
+    }
+    Dcm_PeriodicStopAll();
+    Dcm_DownloadAbort();
+
+    // Hàng đợi yêu cầu dùng đồng hồ đơn điệu cho thời gian chờ
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&Dcm_QueueCond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+    Dcm_QueueHead = 0;
+    Dcm_QueueTail = 0;
+    Dcm_QueueCount = 0;
+    Dcm_RequestActive = 0;
+    Dcm_TaskRunning = 1;
+
     printf("Diagnostic Communication Manager (DCM) Initialized.\n");
 }
 
-// Xử lý yêu cầu chẩn đoán từ thiết bị kiểm tra
-void Dcm_ProcessRequest(Dcm_MessageType* request) {
-    printf("Received diagnostic request. Service ID: 0x%x\n", request->service_id);
-    
-    switch (request->service_id) {
-        case DIAGNOSTIC_SESSION_CONTROL:
-            printf("Processing Diagnostic Session Control...\n");
-            Dcm_SendResponse(request->service_id, "Session Control Acknowledged");
-            break;
+// Ghi phản hồi âm 0x7F SID NRC
+static uint16_t Dcm_EncodeNegativeResponse(uint8_t sid, Dcm_NegativeResponseCodeType nrc, uint8_t* response) {
+    response[0] = DCM_NEGATIVE_RESPONSE_SID;
+    response[1] = sid;
+    response[2] = nrc;
+    return DCM_NEGATIVE_RESPONSE_LENGTH;
+}
 
-        case ECU_RESET:
-            printf("Processing ECU Reset...\n");
-            Dcm_SendResponse(request->service_id, "ECU Reset Acknowledged");
-            // Giả lập reset ECU
-            break;
+// Bắt đầu xử lý một yêu cầu: kiểm tra SID, phiên, bảo mật, độ dài rồi gọi hàm xử lý lần đầu.
+// Trả về DCM_E_PENDING nếu hàm xử lý cần được gọi lại, ngược lại responseLength đã được ghi
+static Std_ReturnType Dcm_StartRequest(Dcm_ActiveRequestType* active,
+                                       const uint8_t* request, uint16_t requestLength,
+                                       uint8_t* response, uint16_t responseMaxLength,
+                                       uint16_t* responseLength) {
+    uint8_t sid = request[0];
+    uint8_t index = Dcm_ServiceIndex[sid];
+
+    active->sid = sid;
+    active->response = response;
+    if (index == 0) {
+        *responseLength = Dcm_EncodeNegativeResponse(sid, DCM_E_SERVICENOTSUPPORTED, response);
+        return E_OK;
+    }
+
+    const Dcm_ServiceConfigType* service = &Dcm_ServiceTable[index - 1];
+    if ((service->sessionMask & DCM_SESSION_MASK(Dcm_ActiveSession)) == 0) {
+        *responseLength = Dcm_EncodeNegativeResponse(sid, DCM_E_SERVICENOTSUPPORTEDINACTIVESESSION, response);
+        return E_OK;
+    }
+    if (Dcm_SecurityLevel < service->securityLevel) {
+        *responseLength = Dcm_EncodeNegativeResponse(sid, DCM_E_SECURITYACCESSDENIED, response);
+        return E_OK;
+    }
+    if (requestLength < service->minReqLength) {
+        *responseLength = Dcm_EncodeNegativeResponse(sid, DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT, response);
+        return E_OK;
+    }
 
-        case READ_DTC:
-            printf("Processing Read DTC...\n");
-            Dcm_SendResponse(request->service_id, "Read DTC Acknowledged");
-            // Giả lập đọc mã DTC từ hệ thống DEM
-            Dem_PrintEventList();
+    Dcm_MsgContextType* msgContext = &active->msgContext;
+    active->service = service;
+    msgContext->reqData = &request[1];
+    msgContext->reqDataLen = (uint16_t)(requestLength - 1);
+    msgContext->subFunction = 0;
+    msgContext->suppressPosResponse = 0;
+    if (service->subFunctionAvail) {
+        msgContext->subFunction = request[1] & (uint8_t)~DCM_SUPPRESS_POS_RESPONSE_BIT;
+        msgContext->suppressPosResponse = (request[1] & DCM_SUPPRESS_POS_RESPONSE_BIT) ? 1 : 0;
+    }
+    msgContext->resData = &response[1];
+    msgContext->resDataLen = 0;
+    msgContext->resMaxDataLen = (uint16_t)(responseMaxLength - 1);
+
+    return Dcm_CallHandler(active, DCM_INITIAL, responseLength);
+}
+
+// Gọi hàm xử lý của yêu cầu đang hoạt động và mã hóa phản hồi khi hàm xử lý hoàn tất
+static Std_ReturnType Dcm_CallHandler(Dcm_ActiveRequestType* active, Dcm_OpStatusType opStatus,
+                                      uint16_t* responseLength) {
+    Dcm_NegativeResponseCodeType nrc = DCM_E_GENERALREJECT;
+    Std_ReturnType result = active->service->handler(opStatus, &active->msgContext, &nrc);
+
+    if (result == DCM_E_PENDING) {
+        return DCM_E_PENDING;
+    }
+    if (result != E_OK) {
+        *responseLength = Dcm_EncodeNegativeResponse(active->sid, nrc, active->response);
+        return E_OK;
+    }
+    if (active->msgContext.suppressPosResponse) {
+        *responseLength = 0;  // Phản hồi dương bị chặn theo yêu cầu của tester
+        return E_OK;
+    }
+
+    active->response[0] = (uint8_t)(active->sid + DCM_POSITIVE_RESPONSE_OFFSET);
+    *responseLength = (uint16_t)(active->msgContext.resDataLen + 1);
+    return E_OK;
+}
+
+// Xử lý đồng bộ yêu cầu chẩn đoán trong ngữ cảnh của caller
+Std_ReturnType Dcm_ProcessRequest(const uint8_t* request, uint16_t requestLength,
+                                  uint8_t* response, uint16_t responseMaxLength,
+                                  uint16_t* responseLength) {
+    if (request == NULL || response == NULL || responseLength == NULL ||
+        requestLength == 0 || responseMaxLength < DCM_NEGATIVE_RESPONSE_LENGTH) {
+        return E_NOT_OK;
+    }
+
+    Dcm_ActiveRequestType active;
+    Std_ReturnType result = Dcm_StartRequest(&active, request, requestLength, response,
+                                             responseMaxLength, responseLength);
+    while (result == DCM_E_PENDING) {
+        result = Dcm_CallHandler(&active, DCM_PENDING, responseLength);
+    }
+    return E_OK;
+}
+
+// Đưa một yêu cầu vào hàng đợi của task DCM
+Std_ReturnType Dcm_SubmitRequest(const uint8_t* request, uint16_t requestLength) {
+    if (request == NULL || requestLength == 0 || requestLength > DCM_MAX_REQUEST_LENGTH) {
+        return E_NOT_OK;
+    }
+
+    pthread_mutex_lock(&Dcm_QueueLock);
+    if (Dcm_QueueCount >= DCM_REQUEST_QUEUE_LENGTH) {
+        pthread_mutex_unlock(&Dcm_QueueLock);
+        return E_NOT_OK;  // Hàng đợi đầy, tester cần gửi lại sau
+    }
+
+    Dcm_QueuedRequestType* slot = &Dcm_RequestQueue[Dcm_QueueTail];
+    memcpy(slot->data, request, requestLength);
+    slot->length = requestLength;
+    slot->rxTimeMs = Os_GetTimeMs();  // P2 được tính từ lúc nhận yêu cầu
+    Dcm_QueueTail = (uint8_t)((Dcm_QueueTail + 1U) % DCM_REQUEST_QUEUE_LENGTH);
+    Dcm_QueueCount++;
+    pthread_cond_signal(&Dcm_QueueCond);
+    pthread_mutex_unlock(&Dcm_QueueLock);
+    return E_OK;
+}
+
+// Đăng ký hàm nhận phản hồi từ task DCM
+void Dcm_SetResponseCallback(Dcm_ResponseCallbackType callback) {
+    Dcm_ResponseCallback = callback;
+}
+
+// Gửi phản hồi ra ngoài qua hàm callback đã đăng ký
+static void Dcm_TransmitResponse(const uint8_t* response, uint16_t responseLength) {
+    if (responseLength > 0 && Dcm_ResponseCallback != NULL) {
+        Dcm_ResponseCallback(response, responseLength);
+    }
+}
+
+// Lấy yêu cầu kế tiếp trong hàng đợi, chờ tối đa đến thời điểm deadlineMs
+static Std_ReturnType Dcm_DequeueRequest(uint32_t deadlineMs) {
+    Std_ReturnType result = E_NOT_OK;
+
+    pthread_mutex_lock(&Dcm_QueueLock);
+    while (Dcm_QueueCount == 0 && Dcm_TaskRunning) {
+        int32_t remaining = (int32_t)(deadlineMs - Os_GetTimeMs());
+        if (remaining <= 0) {
             break;
+        }
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        ts.tv_sec += remaining / 1000;
+        ts.tv_nsec += (long)(remaining % 1000) * 1000000L;
+        if (ts.tv_nsec >= 1000000000L) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&Dcm_QueueCond, &Dcm_QueueLock, &ts);
+    }
 
-        case CLEAR_DTC:
-            printf("Processing Clear DTC...\n");
-            Dcm_SendResponse(request->service_id, "Clear DTC Acknowledged");
-            // Giả lập xóa các mã DTC từ hệ thống DEM
-            for (int i = 0; i < MAX_DIAGNOSTIC_EVENTS; i++) {
-                Dem_ClearErrorStatus(i);
+    if (Dcm_QueueCount > 0) {
+        Dcm_QueuedRequestType* slot = &Dcm_RequestQueue[Dcm_QueueHead];
+        memcpy(Dcm_RxBuffer, slot->data, slot->length);
+        Dcm_RxLength = slot->length;
+        Dcm_RxTimeMs = slot->rxTimeMs;
+        Dcm_QueueHead = (uint8_t)((Dcm_QueueHead + 1U) % DCM_REQUEST_QUEUE_LENGTH);
+        Dcm_QueueCount--;
+        result = E_OK;
+    }
+    pthread_mutex_unlock(&Dcm_QueueLock);
+    return result;
+}
+
+// Kiểm tra P2/P2* cho yêu cầu đang pending: gửi NRC 0x78 trước khi hết hạn,
+// hủy yêu cầu bằng NRC 0x10 khi đã gửi quá DCM_MAX_RESPONSE_PENDING lần
+static void Dcm_SupervisePendingRequest(void) {
+    uint32_t now = Os_GetTimeMs();
+    if ((int32_t)(now - Dcm_PendingDeadlineMs) < 0) {
+        return;
+    }
+
+    uint8_t pendingResponse[DCM_NEGATIVE_RESPONSE_LENGTH];
+    if (Dcm_PendingCount >= DCM_MAX_RESPONSE_PENDING) {
+        uint16_t length;
+        Dcm_CallHandler(&Dcm_ActiveRequest, DCM_CANCEL, &length);
+        Dcm_RequestActive = 0;
+        Dcm_TransmitResponse(pendingResponse,
+                             Dcm_EncodeNegativeResponse(Dcm_ActiveRequest.sid, DCM_E_GENERALREJECT, pendingResponse));
+        return;
+    }
+
+    Dcm_TransmitResponse(pendingResponse,
+                         Dcm_EncodeNegativeResponse(Dcm_ActiveRequest.sid,
+                                                    DCM_E_REQUESTCORRECTLYRECEIVEDRESPONSEPENDING,
+                                                    pendingResponse));
+    Dcm_PendingCount++;
+    Dcm_PendingDeadlineMs = now + DCM_P2STAR_SERVER_MAX_MS - DCM_RESPONSE_PENDING_MARGIN_MS;
+}
+
+// Task của DCM: xử lý tuần tự từng yêu cầu trong hàng đợi, gọi lại hàm xử lý pending
+// cho đến khi hoàn tất và chạy Dcm_MainFunction theo chu kỳ
+void* Dcm_Task(void* arg) {
+    (void)arg;
+    uint32_t nextMainFunctionMs = Os_GetTimeMs() + DCM_MAIN_FUNCTION_PERIOD_MS;
+
+    while (Dcm_TaskRunning) {
+        uint16_t responseLength = 0;
+
+        if (!Dcm_RequestActive) {
+            if (Dcm_DequeueRequest(nextMainFunctionMs) == E_OK) {
+                Std_ReturnType result = Dcm_StartRequest(&Dcm_ActiveRequest, Dcm_RxBuffer, Dcm_RxLength,
+                                                         Dcm_TxBuffer, sizeof(Dcm_TxBuffer), &responseLength);
+                if (result == DCM_E_PENDING) {
+                    Dcm_RequestActive = 1;
+                    Dcm_PendingCount = 0;
+                    Dcm_PendingDeadlineMs = Dcm_RxTimeMs + DCM_P2_SERVER_MAX_MS - DCM_RESPONSE_PENDING_MARGIN_MS;
+                    Dcm_SupervisePendingRequest();
+                } else {
+                    Dcm_TransmitResponse(Dcm_TxBuffer, responseLength);
+                }
             }
-            break;
+        } else {
+            Os_Delay(DCM_PENDING_POLL_PERIOD_MS);
+            if (Dcm_CallHandler(&Dcm_ActiveRequest, DCM_PENDING, &responseLength) == DCM_E_PENDING) {
+                Dcm_SupervisePendingRequest();
+            } else {
+                Dcm_RequestActive = 0;
+                Dcm_TransmitResponse(Dcm_TxBuffer, responseLength);
+            }
+        }
 
-        default:
-            printf("Unknown diagnostic service ID: 0x%x\n", request->service_id);
-            Dcm_SendResponse(request->service_id, "Unknown Service ID");
-            break;
+        uint32_t now = Os_GetTimeMs();
+        if ((int32_t)(now - nextMainFunctionMs) >= 0) {
+            Dcm_MainFunction();
+            nextMainFunctionMs += DCM_MAIN_FUNCTION_PERIOD_MS;
+            if ((int32_t)(now - nextMainFunctionMs) >= 0) {
+                nextMainFunctionMs = now + DCM_MAIN_FUNCTION_PERIOD_MS;  // Bỏ qua các chu kỳ bị trễ
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Yêu cầu task DCM kết thúc
+void Dcm_StopTask(void) {
+    pthread_mutex_lock(&Dcm_QueueLock);
+    Dcm_TaskRunning = 0;
+    pthread_cond_signal(&Dcm_QueueCond);
+    pthread_mutex_unlock(&Dcm_QueueLock);
+}
+
+// Lấy phiên chẩn đoán hiện tại
+uint8_t Dcm_GetActiveSession(void) {
+    return Dcm_ActiveSession;
+}
+
+// Lấy mức bảo mật hiện tại
+uint8_t Dcm_GetSecurityLevel(void) {
+    return Dcm_SecurityLevel;
+}
+
+// Kiểm tra bộ đệm phản hồi còn đủ chỗ cho length byte
+static Std_ReturnType Dcm_CheckResponseSpace(const Dcm_MsgContextType* pMsgContext, uint16_t length,
+                                             Dcm_NegativeResponseCodeType* ErrorCode) {
+    if ((uint32_t)pMsgContext->resDataLen + length > pMsgContext->resMaxDataLen) {
+        *ErrorCode = DCM_E_RESPONSETOOLONG;
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+// 0x10 DiagnosticSessionControl: chuyển phiên và trả về thông số P2/P2*
+static Std_ReturnType Dcm_DiagnosticSessionControl(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint8_t session = pMsgContext->subFunction;
+
+    if (pMsgContext->reqDataLen != 1) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+    if (session != DCM_DEFAULT_SESSION && session != DCM_PROGRAMMING_SESSION &&
+        session != DCM_EXTENDED_DIAGNOSTIC_SESSION) {
+        *ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+        return E_NOT_OK;
+    }
+    if (Dcm_CheckResponseSpace(pMsgContext, 5, ErrorCode) != E_OK) {
+        return E_NOT_OK;
     }
+
+    // Mỗi lần chuyển phiên, quyền bảo mật đã mở sẽ bị khóa lại, số lần gửi key sai được
+    // đếm lại (thời gian khóa đang chạy vẫn giữ nguyên) và việc truyền periodic DID dừng
+    // khi không còn ở phiên mở rộng
+    if (session != DCM_EXTENDED_DIAGNOSTIC_SESSION) {
+        Dcm_PeriodicStopAll();
+    }
+    Dcm_DownloadAbort();  // Quá trình nạp dở dang không được tiếp tục ở phiên mới
+    Dcm_ActiveSession = session;
+    Dcm_SecurityLevel = DCM_SEC_LEVEL_LOCKED;
+    Dcm_SeedRequested = 0;
+    Dcm_FailedAttempts = 0;
+
+    uint8_t* res = pMsgContext->resData;
+    uint16_t p2StarUnits = (uint16_t)(DCM_P2STAR_SERVER_MAX_MS / 10U);  // P2* tính theo đơn vị 10ms
+    res[0] = session;
+    res[1] = (uint8_t)(DCM_P2_SERVER_MAX_MS >> 8);
+    res[2] = (uint8_t)(DCM_P2_SERVER_MAX_MS & 0xFFU);
+    res[3] = (uint8_t)(p2StarUnits >> 8);
+    res[4] = (uint8_t)(p2StarUnits & 0xFFU);
+    pMsgContext->resDataLen = 5;
+    return E_OK;
+}
+
+// 0x11 ECUReset: giả lập reset bằng cách đưa DCM về phiên mặc định
+static Std_ReturnType Dcm_EcuReset(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint8_t resetType = pMsgContext->subFunction;
+
+    if (pMsgContext->reqDataLen != 1) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+    if (resetType < 0x01 || resetType > 0x03) {  // hardReset, keyOffOnReset, softReset
+        *ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+        return E_NOT_OK;
+    }
+    if (Dcm_CheckResponseSpace(pMsgContext, 1, ErrorCode) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    Dcm_ActiveSession = DCM_DEFAULT_SESSION;
+    Dcm_SecurityLevel = DCM_SEC_LEVEL_LOCKED;
+    Dcm_SeedRequested = 0;
+    Dcm_FailedAttempts = 0;
+    Dcm_PeriodicStopAll();
+    Dcm_DownloadAbort();
+
+    pMsgContext->resData[0] = resetType;
+    pMsgContext->resDataLen = 1;
+    return E_OK;
+}
+
+// 0x14 ClearDiagnosticInformation: xóa một DTC hoặc toàn bộ (0xFFFFFF)
+static Std_ReturnType Dcm_ClearDiagnosticInformation(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    if (pMsgContext->reqDataLen != 3) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+
+    uint32_t group = ((uint32_t)pMsgContext->reqData[0] << 16) |
+                     ((uint32_t)pMsgContext->reqData[1] << 8) |
+                     (uint32_t)pMsgContext->reqData[2];
+    if (Dem_ClearDtc(group) != E_OK) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+
+    pMsgContext->resDataLen = 0;
+    return E_OK;
+}
+
+// Ghi các DTC của bản chụp có trạng thái khớp mặt nạ vào bộ đệm phản hồi (mỗi DTC 4 byte)
+static Std_ReturnType Dcm_EncodeDtcList(Dcm_MsgContextType* pMsgContext, uint8_t statusMask,
+                                        uint8_t includeAll, Dcm_NegativeResponseCodeType* ErrorCode) {
+    uint8_t* res = pMsgContext->resData;
+    uint8_t processed = 0;
+
+    // Mỗi lần gọi chỉ duyệt tối đa DCM_DTC_RECORDS_PER_CALL bản ghi để không chiếm task DCM quá lâu
+    while (Dcm_DtcReportIndex < Dcm_DtcSnapshotCount) {
+        if (processed >= DCM_DTC_RECORDS_PER_CALL) {
+            return DCM_E_PENDING;
+        }
+        processed++;
+
+        uint32_t dtc = Dcm_DtcSnapshot[Dcm_DtcReportIndex];
+        uint8_t status = Dcm_DtcSnapshotStatus[Dcm_DtcReportIndex];
+        Dcm_DtcReportIndex++;
+        if (!includeAll && (status & statusMask) == 0) {
+            continue;
+        }
+        if (Dcm_CheckResponseSpace(pMsgContext, 4, ErrorCode) != E_OK) {
+            return E_NOT_OK;
+        }
+        uint16_t pos = pMsgContext->resDataLen;
+        res[pos] = (uint8_t)(dtc >> 16);
+        res[pos + 1] = (uint8_t)(dtc >> 8);
+        res[pos + 2] = (uint8_t)dtc;
+        res[pos + 3] = status;
+        pMsgContext->resDataLen = (uint16_t)(pos + 4);
+    }
+    return E_OK;
 }
 
-// Gửi phản hồi chẩn đoán đến thiết bị kiểm tra
-void Dcm_SendResponse(int service_id, const char* response) {
-    printf("Sending response to Service ID: 0x%x - %s\n", service_id, response);
+// 0x19 ReadDTCInformation: hỗ trợ các sub-function 0x01, 0x02 và 0x0A
+static Std_ReturnType Dcm_ReadDtcInformation(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    uint8_t subFunction = pMsgContext->subFunction;
+    uint8_t* res = pMsgContext->resData;
+
+    if (OpStatus == DCM_CANCEL) {
+        Dcm_DtcReportIndex = 0;
+        return E_NOT_OK;
+    }
+
+    if (OpStatus == DCM_INITIAL) {
+        switch (subFunction) {
+            case DCM_RDTCI_REPORT_NUMBER_OF_DTC_BY_STATUS_MASK:
+            case DCM_RDTCI_REPORT_DTC_BY_STATUS_MASK:
+                if (pMsgContext->reqDataLen != 2) {
+                    *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+                    return E_NOT_OK;
+                }
+                break;
+
+            case DCM_RDTCI_REPORT_SUPPORTED_DTC:
+                if (pMsgContext->reqDataLen != 1) {
+                    *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+                    return E_NOT_OK;
+                }
+                break;
+
+            default:
+                *ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+                return E_NOT_OK;
+        }
+
+        if (Dcm_CheckResponseSpace(pMsgContext, 2, ErrorCode) != E_OK) {
+            return E_NOT_OK;
+        }
+        res[0] = subFunction;
+        res[1] = DEM_DTC_STATUS_AVAILABILITY_MASK;
+        pMsgContext->resDataLen = 2;
+
+        if (subFunction == DCM_RDTCI_REPORT_NUMBER_OF_DTC_BY_STATUS_MASK) {
+            if (Dcm_CheckResponseSpace(pMsgContext, 3, ErrorCode) != E_OK) {
+                return E_NOT_OK;
+            }
+            uint16_t count = Dem_GetNumberOfFilteredDtc(pMsgContext->reqData[1]);
+            res[2] = 0x01;  // DTCFormatIdentifier: ISO 14229-1
+            res[3] = (uint8_t)(count >> 8);
+            res[4] = (uint8_t)(count & 0xFFU);
+            pMsgContext->resDataLen = 5;
+            return E_OK;
+        }
+        Dcm_DtcSnapshotCount = Dem_GetDtcSnapshot(Dcm_DtcSnapshot, Dcm_DtcSnapshotStatus, MAX_DIAGNOSTIC_EVENTS);
+        Dcm_DtcReportIndex = 0;
+    }
+
+    // reportSupportedDTC trả về mọi DTC, kể cả DTC có byte trạng thái bằng 0
+    if (subFunction == DCM_RDTCI_REPORT_SUPPORTED_DTC) {
+        return Dcm_EncodeDtcList(pMsgContext, 0x00, 1, ErrorCode);
+    }
+    return Dcm_EncodeDtcList(pMsgContext, pMsgContext->reqData[1], 0, ErrorCode);
+}
+
+// Sinh key mong đợi từ seed
+static uint32_t Dcm_ComputeKey(uint32_t seed) {
+    return ((seed << 7) | (seed >> 25)) ^ DCM_SECURITY_KEY_MASK;
+}
+
+// Kiểm tra thời gian khóa SecurityAccess; hết thời gian thì cho phép thử lại
+static uint8_t Dcm_SecurityDelayPending(void) {
+    if (Dcm_SecurityDelayActive && (uint32_t)(Os_GetTimeMs() - Dcm_SecurityDelayStartMs) >= DCM_SECURITY_DELAY_MS) {
+        Dcm_SecurityDelayActive = 0;
+    }
+    return Dcm_SecurityDelayActive;
+}
+
+// 0x27 SecurityAccess: requestSeed (0x01) và sendKey (0x02) cho mức bảo mật 1
+static Std_ReturnType Dcm_SecurityAccess(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint8_t* res = pMsgContext->resData;
+
+    if (pMsgContext->subFunction == 0x01) {
+        if (pMsgContext->reqDataLen != 1) {
+            *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+            return E_NOT_OK;
+        }
+        if (Dcm_SecurityDelayPending()) {
+            *ErrorCode = DCM_E_REQUIREDTIMEDELAYNOTEXPIRED;
+            return E_NOT_OK;
+        }
+        if (Dcm_CheckResponseSpace(pMsgContext, 5, ErrorCode) != E_OK) {
+            return E_NOT_OK;
+        }
+
+        // Seed bằng 0 nghĩa là mức bảo mật đã được mở
+        uint32_t seed = 0;
+        if (Dcm_SecurityLevel < DCM_SEC_LEVEL_1) {
+            do {
+                seed = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+            } while (seed == 0);
+            Dcm_SecuritySeed = seed;
+            Dcm_SeedRequested = 1;
+        }
+
+        res[0] = pMsgContext->subFunction;
+        res[1] = (uint8_t)(seed >> 24);
+        res[2] = (uint8_t)(seed >> 16);
+        res[3] = (uint8_t)(seed >> 8);
+        res[4] = (uint8_t)seed;
+        pMsgContext->resDataLen = 5;
+        return E_OK;
+    }
+
+    if (pMsgContext->subFunction == 0x02) {
+        if (pMsgContext->reqDataLen != 5) {
+            *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+            return E_NOT_OK;
+        }
+        if (!Dcm_SeedRequested) {
+            *ErrorCode = DCM_E_REQUESTSEQUENCEERROR;
+            return E_NOT_OK;
+        }
+
+        uint32_t key = ((uint32_t)pMsgContext->reqData[1] << 24) |
+                       ((uint32_t)pMsgContext->reqData[2] << 16) |
+                       ((uint32_t)pMsgContext->reqData[3] << 8) |
+                       (uint32_t)pMsgContext->reqData[4];
+        Dcm_SeedRequested = 0;
+        if (key != Dcm_ComputeKey(Dcm_SecuritySeed)) {
+            Dcm_FailedAttempts++;
+            *ErrorCode = DCM_E_INVALIDKEY;
+            if (Dcm_FailedAttempts >= DCM_SECURITY_MAX_ATTEMPTS) {
+                // Bắt đầu thời gian khóa, sau đó được thử lại đủ số lần
+                Dcm_FailedAttempts = 0;
+                Dcm_SecurityDelayActive = 1;
+                Dcm_SecurityDelayStartMs = Os_GetTimeMs();
+                *ErrorCode = DCM_E_EXCEEDNUMBEROFATTEMPTS;
+            }
+            return E_NOT_OK;
+        }
+        if (Dcm_CheckResponseSpace(pMsgContext, 1, ErrorCode) != E_OK) {
+            return E_NOT_OK;
+        }
+
+        Dcm_FailedAttempts = 0;
+        Dcm_SecurityLevel = DCM_SEC_LEVEL_1;
+        res[0] = pMsgContext->subFunction;
+        pMsgContext->resDataLen = 1;
+        return E_OK;
+    }
+
+    *ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+    return E_NOT_OK;
+}
+
+// 0x3E TesterPresent: giữ phiên chẩn đoán hiện tại
+static Std_ReturnType Dcm_TesterPresent(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    if (pMsgContext->reqDataLen != 1) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+    if (pMsgContext->subFunction != 0x00) {
+        *ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+        return E_NOT_OK;
+    }
+    if (Dcm_CheckResponseSpace(pMsgContext, 1, ErrorCode) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    pMsgContext->resData[0] = 0x00;
+    pMsgContext->resDataLen = 1;
+    return E_OK;
+}
+
+// Tìm DID trong bảng cấu hình (tìm kiếm nhị phân)
+static const Dcm_DidConfigType* Dcm_FindDid(uint16_t did) {
+    int low = 0;
+    int high = (int)DCM_NUM_DIDS - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (Dcm_DidTable[mid].did == did) {
+            return &Dcm_DidTable[mid];
+        }
+        if (Dcm_DidTable[mid].did < did) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+// Mã hóa giá trị của một DID trực tiếp vào vị trí dest (big-endian, bão hòa)
+static Std_ReturnType Dcm_EncodeDidData(const Dcm_DidConfigType* didConfig, uint8_t* dest) {
+    float value = 0.0f;
+    if (didConfig->readData(&value) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    float raw = value * didConfig->factor + 0.5f;
+    uint32_t maxRaw = (didConfig->length >= 4) ? 0xFFFFFFFFUL : ((1UL << (8U * didConfig->length)) - 1UL);
+    uint32_t rawValue;
+    if (raw <= 0.0f) {
+        rawValue = 0;
+    } else if (raw >= (float)maxRaw) {
+        rawValue = maxRaw;
+    } else {
+        rawValue = (uint32_t)raw;
+    }
+
+    for (uint8_t i = 0; i < didConfig->length; i++) {
+        dest[i] = (uint8_t)(rawValue >> (8U * (didConfig->length - 1U - i)));
+    }
+    return E_OK;
+}
+
+// 0x22 ReadDataByIdentifier: đọc một hoặc nhiều DID trong cùng một yêu cầu
+static Std_ReturnType Dcm_ReadDataByIdentifier(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint16_t numDids = (uint16_t)(pMsgContext->reqDataLen / 2U);
+    uint16_t numSupported = 0;
+    uint8_t* res = pMsgContext->resData;
+
+    if ((pMsgContext->reqDataLen % 2U) != 0 || numDids == 0 || numDids > DCM_RDBI_MAX_DIDS) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+
+    for (uint16_t i = 0; i < numDids; i++) {
+        uint16_t did = (uint16_t)(((uint16_t)pMsgContext->reqData[2U * i] << 8) | pMsgContext->reqData[2U * i + 1U]);
+        const Dcm_DidConfigType* didConfig = Dcm_FindDid(did);
+        if (didConfig == NULL) {
+            continue;  // DID không hỗ trợ được bỏ qua, chỉ báo lỗi khi không có DID nào hợp lệ
+        }
+        if (Dcm_CheckResponseSpace(pMsgContext, (uint16_t)(2U + didConfig->length), ErrorCode) != E_OK) {
+            return E_NOT_OK;
+        }
+
+        uint16_t pos = pMsgContext->resDataLen;
+        res[pos] = (uint8_t)(did >> 8);
+        res[pos + 1] = (uint8_t)did;
+        if (Dcm_EncodeDidData(didConfig, &res[pos + 2]) != E_OK) {
+            *ErrorCode = DCM_E_CONDITIONSNOTCORRECT;
+            return E_NOT_OK;
+        }
+        pMsgContext->resDataLen = (uint16_t)(pos + 2U + didConfig->length);
+        numSupported++;
+    }
+
+    if (numSupported == 0) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+// Dừng truyền toàn bộ periodic DID
+static void Dcm_PeriodicStopAll(void) {
+    for (uint8_t i = 0; i < 3; i++) {
+        Dcm_PeriodicRates[i].count = 0;
+        Dcm_PeriodicRates[i].countdown = Dcm_PeriodicRates[i].periodTicks;
+    }
+    memset(Dcm_PeriodicRateOf, 0, sizeof(Dcm_PeriodicRateOf));
+    Dcm_PeriodicScheduledCount = 0;
+}
+
+// Gỡ một pDID khỏi lịch: khe cuối được chuyển vào chỗ trống để danh sách luôn dày đặc
+static void Dcm_PeriodicRemove(uint8_t pdid) {
+    uint8_t rate = Dcm_PeriodicRateOf[pdid];
+    if (rate == 0) {
+        return;
+    }
+
+    Dcm_PeriodicRateType* schedule = &Dcm_PeriodicRates[rate - 1];
+    uint8_t slot = Dcm_PeriodicSlotOf[pdid];
+    uint8_t last = (uint8_t)(schedule->count - 1);
+    if (slot != last) {
+        schedule->slots[slot] = schedule->slots[last];
+        Dcm_PeriodicSlotOf[schedule->slots[slot].pdid] = slot;
+    }
+    schedule->count = last;
+    Dcm_PeriodicRateOf[pdid] = 0;
+    Dcm_PeriodicScheduledCount--;
+}
+
+// Thêm một pDID vào lịch của tốc độ rate (1..3)
+static void Dcm_PeriodicAdd(uint8_t pdid, const Dcm_DidConfigType* didConfig, uint8_t rate) {
+    Dcm_PeriodicRateType* schedule = &Dcm_PeriodicRates[rate - 1];
+    uint8_t slot = schedule->count;
+
+    if (slot == 0) {
+        schedule->countdown = 1;  // Gửi khung đầu tiên ngay ở tick kế tiếp
+    }
+    schedule->slots[slot].didConfig = didConfig;
+    schedule->slots[slot].pdid = pdid;
+    schedule->slots[slot].frameLength = (uint8_t)(1U + didConfig->length);
+    schedule->count = (uint8_t)(slot + 1);
+    Dcm_PeriodicRateOf[pdid] = rate;
+    Dcm_PeriodicSlotOf[pdid] = slot;
+    Dcm_PeriodicScheduledCount++;
+}
+
+// 0x2A ReadDataByPeriodicIdentifier: lập lịch hoặc dừng truyền các periodic DID
+static Std_ReturnType Dcm_ReadDataByPeriodicIdentifier(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint8_t mode = pMsgContext->reqData[0];
+    const uint8_t* pdids = &pMsgContext->reqData[1];
+    uint16_t numPdids = (uint16_t)(pMsgContext->reqDataLen - 1U);
+
+    if (mode < DCM_PDID_SEND_AT_SLOW_RATE || mode > DCM_PDID_STOP_SENDING) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+
+    if (mode == DCM_PDID_STOP_SENDING) {
+        if (numPdids == 0) {
+            Dcm_PeriodicStopAll();  // Không có pDID: dừng tất cả
+        }
+        for (uint16_t i = 0; i < numPdids; i++) {
+            Dcm_PeriodicRemove(pdids[i]);
+        }
+        pMsgContext->resDataLen = 0;
+        return E_OK;
+    }
+
+    // Các chế độ gửi cần ít nhất một pDID
+    if (numPdids == 0 || numPdids > DCM_PDID_MAX_SCHEDULED) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+
+    // Kiểm tra toàn bộ yêu cầu trước khi thay đổi lịch
+    uint16_t newCount = Dcm_PeriodicScheduledCount;
+    for (uint16_t i = 0; i < numPdids; i++) {
+        const Dcm_DidConfigType* didConfig = Dcm_FindDid((uint16_t)((DCM_PDID_HIGH_BYTE << 8) | pdids[i]));
+        if (didConfig == NULL || didConfig->length > DCM_PDID_MAX_DATA_LENGTH) {
+            *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+            return E_NOT_OK;
+        }
+        if (Dcm_PeriodicRateOf[pdids[i]] == 0) {
+            newCount++;
+        }
+    }
+    if (newCount > DCM_PDID_MAX_SCHEDULED) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+
+    for (uint16_t i = 0; i < numPdids; i++) {
+        const Dcm_DidConfigType* didConfig = Dcm_FindDid((uint16_t)((DCM_PDID_HIGH_BYTE << 8) | pdids[i]));
+        Dcm_PeriodicRemove(pdids[i]);  // pDID đã có lịch được chuyển sang tốc độ mới
+        Dcm_PeriodicAdd(pdids[i], didConfig, mode);
+    }
+
+    pMsgContext->resDataLen = 0;
+    return E_OK;
+}
+
+// Hàm chu kỳ của DCM: chỉ duyệt các khe đang hoạt động của tốc độ đến hạn
+void Dcm_MainFunction(void) {
+    for (uint8_t rate = 0; rate < 3; rate++) {
+        Dcm_PeriodicRateType* schedule = &Dcm_PeriodicRates[rate];
+        if (schedule->count == 0 || --schedule->countdown != 0) {
+            continue;
+        }
+        schedule->countdown = schedule->periodTicks;
+
+        for (uint8_t i = 0; i < schedule->count; i++) {
+            const Dcm_PeriodicSlotType* slot = &schedule->slots[i];
+            uint8_t payload[DCM_PDID_MAX_DATA_LENGTH];
+            if (Dcm_EncodeDidData(slot->didConfig, payload) != E_OK) {
+                continue;
+            }
+
+            Can_MessageType frame;
+            frame.id = DCM_PDID_CAN_ID;
+            frame.length = slot->frameLength;
+            frame.data[0] = slot->pdid;
+            for (uint8_t j = 1; j < slot->frameLength; j++) {
+                frame.data[j] = payload[j - 1];
+            }
+            Can_SendMessage(&frame);
+        }
+    }
+}
+
+// Trạng thái của một phiên nạp dữ liệu RequestDownload -> TransferData -> RequestTransferExit
+typedef struct {
+    uint8_t active;             // 1: đang trong quá trình nạp
+    uint8_t blockCounter;       // blockSequenceCounter của khối được chấp nhận gần nhất
+    uint8_t anyBlockAccepted;   // 1: đã ghi ít nhất một khối
+    uint16_t maxBlockLength;    // maxNumberOfBlockLength đã thông báo cho tester
+    uint32_t nextAddress;       // Địa chỉ flash của byte kế tiếp
+    uint32_t endAddress;        // Địa chỉ ngay sau vùng cần nạp
+    uint32_t erasedEnd;         // Các sector trước địa chỉ này đã được xóa
+} Dcm_DownloadStateType;
+
+static Dcm_DownloadStateType Dcm_Download;
+
+// Hủy quá trình nạp đang dở dang
+static void Dcm_DownloadAbort(void) {
+    memset(&Dcm_Download, 0, sizeof(Dcm_Download));
+}
+
+// Giải mã số nguyên big-endian có độ dài 1..4 byte
+static uint32_t Dcm_DecodeBigEndian(const uint8_t* data, uint8_t length) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < length; i++) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+// 0x34 RequestDownload: mở vùng flash để nạp và thông báo maxNumberOfBlockLength
+static Std_ReturnType Dcm_RequestDownload(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    const uint8_t* req = pMsgContext->reqData;
+    uint8_t sizeLength = (uint8_t)(req[1] >> 4);       // memorySize length
+    uint8_t addressLength = (uint8_t)(req[1] & 0x0FU); // memoryAddress length
+
+    if (sizeLength < 1 || sizeLength > 4 || addressLength < 1 || addressLength > 4) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+    if (pMsgContext->reqDataLen != (uint16_t)(2 + addressLength + sizeLength)) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+    if (req[0] != DCM_DOWNLOAD_DATA_FORMAT_RAW) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+    if (Dcm_Download.active) {
+        *ErrorCode = DCM_E_CONDITIONSNOTCORRECT;
+        return E_NOT_OK;
+    }
+
+    uint32_t address = Dcm_DecodeBigEndian(&req[2], addressLength);
+    uint32_t size = Dcm_DecodeBigEndian(&req[2 + addressLength], sizeLength);
+    uint32_t offset = address - DCM_DOWNLOAD_AREA_START;
+    if (size == 0 || offset >= DCM_DOWNLOAD_AREA_SIZE || size > DCM_DOWNLOAD_AREA_SIZE - offset ||
+        (offset % FLS_SECTOR_SIZE) != 0) {
+        *ErrorCode = DCM_E_REQUESTOUTOFRANGE;
+        return E_NOT_OK;
+    }
+    if (Dcm_CheckResponseSpace(pMsgContext, 3, ErrorCode) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    // Khối lớn nhất có ích là toàn bộ vùng nạp; không thông báo lớn hơn mức cần thiết
+    uint32_t maxBlockLength = DCM_DOWNLOAD_MAX_BLOCK_LENGTH;
+    if (size + 2U < maxBlockLength) {
+        maxBlockLength = size + 2U;
+    }
+
+    Dcm_Download.active = 1;
+    Dcm_Download.blockCounter = 0;
+    Dcm_Download.anyBlockAccepted = 0;
+    Dcm_Download.maxBlockLength = (uint16_t)maxBlockLength;
+    Dcm_Download.nextAddress = address;
+    Dcm_Download.endAddress = address + size;
+    Dcm_Download.erasedEnd = address;
+
+    uint8_t* res = pMsgContext->resData;
+    res[0] = 0x20;  // lengthFormatIdentifier: maxNumberOfBlockLength dài 2 byte
+    res[1] = (uint8_t)(maxBlockLength >> 8);
+    res[2] = (uint8_t)(maxBlockLength & 0xFFU);
+    pMsgContext->resDataLen = 3;
+    return E_OK;
+}
+
+// 0x36 TransferData: ghi thẳng khối dữ liệu từ bộ đệm yêu cầu vào flash,
+// các sector được xóa dần ngay trước khi khối đầu tiên chạm tới
+static Std_ReturnType Dcm_TransferData(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+    uint8_t blockCounter = pMsgContext->reqData[0];
+    const uint8_t* data = &pMsgContext->reqData[1];
+    uint32_t length = (uint32_t)pMsgContext->reqDataLen - 1U;
+
+    if (!Dcm_Download.active) {
+        *ErrorCode = DCM_E_REQUESTSEQUENCEERROR;
+        return E_NOT_OK;
+    }
+    if (pMsgContext->reqDataLen + 1U > Dcm_Download.maxBlockLength || length == 0) {
+        *ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+        return E_NOT_OK;
+    }
+    if (Dcm_CheckResponseSpace(pMsgContext, 1, ErrorCode) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    pMsgContext->resData[0] = blockCounter;
+    pMsgContext->resDataLen = 1;
+
+    // Tester gửi lại khối vừa được chấp nhận (mất phản hồi): trả lời dương, không ghi lại
+    if (Dcm_Download.anyBlockAccepted && blockCounter == Dcm_Download.blockCounter) {
+        return E_OK;
+    }
+    if (blockCounter != (uint8_t)(Dcm_Download.blockCounter + 1U)) {
+        *ErrorCode = DCM_E_WRONGBLOCKSEQUENCECOUNTER;
+        return E_NOT_OK;
+    }
+    if (length > Dcm_Download.endAddress - Dcm_Download.nextAddress) {
+        *ErrorCode = DCM_E_TRANSFERDATASUSPENDED;
+        return E_NOT_OK;
+    }
+
+    uint32_t blockEnd = Dcm_Download.nextAddress + length;
+    if (blockEnd > Dcm_Download.erasedEnd) {
+        uint32_t eraseEnd = Dcm_Download.erasedEnd +
+            ((blockEnd - Dcm_Download.erasedEnd + FLS_SECTOR_SIZE - 1U) / FLS_SECTOR_SIZE) * FLS_SECTOR_SIZE;
+        if (Fls_Erase(Dcm_Download.erasedEnd, eraseEnd - Dcm_Download.erasedEnd) != E_OK) {
+            *ErrorCode = DCM_E_GENERALPROGRAMMINGFAILURE;
+            return E_NOT_OK;
+        }
+        Dcm_Download.erasedEnd = eraseEnd;
+    }
+    if (Fls_Write(Dcm_Download.nextAddress, data, length) != E_OK) {
+        *ErrorCode = DCM_E_GENERALPROGRAMMINGFAILURE;
+        return E_NOT_OK;
+    }
+
+    Dcm_Download.nextAddress = blockEnd;
+    Dcm_Download.blockCounter = blockCounter;
+    Dcm_Download.anyBlockAccepted = 1;
+    return E_OK;
+}
+
+// 0x37 RequestTransferExit: kết thúc quá trình nạp khi đã nhận đủ dữ liệu
+static Std_ReturnType Dcm_RequestTransferExit(Dcm_OpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode) {
+    (void)OpStatus;
+
+    if (!Dcm_Download.active || Dcm_Download.nextAddress != Dcm_Download.endAddress) {
+        *ErrorCode = DCM_E_REQUESTSEQUENCEERROR;
+        return E_NOT_OK;
+    }
+
+    Dcm_DownloadAbort();
+    pMsgContext->resDataLen = 0;
+    return E_OK;
 }
@@ -3,26 +3,225 @@
 
 #include <stdio.h>
 #include <string.h>
+#include "Std_Types.h"
+#include "Fls.h"
+#include "NvM.h"
 
 // Định nghĩa các dịch vụ chẩn đoán (Diagnostic Services)
 #define DIAGNOSTIC_SESSION_CONTROL 0x10
 #define ECU_RESET 0x11
-#define READ_DTC 0x19
 #define CLEAR_DTC 0x14
+#define READ_DTC 0x19
+#define READ_DATA_BY_IDENTIFIER 0x22
+#define READ_DATA_BY_PERIODIC_IDENTIFIER 0x2A
+#define SECURITY_ACCESS 0x27
+#define REQUEST_DOWNLOAD 0x34
+#define TRANSFER_DATA 0x36
+#define REQUEST_TRANSFER_EXIT 0x37
+#define TESTER_PRESENT 0x3E
+
+// Các sub-function của ReadDTCInformation (0x19)
+#define DCM_RDTCI_REPORT_NUMBER_OF_DTC_BY_STATUS_MASK 0x01
+#define DCM_RDTCI_REPORT_DTC_BY_STATUS_MASK 0x02
+#define DCM_RDTCI_REPORT_SUPPORTED_DTC 0x0A
+
+// Các DID dữ liệu động cơ đọc được qua ReadDataByIdentifier (0x22)
+#define DCM_DID_THROTTLE_POSITION 0xF210  // Vị trí bàn đạp ga, 0.1 %/bit
+#define DCM_DID_VEHICLE_SPEED 0xF211      // Tốc độ xe, 0.01 km/h/bit
+#define DCM_DID_LOAD_WEIGHT 0xF212        // Tải trọng, 0.1 kg/bit
+#define DCM_DID_ACTUAL_TORQUE 0xF213      // Mô-men xoắn thực tế, 0.1 Nm/bit
+#define DCM_DID_DESIRED_TORQUE 0xF214     // Mô-men xoắn yêu cầu sau phân xử, 0.1 Nm/bit
+#define DCM_DID_TORQUE_COMMAND 0xF215     // Lệnh mô-men xoắn gửi tới động cơ, 0.1 Nm/bit
+
+// Số DID tối đa trong một yêu cầu ReadDataByIdentifier
+#define DCM_RDBI_MAX_DIDS 8
+
+// Chế độ truyền của ReadDataByPeriodicIdentifier (0x2A)
+#define DCM_PDID_SEND_AT_SLOW_RATE 0x01
+#define DCM_PDID_SEND_AT_MEDIUM_RATE 0x02
+#define DCM_PDID_SEND_AT_FAST_RATE 0x03
+#define DCM_PDID_STOP_SENDING 0x04
+
+// Chu kỳ gọi Dcm_MainFunction và chu kỳ truyền của từng tốc độ (ms)
+#define DCM_MAIN_FUNCTION_PERIOD_MS 10U
+#define DCM_PDID_SLOW_RATE_MS 1000U
+#define DCM_PDID_MEDIUM_RATE_MS 200U
+#define DCM_PDID_FAST_RATE_MS 50U
+
+// Periodic DID có dạng 0xF2xx, yêu cầu chỉ mang byte thấp
+#define DCM_PDID_HIGH_BYTE 0xF2
+// Số periodic DID tối đa được lập lịch cùng lúc
+#define DCM_PDID_MAX_SCHEDULED 8
+// CAN ID của khung phản hồi periodic (mỗi khung: byte pDID + tối đa 7 byte dữ liệu)
+#define DCM_PDID_CAN_ID 0x6A0
+#define DCM_PDID_MAX_DATA_LENGTH 7
+
+// Byte đặc biệt trong thông điệp UDS
+#define DCM_POSITIVE_RESPONSE_OFFSET 0x40  // SID phản hồi dương = SID + 0x40
+#define DCM_NEGATIVE_RESPONSE_SID 0x7F     // SID của phản hồi âm
+#define DCM_SUPPRESS_POS_RESPONSE_BIT 0x80 // Bit chặn phản hồi dương trong sub-function
+#define DCM_NEGATIVE_RESPONSE_LENGTH 3     // 0x7F + SID + NRC
+
+// Mã phản hồi âm (NRC) theo ISO 14229-1
+typedef uint8_t Dcm_NegativeResponseCodeType;
+#define DCM_E_POSITIVERESPONSE 0x00
+#define DCM_E_GENERALREJECT 0x10
+#define DCM_E_BUSYREPEATREQUEST 0x21
+#define DCM_E_SERVICENOTSUPPORTED 0x11
+#define DCM_E_SUBFUNCTIONNOTSUPPORTED 0x12
+#define DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT 0x13
+#define DCM_E_RESPONSETOOLONG 0x14
+#define DCM_E_CONDITIONSNOTCORRECT 0x22
+#define DCM_E_REQUESTSEQUENCEERROR 0x24
+#define DCM_E_REQUESTOUTOFRANGE 0x31
+#define DCM_E_SECURITYACCESSDENIED 0x33
+#define DCM_E_INVALIDKEY 0x35
+#define DCM_E_EXCEEDNUMBEROFATTEMPTS 0x36
+#define DCM_E_REQUIREDTIMEDELAYNOTEXPIRED 0x37
+#define DCM_E_UPLOADDOWNLOADNOTACCEPTED 0x70
+#define DCM_E_TRANSFERDATASUSPENDED 0x71
+#define DCM_E_GENERALPROGRAMMINGFAILURE 0x72
+#define DCM_E_WRONGBLOCKSEQUENCECOUNTER 0x73
+#define DCM_E_REQUESTCORRECTLYRECEIVEDRESPONSEPENDING 0x78
+#define DCM_E_SUBFUNCTIONNOTSUPPORTEDINACTIVESESSION 0x7E
+#define DCM_E_SERVICENOTSUPPORTEDINACTIVESESSION 0x7F
+
+// Các phiên chẩn đoán (Diagnostic Session)
+#define DCM_DEFAULT_SESSION 0x01
+#define DCM_PROGRAMMING_SESSION 0x02
+#define DCM_EXTENDED_DIAGNOSTIC_SESSION 0x03
+
+// Mặt nạ phiên dùng trong bảng cấu hình dịch vụ
+#define DCM_SESSION_MASK(session) ((uint8_t)(1U << (session)))
+#define DCM_SES_DEFAULT DCM_SESSION_MASK(DCM_DEFAULT_SESSION)
+#define DCM_SES_PROGRAMMING DCM_SESSION_MASK(DCM_PROGRAMMING_SESSION)
+#define DCM_SES_EXTENDED DCM_SESSION_MASK(DCM_EXTENDED_DIAGNOSTIC_SESSION)
+#define DCM_SES_ALL (DCM_SES_DEFAULT | DCM_SES_PROGRAMMING | DCM_SES_EXTENDED)
+
+// Mức bảo mật (Security Level)
+#define DCM_SEC_LEVEL_LOCKED 0x00
+#define DCM_SEC_LEVEL_1 0x01
+
+// Thông số thời gian của server gửi trong phản hồi DiagnosticSessionControl
+#define DCM_P2_SERVER_MAX_MS 50U
+#define DCM_P2STAR_SERVER_MAX_MS 5000U
+
+// Khoảng thời gian dự phòng: NRC 0x78 được gửi trước khi P2/P2* hết hạn
+#define DCM_RESPONSE_PENDING_MARGIN_MS 10U
+// Số lần gửi NRC 0x78 tối đa cho một yêu cầu trước khi hủy bằng NRC 0x10
+#define DCM_MAX_RESPONSE_PENDING 10U
+// Chu kỳ gọi lại hàm xử lý đang ở trạng thái pending (ms)
+#define DCM_PENDING_POLL_PERIOD_MS 1U
+
+// Kích thước bộ đệm yêu cầu/phản hồi (giới hạn của ISO-TP trên CAN cổ điển)
+#define DCM_MAX_REQUEST_LENGTH 4095U
+#define DCM_MAX_RESPONSE_LENGTH 4095U
+// Số yêu cầu tối đa chờ trong hàng đợi của task DCM
+#define DCM_REQUEST_QUEUE_LENGTH 4U
+
+// Số bản ghi DTC xử lý trong một lần gọi hàm ReadDTCInformation trước khi nhường CPU
+#define DCM_DTC_RECORDS_PER_CALL 4U
 
-// Cấu trúc mô phỏng một gói tin chẩn đoán
+// Vùng flash cho phép nạp qua RequestDownload (0x34), địa chỉ bắt đầu phải căn theo sector.
+// Các sector của NvM ở cuối flash không được ghi đè
+#define DCM_DOWNLOAD_AREA_START FLS_BASE_ADDRESS
+#define DCM_DOWNLOAD_AREA_SIZE (NVM_AREA_START - DCM_DOWNLOAD_AREA_START)
+// maxNumberOfBlockLength tối đa mà server chấp nhận (gồm SID và blockSequenceCounter).
+// Giá trị thực gửi cho tester được thu nhỏ theo kích thước vùng cần nạp
+#define DCM_DOWNLOAD_MAX_BLOCK_LENGTH DCM_MAX_REQUEST_LENGTH
+// dataFormatIdentifier được hỗ trợ: không nén, không mã hóa
+#define DCM_DOWNLOAD_DATA_FORMAT_RAW 0x00
+
+// Số lần gửi key sai tối đa trước khi khóa SecurityAccess
+#define DCM_SECURITY_MAX_ATTEMPTS 3
+// Thời gian khóa SecurityAccess sau khi vượt số lần gửi key sai (ms); trong thời gian
+// này requestSeed bị từ chối bằng NRC 0x37, hết thời gian thì được thử lại
+#define DCM_SECURITY_DELAY_MS 10000U
+
+// Ngữ cảnh của một yêu cầu đang được xử lý, truyền cho hàm xử lý dịch vụ
 typedef struct {
-    int service_id;     // Mã dịch vụ chẩn đoán
-    char data[50];      // Dữ liệu kèm theo
-} Dcm_MessageType;
+    const uint8_t* reqData;     // Dữ liệu yêu cầu, bắt đầu ngay sau SID
+    uint16_t reqDataLen;        // Độ dài dữ liệu yêu cầu (không gồm SID)
+    uint8_t subFunction;        // Sub-function đã bỏ bit chặn phản hồi dương
+    uint8_t suppressPosResponse;// 1: không gửi phản hồi dương
+    uint8_t* resData;           // Bộ đệm phản hồi, bắt đầu ngay sau SID phản hồi
+    uint16_t resDataLen;        // Độ dài dữ liệu phản hồi do hàm xử lý ghi
+    uint16_t resMaxDataLen;     // Dung lượng tối đa của bộ đệm phản hồi
+} Dcm_MsgContextType;
+
+// Trạng thái gọi hàm xử lý: lần đầu, gọi lại sau khi pending, hoặc hủy
+typedef uint8_t Dcm_OpStatusType;
+#define DCM_INITIAL 0x00
+#define DCM_PENDING 0x01
+#define DCM_CANCEL 0x02
+
+// Giá trị trả về của hàm xử lý khi cần nhường CPU và được gọi lại sau
+#define DCM_E_PENDING 0x0AU
+
+// Hàm xử lý dịch vụ: trả về E_OK, E_NOT_OK kèm NRC trong ErrorCode,
+// hoặc DCM_E_PENDING để được gọi lại với OpStatus = DCM_PENDING
+typedef Std_ReturnType (*Dcm_ServiceHandlerType)(Dcm_OpStatusType OpStatus,
+                                                 Dcm_MsgContextType* pMsgContext,
+                                                 Dcm_NegativeResponseCodeType* ErrorCode);
+
+// Hàm nhận phản hồi do task DCM gửi ra (gồm cả NRC 0x78)
+typedef void (*Dcm_ResponseCallbackType)(const uint8_t* response, uint16_t responseLength);
+
+// Một dòng trong bảng cấu hình dịch vụ
+typedef struct {
+    uint8_t sid;                    // Mã dịch vụ
+    uint8_t minReqLength;           // Độ dài yêu cầu tối thiểu (gồm SID)
+    uint8_t subFunctionAvail;       // 1: dịch vụ có byte sub-function
+    uint8_t sessionMask;            // Các phiên cho phép (DCM_SES_*)
+    uint8_t securityLevel;          // Mức bảo mật yêu cầu (DCM_SEC_LEVEL_*)
+    Dcm_ServiceHandlerType handler; // Hàm xử lý dịch vụ
+} Dcm_ServiceConfigType;
+
+// Hàm truy cập dữ liệu của một DID (đọc giá trị mới nhất từ RTE)
+typedef Std_ReturnType (*Dcm_DidReadFncType)(float* Data);
+
+// Một dòng trong bảng DID: giá trị vật lý được mã hóa thành số nguyên không dấu
+// big-endian có độ dài cố định, raw = value * factor (bão hòa trong phạm vi)
+typedef struct {
+    uint16_t did;                // Mã định danh dữ liệu
+    uint8_t length;              // Số byte dữ liệu trong phản hồi (1, 2 hoặc 4)
+    float factor;                // Hệ số chuyển đổi giá trị vật lý -> giá trị thô
+    Dcm_DidReadFncType readData; // Hàm truy cập dữ liệu
+} Dcm_DidConfigType;
 
 // Khởi tạo hệ thống DCM
 void Dcm_Init(void);
 
-// Xử lý yêu cầu chẩn đoán từ bên ngoài
-void Dcm_ProcessRequest(Dcm_MessageType* request);
+// Xử lý đồng bộ một yêu cầu UDS nhị phân trong ngữ cảnh của caller, phản hồi được
+// mã hóa vào bộ đệm của caller (hàm xử lý pending được gọi lại đến khi hoàn tất).
+// Ứng dụng (main.c) luôn chạy task DCM nên tester đi qua Dcm_SubmitRequest; hàm này dành
+// cho chương trình không tạo task DCM (harness, công cụ kiểm thử) vì trạng thái phiên,
+// bảo mật và periodic DID dùng chung với task DCM không được khóa.
+// Trả về E_OK nếu có phản hồi (responseLength = 0 khi phản hồi dương bị chặn)
+Std_ReturnType Dcm_ProcessRequest(const uint8_t* request, uint16_t requestLength,
+                                  uint8_t* response, uint16_t responseMaxLength,
+                                  uint16_t* responseLength);
+
+// Đưa một yêu cầu vào hàng đợi của task DCM (không chặn).
+// Trả về E_NOT_OK nếu yêu cầu không hợp lệ hoặc hàng đợi đã đầy
+Std_ReturnType Dcm_SubmitRequest(const uint8_t* request, uint16_t requestLength);
+
+// Đăng ký hàm nhận phản hồi từ task DCM
+void Dcm_SetResponseCallback(Dcm_ResponseCallbackType callback);
+
+// Task của DCM: xử lý hàng đợi yêu cầu, giám sát P2/P2* và chạy Dcm_MainFunction
+void* Dcm_Task(void* arg);
+
+// Yêu cầu task DCM kết thúc
+void Dcm_StopTask(void);
+
+// Hàm chu kỳ của DCM (gọi mỗi DCM_MAIN_FUNCTION_PERIOD_MS), gửi các periodic DID đến hạn
+void Dcm_MainFunction(void);
+
+// Lấy phiên chẩn đoán hiện tại
+uint8_t Dcm_GetActiveSession(void);
 
-// Gửi phản hồi chẩn đoán đến thiết bị kiểm tra
-void Dcm_SendResponse(int service_id, const char* response);
+// Lấy mức bảo mật hiện tại
+uint8_t Dcm_GetSecurityLevel(void);
 
 #endif // DCM_H
@@ -1,24 +1,40 @@
 #include "Dem.h"
+#include "Dlt.h"
+#include <pthread.h>
 
 // Mảng để lưu trữ các sự kiện chẩn đoán
-Dem_EventType diagnostic_events[MAX_DIAGNOSTIC_EVENTS];
-int event_count = 0;
+static Dem_EventType diagnostic_events[MAX_DIAGNOSTIC_EVENTS];
+static int event_count = 0;
+
+// Bảo vệ bộ nhớ lỗi: SWC báo sự kiện (task 100 ms) trong khi DCM đọc và xóa DTC (task DCM)
+static pthread_mutex_t Dem_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Các bit trạng thái được bật khi sự kiện báo lỗi
+#define DEM_STATUS_FAILED_BITS \
+    (DEM_UDS_STATUS_TF | DEM_UDS_STATUS_TFTOC | DEM_UDS_STATUS_PDTC | \
+     DEM_UDS_STATUS_CDTC | DEM_UDS_STATUS_TFSLC)
 
 // Khởi tạo hệ thống quản lý sự kiện chẩn đoán
 void Dem_Init(void) {
-    printf("Diagnostic Event Manager (DEM) Initialized.\n");
+    DLT_LOG_INFO(DLT_MSG_DEM_INIT);
+    pthread_mutex_lock(&Dem_Lock);
     for (int i = 0; i < MAX_DIAGNOSTIC_EVENTS; i++) {
         diagnostic_events[i].event_id = -1;
         diagnostic_events[i].is_active = 0;
+        diagnostic_events[i].dtc = 0;
+        diagnostic_events[i].status_byte = 0;
         strcpy(diagnostic_events[i].event_description, "");
     }
     event_count = 0;
+    pthread_mutex_unlock(&Dem_Lock);
 }
 
 // Kích hoạt một sự kiện chẩn đoán
 void Dem_ReportErrorStatus(int event_id, const char* description) {
+    pthread_mutex_lock(&Dem_Lock);
     if (event_count >= MAX_DIAGNOSTIC_EVENTS) {
-        printf("Cannot report more events. Maximum diagnostic events reached.\n");
+        pthread_mutex_unlock(&Dem_Lock);
+        DLT_LOG_ERROR(DLT_MSG_DEM_MEMORY_FULL);
         return;
     }
 
@@ -26,7 +42,9 @@ void Dem_ReportErrorStatus(int event_id, const char* description) {
     for (int i = 0; i < event_count; i++) {
         if (diagnostic_events[i].event_id == event_id) {
             diagnostic_events[i].is_active = 1;
-            printf("Event ID %d already exists. Updating its status to active.\n", event_id);
+            diagnostic_events[i].status_byte |= DEM_STATUS_FAILED_BITS;
+            pthread_mutex_unlock(&Dem_Lock);
+            DLT_LOG_WARN(DLT_MSG_DEM_EVENT_REACTIVATED, DLT_I32(event_id));
             return;
         }
     }
@@ -34,48 +52,153 @@ void Dem_ReportErrorStatus(int event_id, const char* description) {
     // Thêm sự kiện mới
     diagnostic_events[event_count].event_id = event_id;
     diagnostic_events[event_count].is_active = 1;
+    diagnostic_events[event_count].dtc = (uint32_t)event_id & DEM_DTC_GROUP_ALL_DTCS;
+    diagnostic_events[event_count].status_byte = DEM_STATUS_FAILED_BITS;
     strncpy(diagnostic_events[event_count].event_description, description, sizeof(diagnostic_events[event_count].event_description) - 1);
+    // Mô tả được log từ bản sao trong bộ nhớ sự kiện vì task log định dạng sau
+    DLT_LOG_INFO(DLT_MSG_DEM_EVENT_REPORTED, DLT_I32(event_id), DLT_STR(diagnostic_events[event_count].event_description));
     event_count++;
-
-    printf("New diagnostic event reported: ID = %d, Description = %s\n", event_id, description);
+    pthread_mutex_unlock(&Dem_Lock);
 }
 
 // Xóa bỏ một sự kiện chẩn đoán (tức là lỗi đã được giải quyết)
 void Dem_ClearErrorStatus(int event_id) {
+    pthread_mutex_lock(&Dem_Lock);
     for (int i = 0; i < event_count; i++) {
         if (diagnostic_events[i].event_id == event_id) {
             diagnostic_events[i].is_active = 0;
-            printf("Event ID %d cleared (no longer active).\n", event_id);
+            diagnostic_events[i].status_byte &= (uint8_t)~DEM_UDS_STATUS_TF;
+            pthread_mutex_unlock(&Dem_Lock);
+            DLT_LOG_INFO(DLT_MSG_DEM_EVENT_CLEARED, DLT_I32(event_id));
             return;
         }
     }
-    printf("Event ID %d not found.\n", event_id);
+    pthread_mutex_unlock(&Dem_Lock);
+    DLT_LOG_WARN(DLT_MSG_DEM_EVENT_NOT_FOUND, DLT_I32(event_id));
 }
 
 // Kiểm tra trạng thái của một sự kiện chẩn đoán
 int Dem_CheckErrorStatus(int event_id) {
+    int active = -1;  // Sự kiện không tồn tại
+
+    pthread_mutex_lock(&Dem_Lock);
     for (int i = 0; i < event_count; i++) {
         if (diagnostic_events[i].event_id == event_id) {
-            if (diagnostic_events[i].is_active) {
-                printf("Event ID %d is active.\n", event_id);
-                return 1;
-            } else {
-                printf("Event ID %d is inactive.\n", event_id);
-                return 0;
-            }
+            active = diagnostic_events[i].is_active ? 1 : 0;
+            break;
         }
     }
-    printf("Event ID %d not found.\n", event_id);
-    return -1;  // Sự kiện không tồn tại
+    pthread_mutex_unlock(&Dem_Lock);
+
+    if (active == 1) {
+        DLT_LOG_DEBUG(DLT_MSG_DEM_EVENT_ACTIVE, DLT_I32(event_id));
+    } else if (active == 0) {
+        DLT_LOG_DEBUG(DLT_MSG_DEM_EVENT_INACTIVE, DLT_I32(event_id));
+    } else {
+        DLT_LOG_WARN(DLT_MSG_DEM_EVENT_NOT_FOUND, DLT_I32(event_id));
+    }
+    return active;
 }
 
 // In danh sách toàn bộ các sự kiện chẩn đoán
 void Dem_PrintEventList(void) {
     printf("Diagnostic Events List:\n");
+    pthread_mutex_lock(&Dem_Lock);
     for (int i = 0; i < event_count; i++) {
         printf("ID: %d, Description: %s, Status: %s\n",
                diagnostic_events[i].event_id,
                diagnostic_events[i].event_description,
                diagnostic_events[i].is_active ? "Active" : "Inactive");
     }
+    pthread_mutex_unlock(&Dem_Lock);
+}
+
+// Số lượng sự kiện đang được lưu trong bộ nhớ lỗi
+int Dem_GetNumberOfEvents(void) {
+    pthread_mutex_lock(&Dem_Lock);
+    int count = event_count;
+    pthread_mutex_unlock(&Dem_Lock);
+    return count;
+}
+
+// Lấy mã DTC và byte trạng thái của sự kiện thứ index
+Std_ReturnType Dem_GetDtcByIndex(int index, uint32_t* dtc, uint8_t* status) {
+    if (dtc == NULL || status == NULL) {
+        return E_NOT_OK;
+    }
+
+    pthread_mutex_lock(&Dem_Lock);
+    if (index < 0 || index >= event_count) {
+        pthread_mutex_unlock(&Dem_Lock);
+        return E_NOT_OK;
+    }
+    *dtc = diagnostic_events[index].dtc;
+    *status = diagnostic_events[index].status_byte & DEM_DTC_STATUS_AVAILABILITY_MASK;
+    pthread_mutex_unlock(&Dem_Lock);
+    return E_OK;
+}
+
+// Chụp toàn bộ DTC và byte trạng thái trong một lần khóa (danh sách nhất quán)
+int Dem_GetDtcSnapshot(uint32_t* dtc, uint8_t* status, int max_count) {
+    if (dtc == NULL || status == NULL || max_count <= 0) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&Dem_Lock);
+    int count = (event_count < max_count) ? event_count : max_count;
+    for (int i = 0; i < count; i++) {
+        dtc[i] = diagnostic_events[i].dtc;
+        status[i] = diagnostic_events[i].status_byte & DEM_DTC_STATUS_AVAILABILITY_MASK;
+    }
+    pthread_mutex_unlock(&Dem_Lock);
+    return count;
+}
+
+// Đếm số DTC có trạng thái khớp với mặt nạ
+uint16_t Dem_GetNumberOfFilteredDtc(uint8_t status_mask) {
+    uint16_t count = 0;
+    uint8_t mask = status_mask & DEM_DTC_STATUS_AVAILABILITY_MASK;
+
+    pthread_mutex_lock(&Dem_Lock);
+    for (int i = 0; i < event_count; i++) {
+        if ((diagnostic_events[i].status_byte & mask) != 0) {
+            count++;
+        }
+    }
+    pthread_mutex_unlock(&Dem_Lock);
+    return count;
+}
+
+// Xóa DTC khỏi bộ nhớ lỗi, dồn các sự kiện còn lại để mảng luôn liên tục
+Std_ReturnType Dem_ClearDtc(uint32_t dtc_group) {
+    int kept = 0;
+    int found = 0;
+
+    pthread_mutex_lock(&Dem_Lock);
+    for (int i = 0; i < event_count; i++) {
+        if (dtc_group == DEM_DTC_GROUP_ALL_DTCS || diagnostic_events[i].dtc == dtc_group) {
+            found = 1;
+            continue;
+        }
+        if (kept != i) {
+            diagnostic_events[kept] = diagnostic_events[i];
+        }
+        kept++;
+    }
+
+    if (!found && dtc_group != DEM_DTC_GROUP_ALL_DTCS) {
+        pthread_mutex_unlock(&Dem_Lock);
+        return E_NOT_OK;  // DTC không tồn tại
+    }
+
+    for (int i = kept; i < event_count; i++) {
+        diagnostic_events[i].event_id = -1;
+        diagnostic_events[i].is_active = 0;
+        diagnostic_events[i].dtc = 0;
+        diagnostic_events[i].status_byte = 0;
+        diagnostic_events[i].event_description[0] = '\0';
+    }
+    event_count = kept;
+    pthread_mutex_unlock(&Dem_Lock);
+    return E_OK;
 }
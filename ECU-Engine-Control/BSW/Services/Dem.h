@@ -3,17 +3,45 @@
 
 #include <stdio.h>
 #include <string.h>
+#include "Std_Types.h"
 
 // Số lượng sự kiện chẩn đoán tối đa có thể theo dõi
 #define MAX_DIAGNOSTIC_EVENTS 10
 
+// Các bit trạng thái DTC theo ISO 14229-1 (statusOfDTC)
+#define DEM_UDS_STATUS_TF       0x01U  // testFailed
+#define DEM_UDS_STATUS_TFTOC    0x02U  // testFailedThisOperationCycle
+#define DEM_UDS_STATUS_PDTC     0x04U  // pendingDTC
+#define DEM_UDS_STATUS_CDTC     0x08U  // confirmedDTC
+#define DEM_UDS_STATUS_TNCSLC   0x10U  // testNotCompletedSinceLastClear
+#define DEM_UDS_STATUS_TFSLC    0x20U  // testFailedSinceLastClear
+#define DEM_UDS_STATUS_TNCTOC   0x40U  // testNotCompletedThisOperationCycle
+#define DEM_UDS_STATUS_WIR      0x80U  // warningIndicatorRequested
+
+// Các bit trạng thái mà DEM hỗ trợ (DTCStatusAvailabilityMask)
+#define DEM_DTC_STATUS_AVAILABILITY_MASK \
+    (DEM_UDS_STATUS_TF | DEM_UDS_STATUS_TFTOC | DEM_UDS_STATUS_PDTC | \
+     DEM_UDS_STATUS_CDTC | DEM_UDS_STATUS_TFSLC)
+
+// Nhóm DTC đại diện cho toàn bộ DTC (dùng cho ClearDiagnosticInformation)
+#define DEM_DTC_GROUP_ALL_DTCS 0xFFFFFFUL
+
+// Kết quả kiểm tra mà SWC báo cho một sự kiện chẩn đoán (qua RTE)
+typedef uint8_t Dem_EventStatusType;
+#define DEM_EVENT_STATUS_PASSED 0U  // Hết lỗi: xóa testFailed, DTC vẫn được lưu
+#define DEM_EVENT_STATUS_FAILED 1U  // Có lỗi: ghi sự kiện vào bộ nhớ lỗi
+
 // Cấu trúc mô phỏng sự kiện chẩn đoán
 typedef struct {
     int event_id;
     char event_description[50];
     int is_active;  // 1: active (có lỗi), 0: inactive (không có lỗi)
+    uint32_t dtc;         // Mã DTC 3 byte tương ứng với sự kiện
+    uint8_t status_byte;  // Byte trạng thái DTC theo ISO 14229-1
 } Dem_EventType;
 
+// Các API có thể được gọi đồng thời từ nhiều task (SWC báo sự kiện, DCM đọc và xóa DTC)
+
 // Khởi tạo hệ thống quản lý sự kiện chẩn đoán
 void Dem_Init(void);
 
@@ -29,4 +57,20 @@ int Dem_CheckErrorStatus(int event_id);
 // In toàn bộ danh sách sự kiện chẩn đoán
 void Dem_PrintEventList(void);
 
+// Số lượng sự kiện đang được lưu trong bộ nhớ lỗi
+int Dem_GetNumberOfEvents(void);
+
+// Lấy mã DTC và byte trạng thái của sự kiện thứ index (không in ra màn hình)
+Std_ReturnType Dem_GetDtcByIndex(int index, uint32_t* dtc, uint8_t* status);
+
+// Chụp tối đa max_count DTC và byte trạng thái trong một lần (không bị báo/xóa sự kiện chen giữa),
+// trả về số DTC đã chép
+int Dem_GetDtcSnapshot(uint32_t* dtc, uint8_t* status, int max_count);
+
+// Đếm số DTC có trạng thái khớp với mặt nạ (status & mask != 0)
+uint16_t Dem_GetNumberOfFilteredDtc(uint8_t status_mask);
+
+// Xóa DTC khỏi bộ nhớ lỗi (một DTC hoặc toàn bộ với DEM_DTC_GROUP_ALL_DTCS)
+Std_ReturnType Dem_ClearDtc(uint32_t dtc_group);
+
 #endif // DEM_H
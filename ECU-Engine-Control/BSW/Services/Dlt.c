@@ -0,0 +1,197 @@
+#include "Dlt.h"
+#include "Os.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Danh mục thông điệp: mã ngữ cảnh và chuỗi định dạng theo ID
+#define DLT_MESSAGE_CONTEXT(Name, Context, Format) [Name] = Context,
+#define DLT_MESSAGE_FORMAT(Name, Context, Format) [Name] = Format,
+static const char* const Dlt_MessageContext[DLT_NUM_MESSAGES] = { DLT_MESSAGE_LIST(DLT_MESSAGE_CONTEXT) };
+static const char* const Dlt_MessageFormat[DLT_NUM_MESSAGES] = { DLT_MESSAGE_LIST(DLT_MESSAGE_FORMAT) };
+#undef DLT_MESSAGE_CONTEXT
+#undef DLT_MESSAGE_FORMAT
+
+static const char* const Dlt_LevelName[] = { "OFF", "FATAL", "ERROR", "WARN", "INFO", "DEBUG", "VERB" };
+
+// Bộ đệm theo task: được cấp ở lần log đầu tiên của task
+static Dlt_RingType Dlt_Ring[DLT_MAX_THREADS];
+static atomic_uint Dlt_ThreadCount;
+static _Thread_local Dlt_RingType* Dlt_ThreadRing = NULL;
+
+// Vùng làm việc của task log: toàn bộ bản ghi của một lần xử lý
+static Dlt_RecordType Dlt_Batch[DLT_MAX_THREADS * DLT_RING_SIZE];
+static uint64_t Dlt_StartNs;
+
+// Khởi tạo dịch vụ log
+void Dlt_Init(void) {
+    Dlt_StartNs = Os_GetTimeNs();
+}
+
+// Gán bộ đệm cho task hiện tại; NULL khi đã hết bộ đệm
+static Dlt_RingType* Dlt_AttachThread(void) {
+    if (atomic_load_explicit(&Dlt_ThreadCount, memory_order_relaxed) >= DLT_MAX_THREADS) {
+        return NULL;
+    }
+    unsigned int index = atomic_fetch_add_explicit(&Dlt_ThreadCount, 1U, memory_order_relaxed);
+    if (index >= DLT_MAX_THREADS) {
+        return NULL;
+    }
+    Dlt_ThreadRing = &Dlt_Ring[index];
+    return Dlt_ThreadRing;
+}
+
+// Ghi một bản ghi: không định dạng, không khóa, không chờ
+void Dlt_Log(Dlt_MessageIdType MessageId, uint8_t Level, const Dlt_ArgType* Args, uint8_t ArgCount) {
+    Dlt_RingType* ring = Dlt_ThreadRing;
+    if (ring == NULL) {
+        ring = Dlt_AttachThread();
+        if (ring == NULL) {
+            return;
+        }
+    }
+
+    unsigned int head = atomic_load_explicit(&ring->Head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&ring->Tail, memory_order_acquire) >= DLT_RING_SIZE) {
+        atomic_store_explicit(&ring->Dropped, atomic_load_explicit(&ring->Dropped, memory_order_relaxed) + 1U,
+                              memory_order_relaxed);
+        return;
+    }
+
+    Dlt_RecordType* record = &ring->Record[head & (DLT_RING_SIZE - 1U)];
+    if (ArgCount > DLT_MAX_ARGS) {
+        ArgCount = DLT_MAX_ARGS;
+    }
+    record->TimestampNs = Os_GetTimeNs();
+    record->MessageId = (uint16_t)MessageId;
+    record->Level = Level;
+    record->ArgCount = ArgCount;
+    record->ArgTypes = 0U;
+    for (uint8_t i = 0; i < ArgCount; i++) {
+        record->ArgTypes |= (uint32_t)(Args[i].Type & 0x0FU) << (4U * i);
+        record->Arg[i] = Args[i].Value;
+    }
+    atomic_store_explicit(&ring->Head, head + 1U, memory_order_release);
+}
+
+// Định dạng một đối số theo đặc tả; giá trị số được đổi sang kiểu mà đặc tả yêu cầu
+static int Dlt_FormatArg(char* Buffer, size_t Size, const char* Spec, char Conversion,
+                         uint8_t Type, Dlt_ArgValueType Value) {
+    if (Conversion == 's') {
+        if (Type != DLT_TYPE_STR) {
+            return snprintf(Buffer, Size, "<?>");
+        }
+        return snprintf(Buffer, Size, Spec, (Value.Str != NULL) ? Value.Str : "(null)");
+    }
+    if (Type == DLT_TYPE_STR || Type == DLT_TYPE_NONE) {
+        return snprintf(Buffer, Size, "<?>");
+    }
+
+    double number = (Type == DLT_TYPE_F32) ? (double)Value.F32
+                  : (Type == DLT_TYPE_I32) ? (double)Value.I32 : (double)Value.U32;
+    if (strchr("fFeEgG", Conversion) != NULL) {
+        return snprintf(Buffer, Size, Spec, number);
+    }
+    if (Conversion == 'd' || Conversion == 'i') {
+        return snprintf(Buffer, Size, Spec, (Type == DLT_TYPE_I32) ? (int)Value.I32 : (int)number);
+    }
+    return snprintf(Buffer, Size, Spec, (Type == DLT_TYPE_U32) ? (unsigned int)Value.U32 : (unsigned int)(int)number);
+}
+
+// Giải mã một bản ghi theo chuỗi định dạng trong danh mục
+static void Dlt_FormatMessage(const Dlt_RecordType* Record, char* Buffer, size_t Size) {
+    const char* format = (Record->MessageId < DLT_NUM_MESSAGES) ? Dlt_MessageFormat[Record->MessageId] : "<?>";
+    size_t pos = 0;
+    uint8_t arg = 0;
+
+    while (*format != '\0' && pos + 1U < Size) {
+        if (*format != '%') {
+            Buffer[pos++] = *format++;
+            continue;
+        }
+        if (format[1] == '%') {
+            Buffer[pos++] = '%';
+            format += 2;
+            continue;
+        }
+
+        // Sao chép đặc tả (cờ, độ rộng, độ chính xác) tới ký tự chuyển đổi
+        char spec[16];
+        size_t length = 0;
+        do {
+            if (length < sizeof(spec) - 2U) {
+                spec[length++] = *format;
+            }
+            format++;
+        } while (*format != '\0' && strchr("diuxXfFeEgGs", *format) == NULL);
+        if (*format == '\0') {
+            break;
+        }
+        char conversion = *format++;
+        spec[length++] = conversion;
+        spec[length] = '\0';
+
+        uint8_t type = DLT_TYPE_NONE;
+        Dlt_ArgValueType value = { .U32 = 0U };
+        if (arg < Record->ArgCount) {
+            type = (uint8_t)((Record->ArgTypes >> (4U * arg)) & 0x0FU);
+            value = Record->Arg[arg];
+            arg++;
+        }
+        int written = Dlt_FormatArg(&Buffer[pos], Size - pos, spec, conversion, type, value);
+        if (written > 0) {
+            pos += ((size_t)written < Size - pos) ? (size_t)written : (Size - pos - 1U);
+        }
+    }
+    Buffer[pos] = '\0';
+}
+
+static int Dlt_CompareTimestamp(const void* a, const void* b) {
+    uint64_t ta = ((const Dlt_RecordType*)a)->TimestampNs;
+    uint64_t tb = ((const Dlt_RecordType*)b)->TimestampNs;
+    return (ta > tb) - (ta < tb);
+}
+
+// Task log: lấy bản ghi, sắp xếp theo thời điểm và ghi ra stdout
+void Dlt_MainFunction(void) {
+    size_t count = 0;
+    unsigned int threads = atomic_load_explicit(&Dlt_ThreadCount, memory_order_relaxed);
+    if (threads > DLT_MAX_THREADS) {
+        threads = DLT_MAX_THREADS;
+    }
+
+    for (unsigned int t = 0; t < threads; t++) {
+        Dlt_RingType* ring = &Dlt_Ring[t];
+        unsigned int tail = atomic_load_explicit(&ring->Tail, memory_order_relaxed);
+        unsigned int head = atomic_load_explicit(&ring->Head, memory_order_acquire);
+        for (; tail != head; tail++) {
+            Dlt_Batch[count++] = ring->Record[tail & (DLT_RING_SIZE - 1U)];
+        }
+        // Trả ô lại cho task ghi trước khi định dạng
+        atomic_store_explicit(&ring->Tail, tail, memory_order_release);
+
+        unsigned int dropped = atomic_load_explicit(&ring->Dropped, memory_order_relaxed);
+        if (dropped != ring->DroppedReported) {
+            printf("DLT: %u bản ghi bị bỏ do bộ đệm của task %u đầy.\n", dropped - ring->DroppedReported, t);
+            ring->DroppedReported = dropped;
+        }
+    }
+    if (count == 0U) {
+        return;
+    }
+
+    // Các task ghi vào bộ đệm riêng nên cần sắp xếp lại để giữ thứ tự thời gian
+    qsort(Dlt_Batch, count, sizeof(Dlt_RecordType), Dlt_CompareTimestamp);
+
+    char message[256];
+    for (size_t i = 0; i < count; i++) {
+        const Dlt_RecordType* record = &Dlt_Batch[i];
+        Dlt_FormatMessage(record, message, sizeof(message));
+        printf("%10.6f %-4s %-5s %s\n",
+               (double)(int64_t)(record->TimestampNs - Dlt_StartNs) / 1e9,
+               (record->MessageId < DLT_NUM_MESSAGES) ? Dlt_MessageContext[record->MessageId] : "----",
+               (record->Level <= DLT_LEVEL_VERBOSE) ? Dlt_LevelName[record->Level] : "?",
+               message);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,143 @@
+#ifndef DLT_H
+#define DLT_H
+
+#include <stdatomic.h>
+#include "Std_Types.h"
+#include "Dlt_Cfg.h"
+
+// Dịch vụ log bất đồng bộ kiểu DLT (Diagnostic Log and Trace). Nơi gọi không định
+// dạng chuỗi: chỉ ghi ID thông điệp, mức log và các đối số nhị phân vào bộ đệm vòng
+// riêng của task (một task ghi, một task đọc, không khóa). Task log định kỳ lấy các
+// bản ghi, sắp xếp theo thời điểm và định dạng theo danh mục trong Dlt_Cfg.h.
+
+// Mức log
+#define DLT_LEVEL_OFF      0U
+#define DLT_LEVEL_FATAL    1U
+#define DLT_LEVEL_ERROR    2U
+#define DLT_LEVEL_WARN     3U
+#define DLT_LEVEL_INFO     4U
+#define DLT_LEVEL_DEBUG    5U
+#define DLT_LEVEL_VERBOSE  6U
+
+// Mức log tối đa được biên dịch; các lệnh log mức cao hơn bị loại bỏ hoàn toàn
+// (đối số không được tính, không sinh mã). Có thể ghi đè khi biên dịch, ví dụ -DDLT_LOG_LEVEL=DLT_LEVEL_DEBUG
+#ifndef DLT_LOG_LEVEL
+#define DLT_LOG_LEVEL DLT_LEVEL_INFO
+#endif
+
+#define DLT_MAX_ARGS           6U     // Số đối số tối đa của một thông điệp
+#define DLT_RING_SIZE          512U   // Số bản ghi mỗi bộ đệm (lũy thừa của 2)
+#define DLT_MAX_THREADS        8U     // Số task tối đa được log
+#define DLT_MAIN_FUNCTION_PERIOD_MS 20U  // Chu kỳ của task log (ms)
+
+// ID thông điệp, sinh từ danh mục
+#define DLT_MESSAGE_ID(Name, Context, Format) Name,
+typedef enum {
+    DLT_MESSAGE_LIST(DLT_MESSAGE_ID)
+    DLT_NUM_MESSAGES
+} Dlt_MessageIdType;
+#undef DLT_MESSAGE_ID
+
+// Kiểu của đối số
+#define DLT_TYPE_NONE  0U
+#define DLT_TYPE_I32   1U
+#define DLT_TYPE_U32   2U
+#define DLT_TYPE_F32   3U
+#define DLT_TYPE_STR   4U   // Chỉ dùng chuỗi tồn tại lâu dài (hằng chuỗi, bộ đệm tĩnh)
+
+typedef union {
+    int32_t I32;
+    uint32_t U32;
+    float F32;
+    const char* Str;
+} Dlt_ArgValueType;
+
+// Đối số tại nơi gọi
+typedef struct {
+    uint8_t Type;
+    Dlt_ArgValueType Value;
+} Dlt_ArgType;
+
+// Bản ghi trong bộ đệm (64 byte)
+typedef struct {
+    uint64_t TimestampNs;           // Thời điểm ghi (Os_GetTimeNs)
+    uint16_t MessageId;
+    uint8_t Level;
+    uint8_t ArgCount;
+    uint32_t ArgTypes;              // 4 bit cho mỗi đối số
+    Dlt_ArgValueType Arg[DLT_MAX_ARGS];
+} Dlt_RecordType;
+
+// Bộ đệm vòng của một task; Head do task sở hữu ghi, Tail do task log ghi
+typedef struct {
+    Dlt_RecordType Record[DLT_RING_SIZE];
+    _Alignas(64) atomic_uint Head;
+    atomic_uint Dropped;            // Số bản ghi bị bỏ do bộ đệm đầy
+    _Alignas(64) atomic_uint Tail;
+    unsigned int DroppedReported;   // Số bản ghi bỏ đã báo (task log)
+} Dlt_RingType;
+
+// Tạo đối số có kiểu
+#define DLT_I32(v)  ((Dlt_ArgType){ DLT_TYPE_I32, { .I32 = (int32_t)(v) } })
+#define DLT_U32(v)  ((Dlt_ArgType){ DLT_TYPE_U32, { .U32 = (uint32_t)(v) } })
+#define DLT_F32(v)  ((Dlt_ArgType){ DLT_TYPE_F32, { .F32 = (float)(v) } })
+#define DLT_STR(s)  ((Dlt_ArgType){ DLT_TYPE_STR, { .Str = (s) } })
+
+// Phần tử đầu giả để danh sách đối số rỗng vẫn hợp lệ
+#define DLT_LOG_(Level, MessageId, ...) \
+    do { \
+        const Dlt_ArgType dltArgs_[] = { { DLT_TYPE_NONE, { .U32 = 0U } }, __VA_ARGS__ }; \
+        Dlt_Log((MessageId), (Level), &dltArgs_[1], (uint8_t)(sizeof(dltArgs_) / sizeof(dltArgs_[0]) - 1U)); \
+    } while (0)
+
+// Lệnh log bị loại bỏ: đối số vẫn được kiểm tra kiểu nhưng không được tính
+#define DLT_LOG_DISABLED_(MessageId, ...) \
+    do { \
+        if (0) { \
+            DLT_LOG_(DLT_LEVEL_OFF, MessageId, __VA_ARGS__); \
+        } \
+    } while (0)
+
+// Lệnh log theo mức, ví dụ DLT_LOG_INFO(DLT_MSG_TC_SPEED, DLT_F32(speed))
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_FATAL)
+#define DLT_LOG_FATAL(MessageId, ...)   DLT_LOG_(DLT_LEVEL_FATAL, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_FATAL(MessageId, ...)   DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_ERROR)
+#define DLT_LOG_ERROR(MessageId, ...)   DLT_LOG_(DLT_LEVEL_ERROR, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_ERROR(MessageId, ...)   DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_WARN)
+#define DLT_LOG_WARN(MessageId, ...)    DLT_LOG_(DLT_LEVEL_WARN, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_WARN(MessageId, ...)    DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_INFO)
+#define DLT_LOG_INFO(MessageId, ...)    DLT_LOG_(DLT_LEVEL_INFO, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_INFO(MessageId, ...)    DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_DEBUG)
+#define DLT_LOG_DEBUG(MessageId, ...)   DLT_LOG_(DLT_LEVEL_DEBUG, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_DEBUG(MessageId, ...)   DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+#if (DLT_LOG_LEVEL >= DLT_LEVEL_VERBOSE)
+#define DLT_LOG_VERBOSE(MessageId, ...) DLT_LOG_(DLT_LEVEL_VERBOSE, MessageId, __VA_ARGS__)
+#else
+#define DLT_LOG_VERBOSE(MessageId, ...) DLT_LOG_DISABLED_(MessageId, __VA_ARGS__)
+#endif
+
+// Khởi tạo dịch vụ log (mốc thời gian của đầu ra); các lệnh log trước đó vẫn được giữ
+void Dlt_Init(void);
+
+// Ghi một bản ghi vào bộ đệm của task hiện tại; bỏ bản ghi khi bộ đệm đầy.
+// Nên dùng qua các macro DLT_LOG_<mức>
+void Dlt_Log(Dlt_MessageIdType MessageId, uint8_t Level, const Dlt_ArgType* Args, uint8_t ArgCount);
+
+// Task log: lấy bản ghi từ mọi bộ đệm, sắp xếp theo thời điểm, định dạng và ghi ra stdout
+void Dlt_MainFunction(void);
+
+#endif // DLT_H
@@ -0,0 +1,79 @@
+#ifndef DLT_CFG_H
+#define DLT_CFG_H
+
+// Danh mục thông điệp log (chế độ non-verbose): mỗi thông điệp có ID tĩnh, mã ngữ
+// cảnh 4 ký tự và chuỗi định dạng. Nơi gọi chỉ lưu ID và các đối số nhị phân; chuỗi
+// định dạng chỉ được dùng bởi task log khi giải mã.
+// Đặc tả định dạng phải khớp kiểu đối số: %d/%i (DLT_I32), %u/%x/%X (DLT_U32),
+// %f/%e/%g (DLT_F32), %s (DLT_STR); không dùng tiền tố độ dài (l, h).
+//
+// X(Tên, Ngữ cảnh, Định dạng)
+#define DLT_MESSAGE_LIST(X) \
+    /* SWC Torque Control */ \
+    X(DLT_MSG_TC_INIT,                "TCTL", "Khởi tạo hệ thống Torque Control...") \
+    X(DLT_MSG_TC_READY,               "TCTL", "Hệ thống Torque Control đã sẵn sàng.") \
+    X(DLT_MSG_TC_SENSORS_INIT_OK,     "TCTL", "Các cảm biến analog đã khởi tạo thành công.") \
+    X(DLT_MSG_TC_SENSORS_INIT_FAILED, "TCTL", "Lỗi khi khởi tạo các cảm biến analog.") \
+    X(DLT_MSG_TC_MOTOR_INIT_OK,       "TCTL", "Bộ điều khiển mô-men xoắn đã khởi tạo thành công.") \
+    X(DLT_MSG_TC_MOTOR_INIT_FAILED,   "TCTL", "Lỗi khi khởi tạo bộ điều khiển mô-men xoắn.") \
+    X(DLT_MSG_TC_CALIBRATION_LOADED,  "TCTL", "Đã nạp hiệu chuẩn: mô-men tối đa %.1f Nm, Kp %.3f, Ki %.2f 1/s, giới hạn %.0f Nm/s.") \
+    X(DLT_MSG_TC_CALIBRATION_FAILED,  "TCTL", "Lỗi khi đọc hiệu chuẩn Torque Control.") \
+    X(DLT_MSG_TC_CALIBRATION_INVALID, "TCTL", "Hệ số vòng kín mô-men không hợp lệ, giữ hiệu chuẩn đang dùng.") \
+    X(DLT_MSG_TC_TORQUE_MAP_INVALID,  "TCTL", "Điểm chia của bản đồ mô-men hoặc đường cong bù tải không tăng dần, giữ hiệu chuẩn đang dùng.") \
+    X(DLT_MSG_TC_UNCALIBRATED,        "TCTL", "Chưa có hiệu chuẩn hợp lệ: mô-men yêu cầu bằng 0 đến khi nạp lại được hiệu chuẩn.") \
+    X(DLT_MSG_TC_NO_SCRATCH,          "TCTL", "Lỗi: không đủ bộ nhớ tạm cho chu kỳ Torque Control!") \
+    X(DLT_MSG_TC_SENSOR_STALE,        "TCTL", "Cảm biến %s quá cũ (%u ms), dùng giá trị thay thế %.2f.") \
+    X(DLT_MSG_TC_SENSOR_NO_DATA,      "TCTL", "Cảm biến %s chưa có dữ liệu, dùng giá trị thay thế %.2f.") \
+    X(DLT_MSG_TC_THROTTLE,            "TCTL", "Giá trị bàn đạp ga: %.2f%%") \
+    X(DLT_MSG_TC_SPEED,               "TCTL", "Tốc độ xe hiện tại: %.2f km/h") \
+    X(DLT_MSG_TC_TORQUE_SENT,         "TCTL", "Đã gửi mô-men xoắn yêu cầu tới động cơ.") \
+    X(DLT_MSG_TC_TORQUE_SEND_FAILED,  "TCTL", "Lỗi khi gửi mô-men xoắn tới động cơ!") \
+    X(DLT_MSG_TC_CONTROL_STEP,        "TCTL", "Vòng mô-men: yêu cầu %.2f Nm, thực tế %.2f Nm, lệnh %.2f Nm") \
+    X(DLT_MSG_TC_SENSOR_RESTORED,     "TCTL", "Cảm biến %s hoạt động trở lại.") \
+    X(DLT_MSG_TC_TRACKING_FAULT,      "TCTL", "Mô-men không bám lệnh: lệnh %.2f Nm, thực tế %.2f Nm.") \
+    X(DLT_MSG_TC_TRACKING_RECOVERED,  "TCTL", "Mô-men đã bám lệnh trở lại.") \
+    X(DLT_MSG_TC_STATUS,              "TCTL", "Trạng thái: yêu cầu %.2f Nm, lệnh %.2f Nm, thực tế %.2f Nm, tải trọng %.0f kg") \
+    /* IoHwAb */ \
+    X(DLT_MSG_IOHWAB_SENSOR_NULL_CONFIG,   "IOHW", "Error: Null configuration pointer passed to IoHwAb_AnalogSensor_Init.") \
+    X(DLT_MSG_IOHWAB_SENSOR_BAD_LIMITS,    "IOHW", "Error: Invalid limits for analog sensor %d.") \
+    X(DLT_MSG_IOHWAB_SENSOR_BAD_CURVE,     "IOHW", "Error: Invalid characteristic curve for analog sensor %d.") \
+    X(DLT_MSG_IOHWAB_SENSOR_BAD_FILTER,    "IOHW", "Error: Invalid filter configuration for analog sensor %d.") \
+    X(DLT_MSG_IOHWAB_SENSORS_INIT,         "IOHW", "Analog Sensors Initialized: %d channels") \
+    X(DLT_MSG_IOHWAB_ADC_GROUP_FAILED,     "IOHW", "Error: Failed to read ADC group.") \
+    X(DLT_MSG_IOHWAB_MOTOR_NULL_CONFIG,    "IOHW", "Error: Null configuration pointer passed to IoHwAb_MotorDriver_Init.") \
+    X(DLT_MSG_IOHWAB_MOTOR_BAD_MAX_TORQUE, "IOHW", "Error: Motor max torque must be greater than 0.") \
+    X(DLT_MSG_IOHWAB_MOTOR_BAD_CHANNELS,   "IOHW", "Error: Motor PWM channels %u..%u out of range.") \
+    X(DLT_MSG_IOHWAB_MOTOR_INIT,           "IOHW", "Motor Driver Initialized: PWM channels %u, %u, %u, max torque %u Nm, PWM %u Hz") \
+    X(DLT_MSG_IOHWAB_MOTOR_FOC_CYCLE,      "IOHW", "FOC cycle: %u ns average (%u%% of %u ns PWM period), %u ns worst case") \
+    X(DLT_MSG_IOHWAB_MOTOR_FOC_TOO_SLOW,   "IOHW", "Error: FOC cycle does not fit: average above half or worst case above the PWM period.") \
+    X(DLT_MSG_IOHWAB_TORQUE_OUT_OF_RANGE,  "IOHW", "Error: Torque value %.2f Nm out of range (Max: %u Nm).") \
+    X(DLT_MSG_IOHWAB_SET_TORQUE,           "IOHW", "Setting Motor Torque to %.2f Nm on Channels %u-%u (Iq ref %d)") \
+    /* MCAL */ \
+    X(DLT_MSG_ADC_NULL_CONFIG,        "ADC",  "Error: Null configuration pointer passed to Adc_Init.") \
+    X(DLT_MSG_ADC_INIT,               "ADC",  "ADC Initialized: channel %u, sampling rate %u Hz, resolution %u-bit") \
+    X(DLT_MSG_ADC_READ_CHANNEL,       "ADC",  "Reading ADC Channel %u: Value = %u") \
+    X(DLT_MSG_CAN_INIT,               "CAN",  "CAN Initialized.") \
+    X(DLT_MSG_CAN_SENT,               "CAN",  "CAN Message Sent: ID: %u, Data Length: %u, Data: %08X %08X") \
+    X(DLT_MSG_CAN_RECEIVED,           "CAN",  "CAN Message Received: ID: %u, Data Length: %u, Data: %08X %08X") \
+    X(DLT_MSG_PWM_INIT,               "PWM",  "PWM Initialized for Channel %u with Period %u ticks and compare %u ticks") \
+    X(DLT_MSG_PWM_SET_DUTY,           "PWM",  "PWM Channel %u set to compare %u ticks") \
+    X(DLT_MSG_DIO_INIT,               "DIO",  "DIO Initialized.") \
+    X(DLT_MSG_DIO_READ,               "DIO",  "Reading DIO Channel %d: Value = %d") \
+    X(DLT_MSG_DIO_WRITE,              "DIO",  "Writing DIO Channel %d: Value = %d") \
+    /* Services */ \
+    X(DLT_MSG_DEM_INIT,               "DEM",  "Diagnostic Event Manager (DEM) Initialized.") \
+    X(DLT_MSG_DEM_MEMORY_FULL,        "DEM",  "Cannot report more events. Maximum diagnostic events reached.") \
+    X(DLT_MSG_DEM_EVENT_REACTIVATED,  "DEM",  "Event ID %d already exists. Updating its status to active.") \
+    X(DLT_MSG_DEM_EVENT_REPORTED,     "DEM",  "New diagnostic event reported: ID = %d, Description = %s") \
+    X(DLT_MSG_DEM_EVENT_CLEARED,      "DEM",  "Event ID %d cleared (no longer active).") \
+    X(DLT_MSG_DEM_EVENT_ACTIVE,       "DEM",  "Event ID %d is active.") \
+    X(DLT_MSG_DEM_EVENT_INACTIVE,     "DEM",  "Event ID %d is inactive.") \
+    X(DLT_MSG_DEM_EVENT_NOT_FOUND,    "DEM",  "Event ID %d not found.") \
+    X(DLT_MSG_PDUR_INIT,              "PDUR", "PDU Router Initialized.") \
+    X(DLT_MSG_PDUR_ROUTE,             "PDUR", "Routing PDU: Protocol ID = 0x%x, Length = %d") \
+    X(DLT_MSG_PDUR_UNKNOWN_PROTOCOL,  "PDUR", "Unknown protocol ID: 0x%x") \
+    X(DLT_MSG_PDUR_CAN,               "PDUR", "Handling CAN PDU: Length = %d") \
+    X(DLT_MSG_PDUR_LIN,               "PDUR", "Handling LIN PDU: Length = %d") \
+    X(DLT_MSG_PDUR_ETHERNET,          "PDUR", "Handling Ethernet PDU: Length = %d")
+
+#endif // DLT_CFG_H
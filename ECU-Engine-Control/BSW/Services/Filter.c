@@ -0,0 +1,206 @@
+#include "Filter.h"
+
+// Số bit phần thập phân của nghịch đảo kích thước cửa sổ trong bộ lọc số nguyên. Tổng
+// FILTER_MAX_WINDOW mẫu int32 cần 35 bit nên tích với nghịch đảo Q27 vẫn nằm trong int64
+#define FILTER_INV_WINDOW_SHIFT 27
+
+static Std_ReturnType Filter_CheckConfig(const Filter_ConfigType* Config) {
+    if (Config == NULL) {
+        return E_NOT_OK;
+    }
+    switch (Config->Kind) {
+    case FILTER_NONE:
+        return E_OK;
+    case FILTER_IIR:
+        return (Config->Alpha > 0.0f && Config->Alpha <= 1.0f) ? E_OK : E_NOT_OK;
+    case FILTER_MOVING_AVERAGE:
+    case FILTER_MEDIAN:
+        return (Config->Window >= 1U && Config->Window <= FILTER_MAX_WINDOW) ? E_OK : E_NOT_OK;
+    default:
+        return E_NOT_OK;
+    }
+}
+
+// Thay giá trị Old trong mảng đã sắp xếp bằng New rồi dời New về đúng vị trí.
+// Mẫu thay đổi chậm chỉ cần dời vài phần tử
+static void Filter_ReplaceSortedF32(float* Sorted, uint8_t Count, float Old, float New) {
+    // Tìm nhị phân một vị trí chứa Old
+    uint8_t lo = 0U, hi = (uint8_t)(Count - 1U);
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2U);
+        if (Sorted[mid] < Old) {
+            lo = (uint8_t)(mid + 1U);
+        } else {
+            hi = mid;
+        }
+    }
+    uint8_t i = lo;
+    while (i > 0U && Sorted[i - 1U] > New) {
+        Sorted[i] = Sorted[i - 1U];
+        i--;
+    }
+    while (i + 1U < Count && Sorted[i + 1U] < New) {
+        Sorted[i] = Sorted[i + 1U];
+        i++;
+    }
+    Sorted[i] = New;
+}
+
+static void Filter_ReplaceSortedS32(int32_t* Sorted, uint8_t Count, int32_t Old, int32_t New) {
+    uint8_t lo = 0U, hi = (uint8_t)(Count - 1U);
+    while (lo < hi) {
+        uint8_t mid = (uint8_t)((lo + hi) / 2U);
+        if (Sorted[mid] < Old) {
+            lo = (uint8_t)(mid + 1U);
+        } else {
+            hi = mid;
+        }
+    }
+    uint8_t i = lo;
+    while (i > 0U && Sorted[i - 1U] > New) {
+        Sorted[i] = Sorted[i - 1U];
+        i--;
+    }
+    while (i + 1U < Count && Sorted[i + 1U] < New) {
+        Sorted[i] = Sorted[i + 1U];
+        i++;
+    }
+    Sorted[i] = New;
+}
+
+Std_ReturnType Filter_InitF32(Filter_StateF32Type* State, const Filter_ConfigType* Config) {
+    if (State == NULL || Filter_CheckConfig(Config) != E_OK) {
+        return E_NOT_OK;
+    }
+    State->Kind = Config->Kind;
+    State->Alpha = Config->Alpha;
+    State->Window = (Config->Kind == FILTER_MOVING_AVERAGE || Config->Kind == FILTER_MEDIAN) ? Config->Window : 1U;
+    State->InvWindow = 1.0f / (float)State->Window;
+    Filter_ResetF32(State);
+    return E_OK;
+}
+
+Std_ReturnType Filter_InitS32(Filter_StateS32Type* State, const Filter_ConfigType* Config) {
+    if (State == NULL || Filter_CheckConfig(Config) != E_OK) {
+        return E_NOT_OK;
+    }
+    State->Kind = Config->Kind;
+    State->AlphaQ15 = (Config->Kind == FILTER_IIR) ? (int32_t)(Config->Alpha * 32768.0f + 0.5f) : 0;
+    State->Window = (Config->Kind == FILTER_MOVING_AVERAGE || Config->Kind == FILTER_MEDIAN) ? Config->Window : 1U;
+    State->InvWindowQ27 = (int32_t)(((1LL << FILTER_INV_WINDOW_SHIFT) + State->Window / 2U) / State->Window);
+    Filter_ResetS32(State);
+    return E_OK;
+}
+
+void Filter_ResetF32(Filter_StateF32Type* State) {
+    State->Head = 0U;
+    State->Primed = 0U;
+    State->Sum = 0.0f;
+    State->Output = 0.0f;
+}
+
+void Filter_ResetS32(Filter_StateS32Type* State) {
+    State->Head = 0U;
+    State->Primed = 0U;
+    State->Sum = 0;
+    State->Output = 0;
+}
+
+float Filter_UpdateF32(Filter_StateF32Type* State, float Sample) {
+    // Mẫu đầu tiên nạp đầy cửa sổ
+    if (!State->Primed) {
+        for (uint8_t i = 0; i < State->Window; i++) {
+            State->Samples[i] = Sample;
+            State->Sorted[i] = Sample;
+        }
+        State->Sum = Sample * (float)State->Window;
+        State->Output = Sample;
+        State->Primed = 1U;
+        return Sample;
+    }
+
+    switch (State->Kind) {
+    case FILTER_IIR:
+        State->Output += State->Alpha * (Sample - State->Output);
+        break;
+
+    case FILTER_MOVING_AVERAGE:
+        State->Sum += Sample - State->Samples[State->Head];
+        State->Samples[State->Head] = Sample;
+        if (++State->Head == State->Window) {
+            State->Head = 0U;
+            // Mỗi vòng cửa sổ tính lại tổng một lần để sai số làm tròn không tích lũy
+            float sum = 0.0f;
+            for (uint8_t i = 0; i < State->Window; i++) {
+                sum += State->Samples[i];
+            }
+            State->Sum = sum;
+        }
+        State->Output = State->Sum * State->InvWindow;
+        break;
+
+    case FILTER_MEDIAN: {
+        uint8_t n = State->Window;
+        Filter_ReplaceSortedF32(State->Sorted, n, State->Samples[State->Head], Sample);
+        State->Samples[State->Head] = Sample;
+        if (++State->Head == n) {
+            State->Head = 0U;
+        }
+        State->Output = (n & 1U) ? State->Sorted[n / 2U]
+                                 : 0.5f * (State->Sorted[n / 2U - 1U] + State->Sorted[n / 2U]);
+        break;
+    }
+
+    default:
+        State->Output = Sample;
+        break;
+    }
+    return State->Output;
+}
+
+int32_t Filter_UpdateS32(Filter_StateS32Type* State, int32_t Sample) {
+    if (!State->Primed) {
+        for (uint8_t i = 0; i < State->Window; i++) {
+            State->Samples[i] = Sample;
+            State->Sorted[i] = Sample;
+        }
+        State->Sum = (int64_t)Sample * State->Window;
+        State->Output = Sample;
+        State->Primed = 1U;
+        return Sample;
+    }
+
+    switch (State->Kind) {
+    case FILTER_IIR:
+        State->Output += (int32_t)((((int64_t)Sample - State->Output) * State->AlphaQ15) >> 15);
+        break;
+
+    case FILTER_MOVING_AVERAGE:
+        State->Sum += (int64_t)Sample - State->Samples[State->Head];
+        State->Samples[State->Head] = Sample;
+        if (++State->Head == State->Window) {
+            State->Head = 0U;
+        }
+        // Nhân với nghịch đảo tính sẵn (làm tròn) thay cho phép chia 64 bit
+        State->Output = (int32_t)((State->Sum * State->InvWindowQ27 + (1LL << (FILTER_INV_WINDOW_SHIFT - 1)))
+                                  >> FILTER_INV_WINDOW_SHIFT);
+        break;
+
+    case FILTER_MEDIAN: {
+        uint8_t n = State->Window;
+        Filter_ReplaceSortedS32(State->Sorted, n, State->Samples[State->Head], Sample);
+        State->Samples[State->Head] = Sample;
+        if (++State->Head == n) {
+            State->Head = 0U;
+        }
+        State->Output = (n & 1U) ? State->Sorted[n / 2U]
+                                 : (int32_t)(((int64_t)State->Sorted[n / 2U - 1U] + State->Sorted[n / 2U]) / 2);
+        break;
+    }
+
+    default:
+        State->Output = Sample;
+        break;
+    }
+    return State->Output;
+}
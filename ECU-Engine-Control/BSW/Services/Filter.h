@@ -0,0 +1,67 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <stddef.h>
+#include "Std_Types.h"
+
+// Bộ lọc số cho tín hiệu cảm biến. Mỗi kênh cảm biến giữ một biến trạng thái
+// cấp phát tĩnh; tham số lấy từ cấu hình của kênh. Mẫu đầu tiên sau Init/Reset
+// được dùng để nạp đầy trạng thái nên bộ lọc không có giai đoạn khởi động.
+
+// Kích thước cửa sổ lớn nhất của bộ lọc trung bình trượt và trung vị
+#define FILTER_MAX_WINDOW 16U
+
+typedef enum {
+    FILTER_NONE = 0,            // Không lọc, đầu ra bằng đầu vào
+    FILTER_IIR,                 // Thông thấp bậc nhất: y += Alpha * (x - y)
+    FILTER_MOVING_AVERAGE,      // Trung bình Window mẫu gần nhất, tổng cộng dồn O(1)
+    FILTER_MEDIAN               // Trung vị Window mẫu gần nhất, mảng sắp xếp dạng vòng
+} Filter_KindType;
+
+typedef struct {
+    Filter_KindType Kind;
+    float Alpha;                // Hệ số IIR trong (0, 1]
+    uint8_t Window;             // Số mẫu của trung bình trượt / trung vị (1..FILTER_MAX_WINDOW)
+} Filter_ConfigType;
+
+// Trạng thái bộ lọc dấu phẩy động
+typedef struct {
+    Filter_KindType Kind;
+    float Alpha;
+    float InvWindow;            // 1 / Window, tính sẵn khi khởi tạo
+    uint8_t Window;
+    uint8_t Head;               // Vị trí của mẫu cũ nhất trong Samples
+    uint8_t Primed;             // 1 khi đã nhận mẫu đầu tiên
+    float Samples[FILTER_MAX_WINDOW];  // Các mẫu theo thứ tự thời gian (vòng)
+    float Sorted[FILTER_MAX_WINDOW];   // Các mẫu trong cửa sổ đã sắp xếp (trung vị)
+    float Sum;                  // Tổng các mẫu trong cửa sổ (trung bình trượt)
+    float Output;
+} Filter_StateF32Type;
+
+// Trạng thái bộ lọc số nguyên (ví dụ Q16.16); Alpha được đổi sang Q15 khi khởi tạo
+typedef struct {
+    Filter_KindType Kind;
+    int32_t AlphaQ15;
+    int32_t InvWindowQ27;       // 1 / Window dạng Q27, tính sẵn khi khởi tạo (không chia khi cập nhật)
+    uint8_t Window;
+    uint8_t Head;
+    uint8_t Primed;
+    int32_t Samples[FILTER_MAX_WINDOW];
+    int32_t Sorted[FILTER_MAX_WINDOW];
+    int64_t Sum;                // Tổng chính xác, không bị trôi như tổng dấu phẩy động
+    int32_t Output;
+} Filter_StateS32Type;
+
+// Khởi tạo trạng thái từ cấu hình; E_NOT_OK nếu tham số không hợp lệ
+Std_ReturnType Filter_InitF32(Filter_StateF32Type* State, const Filter_ConfigType* Config);
+Std_ReturnType Filter_InitS32(Filter_StateS32Type* State, const Filter_ConfigType* Config);
+
+// Xóa lịch sử, mẫu tiếp theo sẽ nạp lại toàn bộ trạng thái
+void Filter_ResetF32(Filter_StateF32Type* State);
+void Filter_ResetS32(Filter_StateS32Type* State);
+
+// Đưa một mẫu mới qua bộ lọc và trả về giá trị đã lọc
+float Filter_UpdateF32(Filter_StateF32Type* State, float Sample);
+int32_t Filter_UpdateS32(Filter_StateS32Type* State, int32_t Sample);
+
+#endif
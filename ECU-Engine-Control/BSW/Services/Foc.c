@@ -0,0 +1,127 @@
+#include "Foc.h"
+#include <math.h>
+
+// Bảng sin một vòng, thêm một phần tử cuối để nội suy không phải quay vòng chỉ số
+static int16_t Foc_SinTable[FOC_SIN_TABLE_SIZE + 1U];
+
+// Bão hòa về phạm vi int16
+static inline int16_t Foc_Sat16(int32_t X) {
+    X = (X > FOC_Q15_ONE) ? FOC_Q15_ONE : X;
+    X = (X < FOC_Q15_MIN) ? FOC_Q15_MIN : X;
+    return (int16_t)X;
+}
+
+void Foc_Init(void) {
+    for (uint32_t i = 0; i <= FOC_SIN_TABLE_SIZE; i++) {
+        double angle = 2.0 * 3.14159265358979323846 * (double)i / (double)FOC_SIN_TABLE_SIZE;
+        Foc_SinTable[i] = (int16_t)lround(sin(angle) * (double)FOC_Q15_ONE);
+    }
+}
+
+void Foc_Reset(Foc_StateType* State) {
+    State->PiD.Integral = 0;
+    State->PiQ.Integral = 0;
+    State->Id = 0;
+    State->Iq = 0;
+    State->Vd = 0;
+    State->Vq = 0;
+}
+
+// Tra bảng với các bit cao của góc, nội suy tuyến tính với các bit thấp
+static inline int16_t Foc_Sin(uint16_t Angle) {
+    uint32_t index = (uint32_t)Angle >> (16U - FOC_SIN_TABLE_BITS);
+    int32_t frac = (int32_t)(Angle & ((1U << (16U - FOC_SIN_TABLE_BITS)) - 1U));
+    int32_t s0 = Foc_SinTable[index];
+    int32_t s1 = Foc_SinTable[index + 1U];
+    return (int16_t)(s0 + (((s1 - s0) * frac) >> (16U - FOC_SIN_TABLE_BITS)));
+}
+
+void Foc_SinCos(uint16_t Angle, int16_t* Sin, int16_t* Cos) {
+    *Sin = Foc_Sin(Angle);
+    *Cos = Foc_Sin((uint16_t)(Angle + 0x4000U));  // cos(x) = sin(x + 90 độ)
+}
+
+void Foc_Clarke(int16_t Ia, int16_t Ib, int16_t* Alpha, int16_t* Beta) {
+    *Alpha = Ia;
+    *Beta = Foc_Sat16((((int32_t)Ia + 2 * (int32_t)Ib) * FOC_Q15_INV_SQRT3) >> 15);
+}
+
+void Foc_Park(int16_t Alpha, int16_t Beta, int16_t Sin, int16_t Cos, int16_t* D, int16_t* Q) {
+    *D = Foc_Sat16(((int32_t)Alpha * Cos + (int32_t)Beta * Sin) >> 15);
+    *Q = Foc_Sat16(((int32_t)Beta * Cos - (int32_t)Alpha * Sin) >> 15);
+}
+
+void Foc_InvPark(int16_t D, int16_t Q, int16_t Sin, int16_t Cos, int16_t* Alpha, int16_t* Beta) {
+    *Alpha = Foc_Sat16(((int32_t)D * Cos - (int32_t)Q * Sin) >> 15);
+    *Beta = Foc_Sat16(((int32_t)D * Sin + (int32_t)Q * Cos) >> 15);
+}
+
+int16_t Foc_PiStep(Foc_PiType* Pi, int16_t Reference, int16_t Measurement) {
+    int32_t error = (int32_t)Reference - Measurement;
+    int32_t limit = (int32_t)Pi->Limit << FOC_PI_SHIFT;
+
+    // Chống bão hòa: tích phân không vượt quá giới hạn đầu ra
+    int32_t integral = Pi->Integral + Pi->Ki * error;
+    integral = (integral > limit) ? limit : integral;
+    integral = (integral < -limit) ? -limit : integral;
+    Pi->Integral = integral;
+
+    int32_t output = (Pi->Kp * error + integral) >> FOC_PI_SHIFT;
+    output = (output > Pi->Limit) ? Pi->Limit : output;
+    output = (output < -Pi->Limit) ? -Pi->Limit : output;
+    return (int16_t)output;
+}
+
+void Foc_Svm(int16_t Alpha, int16_t Beta, uint16_t Period, uint16_t Duty[3]) {
+    // Clarke ngược: điện áp pha so với điểm trung tính
+    int32_t halfAlpha = (int32_t)Alpha >> 1;
+    int32_t beta = ((int32_t)Beta * FOC_Q15_SQRT3_DIV2) >> 15;
+    int32_t v[3] = { Alpha, beta - halfAlpha, -beta - halfAlpha };
+
+    // Cộng thành phần thứ tự không để dịch điện áp về giữa dải (tương đương SVM)
+    int32_t max = v[0], min = v[0];
+    for (uint8_t i = 1; i < 3U; i++) {
+        max = (v[i] > max) ? v[i] : max;
+        min = (v[i] < min) ? v[i] : min;
+    }
+    int32_t offset = -((max + min) >> 1);
+
+    int32_t half = (int32_t)Period >> 1;
+    for (uint8_t i = 0; i < 3U; i++) {
+        int32_t duty = half + (((v[i] + offset) * (int32_t)Period) >> 15);
+        duty = (duty < 0) ? 0 : duty;
+        duty = (duty > (int32_t)Period) ? (int32_t)Period : duty;
+        Duty[i] = (uint16_t)duty;
+    }
+}
+
+void Foc_Step(Foc_StateType* State, int16_t Ia, int16_t Ib, uint16_t Angle, uint16_t Period, uint16_t Duty[3]) {
+    int16_t alpha, beta, sin, cos;
+
+    Foc_Clarke(Ia, Ib, &alpha, &beta);
+    Foc_SinCos(Angle, &sin, &cos);
+    Foc_Park(alpha, beta, sin, cos, &State->Id, &State->Iq);
+
+    State->Vd = Foc_PiStep(&State->PiD, State->IdRef, State->Id);
+    State->Vq = Foc_PiStep(&State->PiQ, State->IqRef, State->Iq);
+
+    Foc_InvPark(State->Vd, State->Vq, sin, cos, &alpha, &beta);
+    Foc_Svm(alpha, beta, Period, Duty);
+}
+
+void Foc_ClarkeBlock(const int16_t* restrict Ia, const int16_t* restrict Ib,
+                     int16_t* restrict Alpha, int16_t* restrict Beta, size_t Count) {
+    for (size_t i = 0; i < Count; i++) {
+        Alpha[i] = Ia[i];
+        Beta[i] = Foc_Sat16((((int32_t)Ia[i] + 2 * (int32_t)Ib[i]) * FOC_Q15_INV_SQRT3) >> 15);
+    }
+}
+
+void Foc_ParkBlock(const int16_t* restrict Alpha, const int16_t* restrict Beta,
+                   const int16_t* restrict Sin, const int16_t* restrict Cos,
+                   int16_t* restrict D, int16_t* restrict Q, size_t Count) {
+    for (size_t i = 0; i < Count; i++) {
+        D[i] = Foc_Sat16(((int32_t)Alpha[i] * Cos[i] + (int32_t)Beta[i] * Sin[i]) >> 15);
+        Q[i] = Foc_Sat16(((int32_t)Beta[i] * Cos[i] - (int32_t)Alpha[i] * Sin[i]) >> 15);
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef FOC_H
+#define FOC_H
+
+#include <stddef.h>
+#include "Std_Types.h"
+
+// Các khối tính toán của điều khiển định hướng từ trường (FOC) bằng số nguyên Q15:
+// biến đổi Clarke/Park, bộ điều chỉnh PI dòng điện và điều chế vector không gian (SVM).
+// Dòng điện và điện áp được chuẩn hóa: dòng 1.0 = dòng ứng với mô-men tối đa,
+// điện áp 1.0 = điện áp DC bus. Góc điện là uint16, 65536 = một vòng.
+// Các hàm không rẽ nhánh ngoài phép bão hòa và không có phép chia, dùng được trong
+// ngắt PWM. Các hàm *Block xử lý nhiều mẫu/nhiều động cơ trên mảng liên tiếp
+// (struct-of-arrays) để trình biên dịch vector hóa được.
+
+#define FOC_Q15_ONE 32767
+#define FOC_Q15_MIN (-32768)
+
+// 1/sqrt(3) và sqrt(3)/2 dạng Q15
+#define FOC_Q15_INV_SQRT3 18919
+#define FOC_Q15_SQRT3_DIV2 28378
+
+// Số bit phần lẻ của hệ số PI (4096 = 1.0); Kp, Ki phải nhỏ hơn 8.0 để phép nhân không tràn int32
+#define FOC_PI_SHIFT 12
+
+// Số điểm của bảng sin (một vòng), phải là lũy thừa của 2
+#define FOC_SIN_TABLE_BITS 8U
+#define FOC_SIN_TABLE_SIZE (1U << FOC_SIN_TABLE_BITS)
+
+// Bộ điều chỉnh PI có chống bão hòa tích phân (giới hạn tích phân theo giới hạn đầu ra)
+typedef struct {
+    int32_t Kp;             // Hệ số tỉ lệ, Q(FOC_PI_SHIFT)
+    int32_t Ki;             // Hệ số tích phân theo chu kỳ (Ki * Ts), Q(FOC_PI_SHIFT)
+    int16_t Limit;          // Giới hạn đối xứng của đầu ra, Q15
+    int32_t Integral;       // Tích phân, Q15 << FOC_PI_SHIFT
+} Foc_PiType;
+
+// Trạng thái một vòng dòng điện
+typedef struct {
+    Foc_PiType PiD;
+    Foc_PiType PiQ;
+    int16_t IdRef;          // Dòng trục d yêu cầu, Q15 (0 với động cơ nam châm bề mặt)
+    int16_t IqRef;          // Dòng trục q yêu cầu (tỉ lệ với mô-men), Q15
+    int16_t Id;             // Dòng đo được sau biến đổi Park, Q15
+    int16_t Iq;
+    int16_t Vd;             // Điện áp đầu ra của PI, Q15
+    int16_t Vq;
+} Foc_StateType;
+
+// Khởi tạo bảng sin; gọi một lần trước các hàm còn lại
+void Foc_Init(void);
+
+// Đặt lại tích phân và điện áp của vòng dòng điện, giữ nguyên hệ số
+void Foc_Reset(Foc_StateType* State);
+
+// sin và cos của góc điện, Q15, nội suy tuyến tính trên bảng
+void Foc_SinCos(uint16_t Angle, int16_t* Sin, int16_t* Cos);
+
+// Clarke: dòng pha a, b (cân bằng, ic = -ia - ib) -> alpha, beta
+void Foc_Clarke(int16_t Ia, int16_t Ib, int16_t* Alpha, int16_t* Beta);
+
+// Park: alpha, beta -> d, q theo sin/cos của góc rotor
+void Foc_Park(int16_t Alpha, int16_t Beta, int16_t Sin, int16_t Cos, int16_t* D, int16_t* Q);
+
+// Park ngược: d, q -> alpha, beta
+void Foc_InvPark(int16_t D, int16_t Q, int16_t Sin, int16_t Cos, int16_t* Alpha, int16_t* Beta);
+
+// Một bước PI: trả về đầu ra đã bão hòa trong [-Limit, Limit]
+int16_t Foc_PiStep(Foc_PiType* Pi, int16_t Reference, int16_t Measurement);
+
+// SVM bằng phép cộng thành phần thứ tự không (min-max): alpha, beta -> duty 3 pha
+// Duty là số tick trong [0, Period]
+void Foc_Svm(int16_t Alpha, int16_t Beta, uint16_t Period, uint16_t Duty[3]);
+
+// Một chu kỳ vòng dòng điện đầy đủ: Clarke -> Park -> PI d/q -> Park ngược -> SVM
+void Foc_Step(Foc_StateType* State, int16_t Ia, int16_t Ib, uint16_t Angle, uint16_t Period, uint16_t Duty[3]);
+
+// Các phiên bản theo khối của Clarke và Park cho Count mẫu
+void Foc_ClarkeBlock(const int16_t* Ia, const int16_t* Ib, int16_t* Alpha, int16_t* Beta, size_t Count);
+void Foc_ParkBlock(const int16_t* Alpha, const int16_t* Beta, const int16_t* Sin, const int16_t* Cos,
+                   int16_t* D, int16_t* Q, size_t Count);
+
+#endif
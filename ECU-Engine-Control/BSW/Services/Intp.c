@@ -0,0 +1,313 @@
+#include "Intp.h"
+
+// Giá trị 1.0 của phần lẻ nội suy dạng Q16 (đường số nguyên)
+#define INTP_FRACTION_ONE 0x10000UL
+
+// Tính nghịch đảo khoảng cách giữa các điểm chia của trục dấu phẩy động
+static Std_ReturnType Intp_InitAxisF32(Intp_AxisF32Type* Axis) {
+    if (Axis == NULL || Axis->Points == NULL || Axis->InvDelta == NULL || Axis->Count < 2U) {
+        return E_NOT_OK;
+    }
+    for (uint16_t i = 0; i + 1U < Axis->Count; i++) {
+        float delta = Axis->Points[i + 1U] - Axis->Points[i];
+        if (!(delta > 0.0f)) {
+            return E_NOT_OK;  // Điểm chia không tăng dần nghiêm ngặt
+        }
+        Axis->InvDelta[i] = 1.0f / delta;
+    }
+    return E_OK;
+}
+
+// Tính nghịch đảo khoảng cách giữa các điểm chia của trục số nguyên (dạng Q32)
+static Std_ReturnType Intp_InitAxisS32(Intp_AxisS32Type* Axis) {
+    if (Axis == NULL || Axis->Points == NULL || Axis->InvDelta == NULL || Axis->Count < 2U) {
+        return E_NOT_OK;
+    }
+    for (uint16_t i = 0; i + 1U < Axis->Count; i++) {
+        int64_t delta = (int64_t)Axis->Points[i + 1U] - Axis->Points[i];
+        if (delta <= 0 || delta > (int64_t)INT32_MAX) {
+            return E_NOT_OK;
+        }
+        Axis->InvDelta[i] = 0xFFFFFFFFUL / (uint32_t)delta;
+    }
+    return E_OK;
+}
+
+// Tìm nhị phân đoạn lớn nhất j trong [lo, hi] có Points[j] <= X (biết Points[lo] <= X)
+static uint16_t Intp_SearchF32(const float* Points, uint16_t lo, uint16_t hi, float X) {
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi + 1U) / 2U);
+        if (Points[mid] <= X) {
+            lo = mid;
+        } else {
+            hi = (uint16_t)(mid - 1U);
+        }
+    }
+    return lo;
+}
+
+static uint16_t Intp_SearchS32(const int32_t* Points, uint16_t lo, uint16_t hi, int32_t X) {
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi + 1U) / 2U);
+        if (Points[mid] <= X) {
+            lo = mid;
+        } else {
+            hi = (uint16_t)(mid - 1U);
+        }
+    }
+    return lo;
+}
+
+// Tìm đoạn chứa X (X đã được giới hạn trong trục): thử đoạn trong cache, rồi đoạn
+// liền kề, cuối cùng mới tìm nhị phân. Cập nhật cache với đoạn tìm được
+static uint16_t Intp_FindF32(const Intp_AxisF32Type* Axis, Intp_CacheType* Cache, float X) {
+    const float* p = Axis->Points;
+    uint16_t last = (uint16_t)(Axis->Count - 2U);  // Chỉ số đoạn cuối cùng
+    uint16_t i = (Cache->Index > last) ? last : Cache->Index;
+
+    if (X < p[i]) {
+        if (X >= p[i - 1U]) {
+            i--;
+        } else {
+            i = Intp_SearchF32(p, 0U, (uint16_t)(i - 2U), X);
+        }
+    } else if (i < last && X >= p[i + 1U]) {
+        if (i + 1U == last || X < p[i + 2U]) {
+            i++;
+        } else {
+            i = Intp_SearchF32(p, (uint16_t)(i + 2U), last, X);
+        }
+    }
+    Cache->Index = i;
+    return i;
+}
+
+static uint16_t Intp_FindS32(const Intp_AxisS32Type* Axis, Intp_CacheType* Cache, int32_t X) {
+    const int32_t* p = Axis->Points;
+    uint16_t last = (uint16_t)(Axis->Count - 2U);
+    uint16_t i = (Cache->Index > last) ? last : Cache->Index;
+
+    if (X < p[i]) {
+        if (X >= p[i - 1U]) {
+            i--;
+        } else {
+            i = Intp_SearchS32(p, 0U, (uint16_t)(i - 2U), X);
+        }
+    } else if (i < last && X >= p[i + 1U]) {
+        if (i + 1U == last || X < p[i + 2U]) {
+            i++;
+        } else {
+            i = Intp_SearchS32(p, (uint16_t)(i + 2U), last, X);
+        }
+    }
+    Cache->Index = i;
+    return i;
+}
+
+// Giới hạn X trong trục, tìm đoạn và tính phần lẻ t trong [0, 1]
+static uint16_t Intp_SegmentF32(const Intp_AxisF32Type* Axis, Intp_CacheType* Cache, float X, float* t) {
+    const float* p = Axis->Points;
+    if (!(X > p[0])) {  // Bao gồm cả NaN
+        Cache->Index = 0U;
+        *t = 0.0f;
+        return 0U;
+    }
+    if (X >= p[Axis->Count - 1U]) {
+        Cache->Index = (uint16_t)(Axis->Count - 2U);
+        *t = 1.0f;
+        return Cache->Index;
+    }
+    uint16_t i = Intp_FindF32(Axis, Cache, X);
+    *t = (X - p[i]) * Axis->InvDelta[i];
+    return i;
+}
+
+// Như Intp_SegmentF32, phần lẻ f dạng Q16 trong [0, INTP_FRACTION_ONE]
+static uint16_t Intp_SegmentS32(const Intp_AxisS32Type* Axis, Intp_CacheType* Cache, int32_t X, uint32_t* f) {
+    const int32_t* p = Axis->Points;
+    if (X <= p[0]) {
+        Cache->Index = 0U;
+        *f = 0U;
+        return 0U;
+    }
+    if (X >= p[Axis->Count - 1U]) {
+        Cache->Index = (uint16_t)(Axis->Count - 2U);
+        *f = INTP_FRACTION_ONE;
+        return Cache->Index;
+    }
+    uint16_t i = Intp_FindS32(Axis, Cache, X);
+    *f = (uint32_t)(((uint64_t)(uint32_t)(X - p[i]) * Axis->InvDelta[i]) >> 16);
+    return i;
+}
+
+// Nội suy tuyến tính số nguyên giữa a và b với phần lẻ f dạng Q16
+static inline int32_t Intp_LerpS32(int32_t a, int32_t b, uint32_t f) {
+    return (int32_t)(a + ((((int64_t)b - a) * (int64_t)f) >> 16));
+}
+
+Std_ReturnType Intp_InitCurveF32(Intp_CurveF32Type* Curve) {
+    if (Curve == NULL || Curve->Values == NULL) {
+        return E_NOT_OK;
+    }
+    return Intp_InitAxisF32(&Curve->Axis);
+}
+
+Std_ReturnType Intp_InitMapF32(Intp_MapF32Type* Map) {
+    if (Map == NULL || Map->Values == NULL) {
+        return E_NOT_OK;
+    }
+    if (Intp_InitAxisF32(&Map->AxisX) != E_OK) {
+        return E_NOT_OK;
+    }
+    return Intp_InitAxisF32(&Map->AxisY);
+}
+
+Std_ReturnType Intp_InitCurveS32(Intp_CurveS32Type* Curve) {
+    if (Curve == NULL || Curve->Values == NULL) {
+        return E_NOT_OK;
+    }
+    return Intp_InitAxisS32(&Curve->Axis);
+}
+
+Std_ReturnType Intp_InitMapS32(Intp_MapS32Type* Map) {
+    if (Map == NULL || Map->Values == NULL) {
+        return E_NOT_OK;
+    }
+    if (Intp_InitAxisS32(&Map->AxisX) != E_OK) {
+        return E_NOT_OK;
+    }
+    return Intp_InitAxisS32(&Map->AxisY);
+}
+
+float Intp_CurveF32(const Intp_CurveF32Type* Curve, Intp_CacheType* Cache, float X) {
+    float t;
+    uint16_t i = Intp_SegmentF32(&Curve->Axis, Cache, X, &t);
+    const float* v = Curve->Values;
+    return v[i] + (v[i + 1U] - v[i]) * t;
+}
+
+float Intp_MapF32(const Intp_MapF32Type* Map, Intp_CacheType* CacheX, Intp_CacheType* CacheY, float X, float Y) {
+    float tx, ty;
+    uint16_t ix = Intp_SegmentF32(&Map->AxisX, CacheX, X, &tx);
+    uint16_t iy = Intp_SegmentF32(&Map->AxisY, CacheY, Y, &ty);
+
+    // Nội suy song tuyến: theo X trên hai hàng iy và iy + 1, sau đó theo Y
+    const float* row0 = Map->Values + (uint32_t)iy * Map->AxisX.Count + ix;
+    const float* row1 = row0 + Map->AxisX.Count;
+    float z0 = row0[0] + (row0[1] - row0[0]) * tx;
+    float z1 = row1[0] + (row1[1] - row1[0]) * tx;
+    return z0 + (z1 - z0) * ty;
+}
+
+int32_t Intp_CurveS32(const Intp_CurveS32Type* Curve, Intp_CacheType* Cache, int32_t X) {
+    uint32_t f;
+    uint16_t i = Intp_SegmentS32(&Curve->Axis, Cache, X, &f);
+    return Intp_LerpS32(Curve->Values[i], Curve->Values[i + 1U], f);
+}
+
+int32_t Intp_MapS32(const Intp_MapS32Type* Map, Intp_CacheType* CacheX, Intp_CacheType* CacheY, int32_t X, int32_t Y) {
+    uint32_t fx, fy;
+    uint16_t ix = Intp_SegmentS32(&Map->AxisX, CacheX, X, &fx);
+    uint16_t iy = Intp_SegmentS32(&Map->AxisY, CacheY, Y, &fy);
+
+    const int32_t* row0 = Map->Values + (uint32_t)iy * Map->AxisX.Count + ix;
+    const int32_t* row1 = row0 + Map->AxisX.Count;
+    int32_t z0 = Intp_LerpS32(row0[0], row0[1], fx);
+    int32_t z1 = Intp_LerpS32(row1[0], row1[1], fx);
+    return Intp_LerpS32(z0, z1, fy);
+}
+
+void Intp_CurveBlockF32(const Intp_CurveF32Type* Curve, Intp_CacheType* Cache,
+                        const float* In, float* Out, uint32_t Count) {
+    const Intp_AxisF32Type* axis = &Curve->Axis;
+    const float lo = axis->Points[0];
+    const float hi = axis->Points[axis->Count - 1U];
+    float origin[INTP_BLOCK_CHUNK];
+    float base[INTP_BLOCK_CHUNK];
+    float slope[INTP_BLOCK_CHUNK];
+
+    while (Count > 0U) {
+        uint32_t n = (Count < INTP_BLOCK_CHUNK) ? Count : INTP_BLOCK_CHUNK;
+
+        // Lượt 1: tìm đoạn (vô hướng, dùng cache) và gom hệ số của đoạn vào mảng liên tiếp.
+        // Hệ số chỉ được tính lại khi mẫu rơi sang đoạn khác
+        uint16_t i = Intp_FindF32(axis, Cache, (In[0] < lo) ? lo : ((In[0] > hi) ? hi : In[0]));
+        float segLo = axis->Points[i];
+        float segHi = axis->Points[i + 1U];
+        float segBase = Curve->Values[i];
+        float segSlope = (Curve->Values[i + 1U] - Curve->Values[i]) * axis->InvDelta[i];
+        for (uint32_t j = 0; j < n; j++) {
+            float x = In[j];
+            x = (x < lo) ? lo : x;
+            x = (x > hi) ? hi : x;
+            if (x < segLo || x >= segHi) {
+                i = Intp_FindF32(axis, Cache, x);
+                segLo = axis->Points[i];
+                segHi = axis->Points[i + 1U];
+                segBase = Curve->Values[i];
+                segSlope = (Curve->Values[i + 1U] - Curve->Values[i]) * axis->InvDelta[i];
+            }
+            origin[j] = segLo;
+            base[j] = segBase;
+            slope[j] = segSlope;
+        }
+
+        // Lượt 2: chỉ có giới hạn và nhân cộng trên các mảng liên tiếp, không rẽ nhánh
+        for (uint32_t j = 0; j < n; j++) {
+            float x = In[j];
+            x = (x < lo) ? lo : x;
+            x = (x > hi) ? hi : x;
+            Out[j] = base[j] + (x - origin[j]) * slope[j];
+        }
+
+        In += n;
+        Out += n;
+        Count -= n;
+    }
+}
+
+void Intp_CurveBlockS32(const Intp_CurveS32Type* Curve, Intp_CacheType* Cache,
+                        const int32_t* In, int32_t* Out, uint32_t Count) {
+    const Intp_AxisS32Type* axis = &Curve->Axis;
+    const int32_t lo = axis->Points[0];
+    const int32_t hi = axis->Points[axis->Count - 1U];
+    int32_t origin[INTP_BLOCK_CHUNK];
+    int32_t base[INTP_BLOCK_CHUNK];
+    int64_t delta[INTP_BLOCK_CHUNK];
+    uint32_t inv[INTP_BLOCK_CHUNK];
+
+    while (Count > 0U) {
+        uint32_t n = (Count < INTP_BLOCK_CHUNK) ? Count : INTP_BLOCK_CHUNK;
+
+        uint16_t i = Intp_FindS32(axis, Cache, (In[0] < lo) ? lo : ((In[0] > hi) ? hi : In[0]));
+        int32_t segLo = axis->Points[i];
+        int32_t segHi = axis->Points[i + 1U];
+        for (uint32_t j = 0; j < n; j++) {
+            int32_t x = In[j];
+            x = (x < lo) ? lo : x;
+            x = (x > hi) ? hi : x;
+            if (x < segLo || x >= segHi) {
+                i = Intp_FindS32(axis, Cache, x);
+                segLo = axis->Points[i];
+                segHi = axis->Points[i + 1U];
+            }
+            origin[j] = segLo;
+            base[j] = Curve->Values[i];
+            delta[j] = (int64_t)Curve->Values[i + 1U] - Curve->Values[i];
+            inv[j] = axis->InvDelta[i];
+        }
+
+        for (uint32_t j = 0; j < n; j++) {
+            int32_t x = In[j];
+            x = (x < lo) ? lo : x;
+            x = (x > hi) ? hi : x;
+            uint64_t f = ((uint64_t)(uint32_t)(x - origin[j]) * inv[j]) >> 16;
+            f = (x == hi) ? INTP_FRACTION_ONE : f;
+            Out[j] = (int32_t)(base[j] + ((delta[j] * (int64_t)f) >> 16));
+        }
+
+        In += n;
+        Out += n;
+        Count -= n;
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef INTP_H
+#define INTP_H
+
+#include <stddef.h>
+#include "Std_Types.h"
+
+// Thư viện nội suy tuyến tính cho đường cong 1D (curve) và bản đồ 2D (map).
+// Điểm chia của mỗi trục phải tăng dần nghiêm ngặt; nghịch đảo khoảng cách giữa
+// các điểm chia được tính sẵn trong Intp_Init*, nên phép tra cứu không có phép chia.
+// Đầu vào ngoài phạm vi trục được giới hạn về điểm chia đầu/cuối.
+
+// Số phần tử xử lý trong một lượt của các hàm nội suy theo khối
+#define INTP_BLOCK_CHUNK 64U
+
+// Vị trí đoạn tìm được ở lần tra cứu trước. Mỗi nơi gọi giữ cache riêng,
+// đầu vào thay đổi chậm chỉ cần kiểm tra đoạn hiện tại hoặc đoạn liền kề
+typedef struct {
+    uint16_t Index;
+} Intp_CacheType;
+
+// Trục dấu phẩy động
+typedef struct {
+    const float* Points;    // Điểm chia, Count phần tử
+    float* InvDelta;        // 1 / (Points[i+1] - Points[i]), Count - 1 phần tử, do Intp_Init* điền
+    uint16_t Count;         // Số điểm chia (>= 2)
+} Intp_AxisF32Type;
+
+// Đường cong 1D dấu phẩy động: Values[i] là giá trị tại Axis.Points[i]
+typedef struct {
+    Intp_AxisF32Type Axis;
+    const float* Values;
+} Intp_CurveF32Type;
+
+// Bản đồ 2D dấu phẩy động: Values[iy * AxisX.Count + ix]
+typedef struct {
+    Intp_AxisF32Type AxisX;
+    Intp_AxisF32Type AxisY;
+    const float* Values;
+} Intp_MapF32Type;
+
+// Trục số nguyên (ví dụ giá trị ADC thô hoặc số Q16.16)
+typedef struct {
+    const int32_t* Points;  // Điểm chia, Count phần tử
+    uint32_t* InvDelta;     // (2^32 - 1) / (Points[i+1] - Points[i]), do Intp_Init* điền
+    uint16_t Count;         // Số điểm chia (>= 2)
+} Intp_AxisS32Type;
+
+// Đường cong 1D số nguyên: giá trị đầu ra cùng định dạng với Values (ví dụ Q15, Q16.16)
+typedef struct {
+    Intp_AxisS32Type Axis;
+    const int32_t* Values;
+} Intp_CurveS32Type;
+
+// Bản đồ 2D số nguyên: Values[iy * AxisX.Count + ix]
+typedef struct {
+    Intp_AxisS32Type AxisX;
+    Intp_AxisS32Type AxisY;
+    const int32_t* Values;
+} Intp_MapS32Type;
+
+// Kiểm tra điểm chia tăng dần và tính sẵn nghịch đảo khoảng cách.
+// Trả về E_NOT_OK nếu trục có ít hơn 2 điểm hoặc không tăng dần nghiêm ngặt
+Std_ReturnType Intp_InitCurveF32(Intp_CurveF32Type* Curve);
+Std_ReturnType Intp_InitMapF32(Intp_MapF32Type* Map);
+Std_ReturnType Intp_InitCurveS32(Intp_CurveS32Type* Curve);
+Std_ReturnType Intp_InitMapS32(Intp_MapS32Type* Map);
+
+// Nội suy một giá trị trên đường cong / bản đồ
+float Intp_CurveF32(const Intp_CurveF32Type* Curve, Intp_CacheType* Cache, float X);
+float Intp_MapF32(const Intp_MapF32Type* Map, Intp_CacheType* CacheX, Intp_CacheType* CacheY, float X, float Y);
+int32_t Intp_CurveS32(const Intp_CurveS32Type* Curve, Intp_CacheType* Cache, int32_t X);
+int32_t Intp_MapS32(const Intp_MapS32Type* Map, Intp_CacheType* CacheX, Intp_CacheType* CacheY, int32_t X, int32_t Y);
+
+// Nội suy một khối Count mẫu: lượt tìm đoạn dùng cache, lượt tính toán là vòng lặp
+// không rẽ nhánh trên các mảng liên tiếp để trình biên dịch vector hóa
+void Intp_CurveBlockF32(const Intp_CurveF32Type* Curve, Intp_CacheType* Cache,
+                        const float* In, float* Out, uint32_t Count);
+void Intp_CurveBlockS32(const Intp_CurveS32Type* Curve, Intp_CacheType* Cache,
+                        const int32_t* In, int32_t* Out, uint32_t Count);
+
+#endif
@@ -1,64 +1,245 @@
 #include "Mem.h"
+#include <pthread.h>
+#include <string.h>
 
-// Mảng giả lập để theo dõi các vùng bộ nhớ đã cấp phát
-#define MAX_ALLOCATIONS 100
-void* allocated_blocks[MAX_ALLOCATIONS];
-int allocation_count = 0;
+// Một pool khối nhớ có kích thước cố định, nằm liên tục trong vùng nhớ tĩnh
+typedef struct {
+    uint32_t blockSize;     // Kích thước một khối (byte)
+    uint32_t blockCount;    // Số khối trong pool
+    uint8_t* start;         // Địa chỉ khối đầu tiên
+    uint8_t* end;           // Địa chỉ ngay sau khối cuối cùng
+    void* freeList;         // Danh sách khối trống (con trỏ next nằm trong chính khối)
+    uint32_t freeCount;     // Số khối còn trống
+    uint32_t minFreeCount;  // Số khối trống ít nhất từng ghi nhận
+    uint32_t firstBlock;    // Chỉ số khối đầu tiên của pool trong Mem_BlockOwner
+} Mem_PoolType;
 
-// Khởi tạo hệ thống quản lý bộ nhớ
+// Cấu hình lớp kích thước, sắp xếp tăng dần theo kích thước khối
+static const uint32_t Mem_PoolConfig[MEM_NUM_POOLS][2] = {
+    { MEM_POOL0_BLOCK_SIZE, MEM_POOL0_BLOCK_COUNT },
+    { MEM_POOL1_BLOCK_SIZE, MEM_POOL1_BLOCK_COUNT },
+    { MEM_POOL2_BLOCK_SIZE, MEM_POOL2_BLOCK_COUNT },
+    { MEM_POOL3_BLOCK_SIZE, MEM_POOL3_BLOCK_COUNT },
+};
+
+// Vùng nhớ tĩnh duy nhất chứa toàn bộ các pool
+static _Alignas(MEM_ALIGNMENT) uint8_t Mem_Region[MEM_REGION_SIZE];
+static Mem_PoolType Mem_Pools[MEM_NUM_POOLS];
+// Trạng thái từng khối: 0 = trống, ngược lại là tag + 1 của module sở hữu
+// (cũng dùng để phát hiện giải phóng hai lần)
+static uint8_t Mem_BlockOwner[MEM_TOTAL_BLOCKS];
+// Số byte được yêu cầu của từng khối đang cấp phát
+static uint32_t Mem_BlockRequested[MEM_TOTAL_BLOCKS];
+static Mem_TagStatsType Mem_TagStats[MEM_NUM_TAGS];
+static const char* const Mem_TagNames[MEM_NUM_TAGS] = {
+    "Other", "Dem", "Dcm", "Can", "PduR", "NvM", "Rte", "SWC"
+};
+static pthread_mutex_t Mem_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Tìm pool chứa con trỏ theo dải địa chỉ và chỉ số khối tương ứng
+static Mem_PoolType* Mem_FindBlock(const void* ptr, uint32_t* blockIndex) {
+    const uint8_t* p = (const uint8_t*)ptr;
+
+    if (p < Mem_Region || p >= Mem_Region + MEM_REGION_SIZE) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < MEM_NUM_POOLS; i++) {
+        Mem_PoolType* pool = &Mem_Pools[i];
+        if (p < pool->end) {
+            uint32_t offset = (uint32_t)(p - pool->start);
+            if (offset % pool->blockSize != 0) {
+                return NULL;  // Con trỏ trỏ vào giữa một khối
+            }
+            *blockIndex = pool->firstBlock + offset / pool->blockSize;
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+// Khởi tạo hệ thống quản lý bộ nhớ: chia vùng nhớ tĩnh thành các pool và nối danh sách khối trống
 void Mem_Init(void) {
-    printf("Memory Management System Initialized.\n");
-    for (int i = 0; i < MAX_ALLOCATIONS; i++) {
-        allocated_blocks[i] = NULL;
+    uint8_t* cursor = Mem_Region;
+    uint32_t firstBlock = 0;
+
+    pthread_mutex_lock(&Mem_Lock);
+    for (uint8_t i = 0; i < MEM_NUM_POOLS; i++) {
+        Mem_PoolType* pool = &Mem_Pools[i];
+        pool->blockSize = Mem_PoolConfig[i][0];
+        pool->blockCount = Mem_PoolConfig[i][1];
+        pool->start = cursor;
+        pool->end = cursor + pool->blockSize * pool->blockCount;
+        pool->freeList = NULL;
+        pool->freeCount = pool->blockCount;
+        pool->minFreeCount = pool->blockCount;
+        pool->firstBlock = firstBlock;
+
+        // Nối ngược để khối có địa chỉ thấp nhất được cấp phát trước
+        for (uint32_t b = pool->blockCount; b > 0; b--) {
+            void** block = (void**)(pool->start + (b - 1) * pool->blockSize);
+            *block = pool->freeList;
+            pool->freeList = block;
+        }
+
+        cursor = pool->end;
+        firstBlock += pool->blockCount;
+    }
+    for (uint32_t i = 0; i < MEM_TOTAL_BLOCKS; i++) {
+        Mem_BlockOwner[i] = 0;
+        Mem_BlockRequested[i] = 0;
     }
-    allocation_count = 0;
+    memset(Mem_TagStats, 0, sizeof(Mem_TagStats));
+    pthread_mutex_unlock(&Mem_Lock);
+
+    printf("Memory Management System Initialized: %u pools, %u bytes.\n",
+           (unsigned)MEM_NUM_POOLS, (unsigned)MEM_REGION_SIZE);
 }
 
-// Cấp phát một vùng bộ nhớ
+// Cấp phát một khối nhớ không gắn module sở hữu
 void* Mem_Alloc(size_t size) {
-    if (allocation_count >= MAX_ALLOCATIONS) {
-        printf("Memory allocation failed: Maximum allocation count reached.\n");
-        return NULL;
+    return Mem_AllocTagged(size, MEM_TAG_OTHER);
+}
+
+// Cấp phát một khối nhớ từ pool nhỏ nhất còn khối trống và đủ chứa size byte,
+// đồng thời cập nhật thống kê của module tag
+void* Mem_AllocTagged(size_t size, Mem_TagType tag) {
+    void* block = NULL;
+
+    if ((unsigned)tag >= MEM_NUM_TAGS) {
+        tag = MEM_TAG_OTHER;
     }
 
-    void* ptr = malloc(size);
-    if (ptr == NULL) {
-        printf("Memory allocation failed: Not enough memory.\n");
-        return NULL;
+    pthread_mutex_lock(&Mem_Lock);
+    Mem_TagStatsType* stats = &Mem_TagStats[tag];
+    for (uint8_t i = 0; size != 0 && i < MEM_NUM_POOLS; i++) {
+        Mem_PoolType* pool = &Mem_Pools[i];
+        if (size <= pool->blockSize && pool->freeList != NULL) {
+            block = pool->freeList;
+            pool->freeList = *(void**)block;
+            pool->freeCount--;
+            if (pool->freeCount < pool->minFreeCount) {
+                pool->minFreeCount = pool->freeCount;
+            }
+
+            uint32_t blockIndex = pool->firstBlock + (uint32_t)((uint8_t*)block - pool->start) / pool->blockSize;
+            Mem_BlockOwner[blockIndex] = (uint8_t)(tag + 1);
+            Mem_BlockRequested[blockIndex] = (uint32_t)size;
+            stats->currentBytes += (uint32_t)size;
+            if (stats->currentBytes > stats->peakBytes) {
+                stats->peakBytes = stats->currentBytes;
+            }
+            stats->allocCount++;
+            break;
+        }
+    }
+    if (block == NULL) {
+        stats->failCount++;
     }
+    pthread_mutex_unlock(&Mem_Lock);
 
-    allocated_blocks[allocation_count++] = ptr;
-    printf("Memory allocated: %zu bytes at address %p\n", size, ptr);
-    return ptr;
+    return block;
 }
 
-// Giải phóng một vùng bộ nhớ
+// Trả một khối nhớ về đầu danh sách khối trống của pool chứa nó
 void Mem_Free(void* ptr) {
-    if (ptr == NULL) {
-        printf("Memory free failed: Null pointer provided.\n");
-        return;
+    uint32_t blockIndex;
+
+    pthread_mutex_lock(&Mem_Lock);
+    Mem_PoolType* pool = Mem_FindBlock(ptr, &blockIndex);
+    if (pool != NULL && Mem_BlockOwner[blockIndex] != 0) {
+        Mem_TagStatsType* stats = &Mem_TagStats[Mem_BlockOwner[blockIndex] - 1];
+        stats->currentBytes -= Mem_BlockRequested[blockIndex];
+        stats->freeCount++;
+        Mem_BlockOwner[blockIndex] = 0;
+        *(void**)ptr = pool->freeList;
+        pool->freeList = ptr;
+        pool->freeCount++;
     }
+    pthread_mutex_unlock(&Mem_Lock);
+}
 
-    for (int i = 0; i < allocation_count; i++) {
-        if (allocated_blocks[i] == ptr) {
-            free(ptr);
-            allocated_blocks[i] = NULL;
-            printf("Memory freed at address %p\n", ptr);
-            return;
-        }
+// Kiểm tra con trỏ có phải là một khối đang được cấp phát hay không
+int Mem_Check(void* ptr) {
+    uint32_t blockIndex;
+    int valid = 0;
+
+    pthread_mutex_lock(&Mem_Lock);
+    if (Mem_FindBlock(ptr, &blockIndex) != NULL && Mem_BlockOwner[blockIndex] != 0) {
+        valid = 1;  // Vùng nhớ hợp lệ
+    }
+    pthread_mutex_unlock(&Mem_Lock);
+    return valid;
+}
+
+// Lấy số khối còn trống của một pool
+uint32_t Mem_GetFreeBlocks(uint8_t poolIndex) {
+    if (poolIndex >= MEM_NUM_POOLS) {
+        return 0;
     }
+    return Mem_Pools[poolIndex].freeCount;
+}
 
-    printf("Memory free failed: Invalid pointer %p\n", ptr);
+// Lấy số khối trống ít nhất từng ghi nhận của một pool
+uint32_t Mem_GetMinFreeBlocks(uint8_t poolIndex) {
+    if (poolIndex >= MEM_NUM_POOLS) {
+        return 0;
+    }
+    return Mem_Pools[poolIndex].minFreeCount;
 }
 
-// Kiểm tra vùng bộ nhớ có hợp lệ hay không
-int Mem_Check(void* ptr) {
-    for (int i = 0; i < allocation_count; i++) {
-        if (allocated_blocks[i] == ptr) {
-            printf("Memory check: Valid pointer %p\n", ptr);
-            return 1;  // Vùng nhớ hợp lệ
-        }
+// Sao chép thống kê của một tag (ảnh chụp nhất quán dưới khóa)
+int Mem_GetTagStats(Mem_TagType tag, Mem_TagStatsType* stats) {
+    if ((unsigned)tag >= MEM_NUM_TAGS || stats == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&Mem_Lock);
+    *stats = Mem_TagStats[tag];
+    pthread_mutex_unlock(&Mem_Lock);
+    return 1;
+}
+
+// In bảng thống kê bộ nhớ theo tag và theo pool
+void Mem_PrintStats(void) {
+    printf("Memory usage by module:\n");
+    printf("  %-6s %10s %10s %8s %8s %8s\n", "Tag", "Current", "Peak", "Allocs", "Frees", "Fails");
+    for (uint8_t i = 0; i < MEM_NUM_TAGS; i++) {
+        Mem_TagStatsType stats;
+        Mem_GetTagStats((Mem_TagType)i, &stats);
+        printf("  %-6s %10u %10u %8u %8u %8u\n", Mem_TagNames[i],
+               (unsigned)stats.currentBytes, (unsigned)stats.peakBytes,
+               (unsigned)stats.allocCount, (unsigned)stats.freeCount, (unsigned)stats.failCount);
+    }
+    printf("Memory pools:\n");
+    for (uint8_t i = 0; i < MEM_NUM_POOLS; i++) {
+        printf("  %5u-byte blocks: %3u/%3u free, minimum %3u\n", (unsigned)Mem_Pools[i].blockSize,
+               (unsigned)Mem_GetFreeBlocks(i), (unsigned)Mem_Pools[i].blockCount,
+               (unsigned)Mem_GetMinFreeBlocks(i));
+    }
+}
+
+// Gắn bộ đệm tĩnh của module vào arena
+void Mem_ArenaInit(Mem_ArenaType* arena, void* buffer, size_t size) {
+    arena->base = (uint8_t*)buffer;
+    arena->size = (buffer != NULL) ? size : 0;
+    arena->used = 0;
+    arena->highWater = 0;
+    arena->failCount = 0;
+}
+
+// Bắt đầu một chu kỳ (phòng trường hợp chu kỳ trước kết thúc mà không gọi Mem_ArenaReset)
+void Mem_ArenaBegin(Mem_ArenaType* arena) {
+    Mem_ArenaReset(arena);
+}
+
+// Kết thúc chu kỳ: high-water mark chỉ được cập nhật tại đây để Mem_ArenaAlloc chỉ còn tăng con trỏ
+void Mem_ArenaReset(Mem_ArenaType* arena) {
+    if (arena->used > arena->highWater) {
+        arena->highWater = arena->used;
     }
-    printf("Memory check: Invalid pointer %p\n", ptr);
-    return 0;  // Vùng nhớ không hợp lệ
+    arena->used = 0;
+}
+
+// Lấy số byte dùng nhiều nhất trong một chu kỳ của arena
+size_t Mem_ArenaGetHighWater(const Mem_ArenaType* arena) {
+    return (arena->used > arena->highWater) ? arena->used : arena->highWater;
 }
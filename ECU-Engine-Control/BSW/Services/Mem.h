@@ -3,17 +3,114 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+
+// Căn lề của mọi khối nhớ (kích thước khối phải là bội số của giá trị này)
+#define MEM_ALIGNMENT 16U
+
+// Cấu hình các pool theo lớp kích thước: kích thước khối (byte) và số khối
+#define MEM_POOL0_BLOCK_SIZE 32U
+#define MEM_POOL0_BLOCK_COUNT 64U
+#define MEM_POOL1_BLOCK_SIZE 128U
+#define MEM_POOL1_BLOCK_COUNT 32U
+#define MEM_POOL2_BLOCK_SIZE 512U
+#define MEM_POOL2_BLOCK_COUNT 16U
+#define MEM_POOL3_BLOCK_SIZE 4096U
+#define MEM_POOL3_BLOCK_COUNT 8U
+#define MEM_NUM_POOLS 4U
+
+// Tổng số khối và kích thước vùng nhớ tĩnh chứa toàn bộ các pool
+#define MEM_TOTAL_BLOCKS (MEM_POOL0_BLOCK_COUNT + MEM_POOL1_BLOCK_COUNT + \
+                          MEM_POOL2_BLOCK_COUNT + MEM_POOL3_BLOCK_COUNT)
+#define MEM_REGION_SIZE (MEM_POOL0_BLOCK_SIZE * MEM_POOL0_BLOCK_COUNT + \
+                         MEM_POOL1_BLOCK_SIZE * MEM_POOL1_BLOCK_COUNT + \
+                         MEM_POOL2_BLOCK_SIZE * MEM_POOL2_BLOCK_COUNT + \
+                         MEM_POOL3_BLOCK_SIZE * MEM_POOL3_BLOCK_COUNT)
+
+// Module sở hữu khối nhớ, dùng để thống kê mức sử dụng bộ nhớ theo từng module
+typedef enum {
+    MEM_TAG_OTHER = 0,  // Không xác định (Mem_Alloc không có tag)
+    MEM_TAG_DEM,
+    MEM_TAG_DCM,
+    MEM_TAG_CAN,
+    MEM_TAG_PDUR,
+    MEM_TAG_NVM,
+    MEM_TAG_RTE,
+    MEM_TAG_SWC,
+    MEM_NUM_TAGS
+} Mem_TagType;
+
+// Thống kê bộ nhớ của một tag (số byte tính theo kích thước được yêu cầu)
+typedef struct {
+    uint32_t currentBytes;  // Số byte đang được cấp phát
+    uint32_t peakBytes;     // Số byte lớn nhất từng được cấp phát cùng lúc
+    uint32_t allocCount;    // Số lần cấp phát thành công
+    uint32_t freeCount;     // Số lần giải phóng
+    uint32_t failCount;     // Số lần cấp phát thất bại
+} Mem_TagStatsType;
+
+// Căn lề của các vùng nhớ cấp phát từ arena
+#define MEM_ARENA_ALIGNMENT 8U
+
+// Arena tạm cho một chu kỳ điều khiển: cấp phát bằng cách tăng con trỏ,
+// giải phóng toàn bộ một lần ở cuối chu kỳ
+typedef struct {
+    uint8_t* base;          // Bộ đệm của arena (do module sở hữu cấp)
+    size_t size;            // Dung lượng bộ đệm
+    size_t used;            // Số byte đã dùng trong chu kỳ hiện tại
+    size_t highWater;       // Số byte dùng nhiều nhất trong một chu kỳ
+    uint32_t failCount;     // Số lần cấp phát thất bại do hết dung lượng
+} Mem_ArenaType;
 
 // Khởi tạo hệ thống quản lý bộ nhớ
 void Mem_Init(void);
 
-// Cấp phát một vùng bộ nhớ
+// Cấp phát một khối nhớ từ pool nhỏ nhất đủ chứa size byte (O(1)).
+// Trả về NULL nếu size lớn hơn khối lớn nhất hoặc mọi pool phù hợp đã hết
 void* Mem_Alloc(size_t size);
 
-// Giải phóng một vùng bộ nhớ
+// Cấp phát như Mem_Alloc và ghi nhận khối nhớ cho module tag
+void* Mem_AllocTagged(size_t size, Mem_TagType tag);
+
+// Trả một khối nhớ về pool của nó (O(1)); con trỏ không hợp lệ bị bỏ qua
 void Mem_Free(void* ptr);
 
-// Kiểm tra vùng bộ nhớ có hợp lệ hay không
+// Kiểm tra con trỏ có phải là một khối đang được cấp phát hay không (1: hợp lệ)
 int Mem_Check(void* ptr);
 
+// Lấy số khối còn trống của một pool
+uint32_t Mem_GetFreeBlocks(uint8_t poolIndex);
+
+// Lấy số khối trống ít nhất từng ghi nhận của một pool (low-water mark)
+uint32_t Mem_GetMinFreeBlocks(uint8_t poolIndex);
+
+// Sao chép thống kê của một tag. Trả về 1 nếu tag hợp lệ
+int Mem_GetTagStats(Mem_TagType tag, Mem_TagStatsType* stats);
+
+// In bảng thống kê bộ nhớ theo tag và theo pool
+void Mem_PrintStats(void);
+
+// Gắn bộ đệm tĩnh của module vào arena
+void Mem_ArenaInit(Mem_ArenaType* arena, void* buffer, size_t size);
+
+// Bắt đầu một chu kỳ: arena rỗng, dữ liệu tạm của chu kỳ trước không còn hợp lệ
+void Mem_ArenaBegin(Mem_ArenaType* arena);
+
+// Cấp phát size byte từ arena (chỉ tăng con trỏ). Trả về NULL nếu arena không đủ chỗ
+static inline void* Mem_ArenaAlloc(Mem_ArenaType* arena, size_t size) {
+    size_t offset = (arena->used + (MEM_ARENA_ALIGNMENT - 1U)) & ~(size_t)(MEM_ARENA_ALIGNMENT - 1U);
+    if (size > arena->size || offset > arena->size - size) {
+        arena->failCount++;
+        return NULL;
+    }
+    arena->used = offset + size;
+    return arena->base + offset;
+}
+
+// Kết thúc chu kỳ: cập nhật high-water mark và giải phóng toàn bộ arena trong O(1)
+void Mem_ArenaReset(Mem_ArenaType* arena);
+
+// Lấy số byte dùng nhiều nhất trong một chu kỳ của arena
+size_t Mem_ArenaGetHighWater(const Mem_ArenaType* arena);
+
 #endif // MEM_H
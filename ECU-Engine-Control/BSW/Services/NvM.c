@@ -0,0 +1,441 @@
+#include "NvM.h"
+#include <pthread.h>
+
+// Định dạng vùng NvM trên flash:
+// mỗi sector bắt đầu bằng header (magic + số thứ tự), sau đó là các bản ghi nối tiếp nhau.
+// Mỗi lần ghi một block tạo một bản ghi mới, bản ghi có số thứ tự sector lớn nhất là mới nhất.
+// Sector ngay sau sector đang ghi luôn được giữ ở trạng thái xóa (sector dự phòng)
+#define NVM_SECTOR_MAGIC 0x534D564EUL  // "NVMS"
+#define NVM_RECORD_MAGIC 0xA55AU
+#define NVM_RECORD_BLANK 0xFFFFU       // Header bản ghi chưa được ghi
+#define NVM_NO_RECORD 0xFFFFFFFFUL     // Block chưa có bản ghi trên flash
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;      // Tăng mỗi lần chuyển sang sector mới
+    uint32_t reserved[2];
+} NvM_SectorHeaderType;
+
+typedef struct {
+    uint16_t magic;
+    uint16_t blockId;
+    uint16_t length;        // Độ dài dữ liệu (chưa tính phần đệm)
+    uint16_t reserved;
+    uint32_t crc;           // CRC-32 của dữ liệu
+} NvM_RecordHeaderType;
+
+// Kích thước bản ghi trên flash: header + dữ liệu đệm tới bội số 4 byte
+#define NVM_RECORD_SIZE(length) ((uint32_t)sizeof(NvM_RecordHeaderType) + (((uint32_t)(length) + 3U) & ~3U))
+#define NVM_SECTOR_ADDRESS(sector) (NVM_AREA_START + (uint32_t)(sector) * FLS_SECTOR_SIZE)
+
+// RAM mirror và giá trị mặc định của các block
+static NvM_TorqueCalibrationType NvM_TorqueCalibrationRam;
+static const NvM_TorqueCalibrationType NvM_TorqueCalibrationRom = {
+    .MaxTorque = 100.0f,
+    // Mô-men tỉ lệ với bàn đạp ga, giảm 20% khi tốc độ vượt khoảng 50 km/h
+    .TorqueMapSpeed = { 0.0f, 45.0f, 55.0f, 100.0f, 150.0f, 200.0f },
+    .TorqueMapThrottle = { 0.0f, 0.2f, 0.4f, 0.6f, 0.8f, 1.0f },
+    .TorqueMap = {
+        {   0.0f,   0.0f,  0.0f,  0.0f,  0.0f,  0.0f },
+        {  20.0f,  20.0f, 16.0f, 16.0f, 16.0f, 16.0f },
+        {  40.0f,  40.0f, 32.0f, 32.0f, 32.0f, 32.0f },
+        {  60.0f,  60.0f, 48.0f, 48.0f, 48.0f, 48.0f },
+        {  80.0f,  80.0f, 64.0f, 64.0f, 64.0f, 64.0f },
+        { 100.0f, 100.0f, 80.0f, 80.0f, 80.0f, 80.0f }
+    },
+    // Cộng thêm 10 Nm khi tải trọng vượt khoảng 500 kg
+    .LoadCurveWeight = { 0.0f, 450.0f, 550.0f, 1000.0f },
+    .LoadCurveOffset = { 0.0f, 0.0f, 10.0f, 10.0f },
+    .TorqueKp = 0.5f,
+    .TorqueKi = 20.0f,
+    .TorqueRateLimit = 2000.0f
+};
+
+static NvM_SensorCalibrationType NvM_SensorCalibrationRam;
+static const NvM_SensorCalibrationType NvM_SensorCalibrationRom = {
+    .SpeedMaxValue = 200,
+    .LoadMaxValue = 1000,
+    .TorqueMaxValue = 500,
+    .MotorMaxTorque = 300
+};
+
+// Bảng mô tả block, sắp xếp theo blockId liên tiếp từ 1 để tra cứu O(1)
+static const NvM_BlockDescriptorType NvM_BlockDescriptors[NVM_NUM_BLOCKS] = {
+    { NVM_BLOCK_TORQUE_CALIBRATION, "TorqueCalibration", &NvM_TorqueCalibrationRam,
+      sizeof(NvM_TorqueCalibrationType), &NvM_TorqueCalibrationRom },
+    { NVM_BLOCK_SENSOR_CALIBRATION, "SensorCalibration", &NvM_SensorCalibrationRam,
+      sizeof(NvM_SensorCalibrationType), &NvM_SensorCalibrationRom },
+};
+
+// Trạng thái block và hàng đợi ghi (bảo vệ bởi NvM_Lock)
+static NvM_RequestResultType NvM_BlockStatus[NVM_NUM_BLOCKS];
+static uint8_t NvM_BlockQueued[NVM_NUM_BLOCKS];
+static uint16_t NvM_WriteQueue[NVM_NUM_BLOCKS];  // Mỗi block xuất hiện tối đa một lần
+static uint16_t NvM_QueueHead = 0;
+static uint16_t NvM_QueueCount = 0;
+static pthread_mutex_t NvM_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Trạng thái log trên flash (bảo vệ bởi NvM_FlashLock)
+static uint32_t NvM_RecordAddress[NVM_NUM_BLOCKS];  // Địa chỉ bản ghi hợp lệ mới nhất
+static uint8_t NvM_IntegrityFailed[NVM_NUM_BLOCKS]; // Bản ghi mới nhất sai CRC
+static uint8_t NvM_ActiveSector = 0;
+static uint32_t NvM_WriteOffset = 0;
+static uint32_t NvM_Sequence = 0;
+static uint8_t NvM_Relocating = 0;
+static pthread_mutex_t NvM_FlashLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint8_t NvM_SectorBuffer[FLS_SECTOR_SIZE];
+static uint8_t NvM_RecordBuffer[NVM_RECORD_SIZE(NVM_MAX_BLOCK_LENGTH)];
+static uint8_t NvM_RelocationBuffer[NVM_MAX_BLOCK_LENGTH];
+static uint8_t NvM_WriteBuffer[NVM_MAX_BLOCK_LENGTH];
+static uint32_t NvM_CrcTable[256];
+
+static Std_ReturnType NvM_AppendRecord(uint16_t index, const uint8_t* data, uint16_t length);
+
+// Tạo bảng tra CRC-32 (đa thức 0xEDB88320)
+static void NvM_InitCrcTable(void) {
+    for (uint32_t i = 0; i < 256U; i++) {
+        uint32_t crc = i;
+        for (uint8_t bit = 0; bit < 8U; bit++) {
+            crc = (crc & 1U) ? ((crc >> 1) ^ 0xEDB88320UL) : (crc >> 1);
+        }
+        NvM_CrcTable[i] = crc;
+    }
+}
+
+// Tính CRC-32 của dữ liệu
+static uint32_t NvM_CalculateCrc(const uint8_t* data, uint32_t length) {
+    uint32_t crc = 0xFFFFFFFFUL;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = NvM_CrcTable[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFUL;
+}
+
+// Lấy mô tả block theo blockId, NULL nếu không tồn tại
+static const NvM_BlockDescriptorType* NvM_GetDescriptor(NvM_BlockIdType blockId) {
+    if (blockId == 0 || blockId > NVM_NUM_BLOCKS) {
+        return NULL;
+    }
+    return &NvM_BlockDescriptors[blockId - 1U];
+}
+
+// Ghi header cho một sector đã xóa
+static Std_ReturnType NvM_WriteSectorHeader(uint8_t sector, uint32_t sequence) {
+    NvM_SectorHeaderType header = { NVM_SECTOR_MAGIC, sequence, { 0, 0 } };
+    return Fls_Write(NVM_SECTOR_ADDRESS(sector), (const uint8_t*)&header, sizeof(header));
+}
+
+// Xóa toàn bộ vùng NvM và bắt đầu log mới ở sector 0
+static Std_ReturnType NvM_Format(void) {
+    if (Fls_Erase(NVM_AREA_START, NVM_AREA_SIZE) != E_OK) {
+        return E_NOT_OK;
+    }
+    NvM_ActiveSector = 0;
+    NvM_Sequence = 1;
+    NvM_WriteOffset = sizeof(NvM_SectorHeaderType);
+    return NvM_WriteSectorHeader(0, NvM_Sequence);
+}
+
+// Duyệt các bản ghi của một sector, cập nhật chỉ mục bản ghi mới nhất của từng block.
+// Trả về vị trí ghi tiếp theo (FLS_SECTOR_SIZE nếu phần còn lại của sector không dùng được)
+static uint32_t NvM_ScanSector(uint8_t sector) {
+    const NvM_SectorHeaderType* sectorHeader = (const NvM_SectorHeaderType*)NvM_SectorBuffer;
+    uint32_t offset = sizeof(NvM_SectorHeaderType);
+
+    if (Fls_Read(NVM_SECTOR_ADDRESS(sector), NvM_SectorBuffer, FLS_SECTOR_SIZE) != E_OK ||
+        sectorHeader->magic != NVM_SECTOR_MAGIC) {
+        return FLS_SECTOR_SIZE;
+    }
+
+    while (offset + sizeof(NvM_RecordHeaderType) <= FLS_SECTOR_SIZE) {
+        const NvM_RecordHeaderType* header = (const NvM_RecordHeaderType*)&NvM_SectorBuffer[offset];
+        if (header->magic == NVM_RECORD_BLANK) {
+            return offset;
+        }
+        if (header->magic != NVM_RECORD_MAGIC || header->length > NVM_MAX_BLOCK_LENGTH ||
+            offset + NVM_RECORD_SIZE(header->length) > FLS_SECTOR_SIZE) {
+            return FLS_SECTOR_SIZE;  // Bản ghi hỏng (ví dụ mất điện khi đang ghi)
+        }
+
+        const NvM_BlockDescriptorType* descriptor = NvM_GetDescriptor(header->blockId);
+        if (descriptor != NULL && descriptor->length == header->length) {
+            uint16_t index = (uint16_t)(header->blockId - 1U);
+            const uint8_t* data = &NvM_SectorBuffer[offset + sizeof(NvM_RecordHeaderType)];
+            if (NvM_CalculateCrc(data, header->length) == header->crc) {
+                NvM_RecordAddress[index] = NVM_SECTOR_ADDRESS(sector) + offset;
+                NvM_IntegrityFailed[index] = 0;
+            } else {
+                NvM_IntegrityFailed[index] = 1;  // Giữ bản ghi hợp lệ cũ hơn nếu có
+            }
+        }
+        offset += NVM_RECORD_SIZE(header->length);
+    }
+    return FLS_SECTOR_SIZE;
+}
+
+// Chuyển các bản ghi còn hiệu lực ra khỏi một sector rồi xóa sector đó
+static Std_ReturnType NvM_ReclaimSector(uint8_t sector) {
+    uint32_t start = NVM_SECTOR_ADDRESS(sector);
+    Std_ReturnType result = E_OK;
+
+    NvM_Relocating = 1;
+    for (uint16_t i = 0; i < NVM_NUM_BLOCKS && result == E_OK; i++) {
+        uint32_t address = NvM_RecordAddress[i];
+        if (address == NVM_NO_RECORD || address < start || address >= start + FLS_SECTOR_SIZE) {
+            continue;
+        }
+        uint16_t length = NvM_BlockDescriptors[i].length;
+        result = Fls_Read(address + (uint32_t)sizeof(NvM_RecordHeaderType), NvM_RelocationBuffer, length);
+        if (result == E_OK) {
+            result = NvM_AppendRecord(i, NvM_RelocationBuffer, length);
+        }
+    }
+    NvM_Relocating = 0;
+
+    if (result != E_OK) {
+        return E_NOT_OK;  // Vùng NvM quá đầy: giữ nguyên sector để không mất dữ liệu
+    }
+    return Fls_Erase(start, FLS_SECTOR_SIZE);
+}
+
+// Chuyển sang sector dự phòng, sau đó dọn sector cũ nhất để làm sector dự phòng mới
+static Std_ReturnType NvM_AdvanceSector(void) {
+    uint8_t next = (uint8_t)((NvM_ActiveSector + 1U) % NVM_SECTOR_COUNT);
+
+    if (NvM_Relocating) {
+        return E_NOT_OK;
+    }
+    if (NvM_WriteSectorHeader(next, NvM_Sequence + 1U) != E_OK) {
+        // Sector dự phòng không sạch (ví dụ mất điện khi đang dọn): xóa rồi thử lại
+        if (Fls_Erase(NVM_SECTOR_ADDRESS(next), FLS_SECTOR_SIZE) != E_OK ||
+            NvM_WriteSectorHeader(next, NvM_Sequence + 1U) != E_OK) {
+            return E_NOT_OK;
+        }
+    }
+    NvM_Sequence++;
+    NvM_ActiveSector = next;
+    NvM_WriteOffset = sizeof(NvM_SectorHeaderType);
+
+    return NvM_ReclaimSector((uint8_t)((next + 1U) % NVM_SECTOR_COUNT));
+}
+
+// Ghi một bản ghi mới của block vào cuối log
+static Std_ReturnType NvM_AppendRecord(uint16_t index, const uint8_t* data, uint16_t length) {
+    uint32_t size = NVM_RECORD_SIZE(length);
+
+    for (uint8_t attempt = 0; attempt <= NVM_SECTOR_COUNT; attempt++) {
+        if (NvM_WriteOffset + size <= FLS_SECTOR_SIZE) {
+            NvM_RecordHeaderType header = {
+                NVM_RECORD_MAGIC, NvM_BlockDescriptors[index].blockId, length, 0,
+                NvM_CalculateCrc(data, length)
+            };
+            memcpy(NvM_RecordBuffer, &header, sizeof(header));
+            memcpy(&NvM_RecordBuffer[sizeof(header)], data, length);
+            memset(&NvM_RecordBuffer[sizeof(header) + length], 0xFF, size - sizeof(header) - length);
+
+            uint32_t address = NVM_SECTOR_ADDRESS(NvM_ActiveSector) + NvM_WriteOffset;
+            if (Fls_Write(address, NvM_RecordBuffer, size) == E_OK) {
+                NvM_RecordAddress[index] = address;
+                NvM_IntegrityFailed[index] = 0;
+                NvM_WriteOffset += size;
+                return E_OK;
+            }
+            NvM_WriteOffset = FLS_SECTOR_SIZE;  // Vùng đích không sạch: bỏ phần còn lại của sector
+        }
+        if (NvM_AdvanceSector() != E_OK) {
+            return E_NOT_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+// Xếp block vào hàng đợi ghi (gọi khi đang giữ NvM_Lock)
+static void NvM_QueueBlock(uint16_t index) {
+    if (!NvM_BlockQueued[index]) {
+        NvM_WriteQueue[(NvM_QueueHead + NvM_QueueCount) % NVM_NUM_BLOCKS] = index;
+        NvM_QueueCount++;
+        NvM_BlockQueued[index] = 1;
+    }
+    NvM_BlockStatus[index] = NVM_REQ_PENDING;
+}
+
+// Khởi tạo NvM: tìm sector đang hoạt động và dựng chỉ mục bản ghi mới nhất của từng block
+void NvM_Init(void) {
+    uint8_t found = 0;
+
+    NvM_InitCrcTable();
+
+    pthread_mutex_lock(&NvM_FlashLock);
+    for (uint16_t i = 0; i < NVM_NUM_BLOCKS; i++) {
+        NvM_RecordAddress[i] = NVM_NO_RECORD;
+        NvM_IntegrityFailed[i] = 0;
+    }
+
+    // Sector có số thứ tự lớn nhất là sector đang ghi
+    for (uint8_t sector = 0; sector < NVM_SECTOR_COUNT; sector++) {
+        NvM_SectorHeaderType header;
+        if (Fls_Read(NVM_SECTOR_ADDRESS(sector), (uint8_t*)&header, sizeof(header)) == E_OK &&
+            header.magic == NVM_SECTOR_MAGIC && (!found || header.sequence > NvM_Sequence)) {
+            NvM_ActiveSector = sector;
+            NvM_Sequence = header.sequence;
+            found = 1;
+        }
+    }
+
+    if (!found) {
+        if (NvM_Format() != E_OK) {
+            printf("NvM: cannot format NV area.\n");
+        }
+    } else {
+        // Duyệt từ sector cũ nhất tới sector đang ghi để bản ghi mới hơn ghi đè chỉ mục
+        for (uint8_t i = 1; i <= NVM_SECTOR_COUNT; i++) {
+            uint8_t sector = (uint8_t)((NvM_ActiveSector + i) % NVM_SECTOR_COUNT);
+            NvM_WriteOffset = NvM_ScanSector(sector);
+        }
+        // Hoàn tất việc dọn sector dự phòng nếu lần chạy trước bị ngắt giữa chừng
+        uint8_t spare = (uint8_t)((NvM_ActiveSector + 1U) % NVM_SECTOR_COUNT);
+        if (Fls_BlankCheck(NVM_SECTOR_ADDRESS(spare), FLS_SECTOR_SIZE) != E_OK) {
+            NvM_ReclaimSector(spare);
+        }
+    }
+    pthread_mutex_unlock(&NvM_FlashLock);
+
+    pthread_mutex_lock(&NvM_Lock);
+    for (uint16_t i = 0; i < NVM_NUM_BLOCKS; i++) {
+        NvM_BlockStatus[i] = NVM_REQ_NV_INVALIDATED;
+        NvM_BlockQueued[i] = 0;
+    }
+    NvM_QueueHead = 0;
+    NvM_QueueCount = 0;
+    pthread_mutex_unlock(&NvM_Lock);
+
+    printf("NVRAM Manager (NvM) Initialized: sector %u, sequence %lu.\n",
+           (unsigned)NvM_ActiveSector, (unsigned long)NvM_Sequence);
+}
+
+// Nạp toàn bộ block từ flash vào RAM mirror
+Std_ReturnType NvM_ReadAll(void) {
+    Std_ReturnType result = E_OK;
+
+    pthread_mutex_lock(&NvM_FlashLock);
+    pthread_mutex_lock(&NvM_Lock);
+    for (uint16_t i = 0; i < NVM_NUM_BLOCKS; i++) {
+        const NvM_BlockDescriptorType* descriptor = &NvM_BlockDescriptors[i];
+        uint32_t address = NvM_RecordAddress[i];
+
+        if (address != NVM_NO_RECORD &&
+            Fls_Read(address + (uint32_t)sizeof(NvM_RecordHeaderType), descriptor->ramBlock, descriptor->length) == E_OK) {
+            NvM_BlockStatus[i] = NVM_REQ_OK;
+            continue;
+        }
+
+        memcpy(descriptor->ramBlock, descriptor->romBlock, descriptor->length);
+        NvM_BlockStatus[i] = NvM_IntegrityFailed[i] ? NVM_REQ_INTEGRITY_FAILED : NVM_REQ_RESTORED_FROM_ROM;
+        result = E_NOT_OK;
+    }
+    pthread_mutex_unlock(&NvM_Lock);
+    pthread_mutex_unlock(&NvM_FlashLock);
+
+    return result;
+}
+
+// Sao chép RAM mirror của block vào bộ đệm của caller
+Std_ReturnType NvM_ReadBlock(NvM_BlockIdType blockId, void* dstPtr) {
+    const NvM_BlockDescriptorType* descriptor = NvM_GetDescriptor(blockId);
+    if (descriptor == NULL || dstPtr == NULL) {
+        return E_NOT_OK;
+    }
+
+    pthread_mutex_lock(&NvM_Lock);
+    memcpy(dstPtr, descriptor->ramBlock, descriptor->length);
+    pthread_mutex_unlock(&NvM_Lock);
+    return E_OK;
+}
+
+// Cập nhật RAM mirror và xếp block vào hàng đợi ghi nền
+Std_ReturnType NvM_WriteBlock(NvM_BlockIdType blockId, const void* srcPtr) {
+    const NvM_BlockDescriptorType* descriptor = NvM_GetDescriptor(blockId);
+    if (descriptor == NULL || srcPtr == NULL) {
+        return E_NOT_OK;
+    }
+
+    pthread_mutex_lock(&NvM_Lock);
+    memcpy(descriptor->ramBlock, srcPtr, descriptor->length);
+    NvM_QueueBlock((uint16_t)(blockId - 1U));
+    pthread_mutex_unlock(&NvM_Lock);
+    return E_OK;
+}
+
+// Khôi phục RAM mirror về giá trị mặc định và xếp block vào hàng đợi ghi
+Std_ReturnType NvM_RestoreBlockDefaults(NvM_BlockIdType blockId) {
+    const NvM_BlockDescriptorType* descriptor = NvM_GetDescriptor(blockId);
+    if (descriptor == NULL) {
+        return E_NOT_OK;
+    }
+    return NvM_WriteBlock(blockId, descriptor->romBlock);
+}
+
+// Lấy trạng thái yêu cầu gần nhất của block
+Std_ReturnType NvM_GetErrorStatus(NvM_BlockIdType blockId, NvM_RequestResultType* requestResultPtr) {
+    if (NvM_GetDescriptor(blockId) == NULL || requestResultPtr == NULL) {
+        return E_NOT_OK;
+    }
+
+    pthread_mutex_lock(&NvM_Lock);
+    *requestResultPtr = NvM_BlockStatus[blockId - 1U];
+    pthread_mutex_unlock(&NvM_Lock);
+    return E_OK;
+}
+
+// Tìm block theo tên
+Std_ReturnType NvM_GetBlockIdByName(const char* name, NvM_BlockIdType* blockIdPtr) {
+    if (name == NULL || blockIdPtr == NULL) {
+        return E_NOT_OK;
+    }
+    for (uint16_t i = 0; i < NVM_NUM_BLOCKS; i++) {
+        if (strcmp(NvM_BlockDescriptors[i].name, name) == 0) {
+            *blockIdPtr = NvM_BlockDescriptors[i].blockId;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+// Hàm chu kỳ: lấy một block khỏi hàng đợi, chụp RAM mirror rồi ghi xuống flash ngoài khóa dữ liệu
+void NvM_MainFunction(void) {
+    pthread_mutex_lock(&NvM_Lock);
+    if (NvM_QueueCount == 0) {
+        pthread_mutex_unlock(&NvM_Lock);
+        return;
+    }
+    uint16_t index = NvM_WriteQueue[NvM_QueueHead];
+    NvM_QueueHead = (uint16_t)((NvM_QueueHead + 1U) % NVM_NUM_BLOCKS);
+    NvM_QueueCount--;
+    NvM_BlockQueued[index] = 0;
+    uint16_t length = NvM_BlockDescriptors[index].length;
+    memcpy(NvM_WriteBuffer, NvM_BlockDescriptors[index].ramBlock, length);
+    pthread_mutex_unlock(&NvM_Lock);
+
+    pthread_mutex_lock(&NvM_FlashLock);
+    Std_ReturnType result = NvM_AppendRecord(index, NvM_WriteBuffer, length);
+    pthread_mutex_unlock(&NvM_FlashLock);
+
+    pthread_mutex_lock(&NvM_Lock);
+    if (!NvM_BlockQueued[index]) {  // Block được ghi lại trong lúc chờ flash: vẫn đang pending
+        NvM_BlockStatus[index] = (result == E_OK) ? NVM_REQ_OK : NVM_REQ_NOT_OK;
+    }
+    pthread_mutex_unlock(&NvM_Lock);
+}
+
+// Ghi toàn bộ block đang chờ xuống flash
+void NvM_WriteAll(void) {
+    uint16_t pending;
+
+    do {
+        NvM_MainFunction();
+        pthread_mutex_lock(&NvM_Lock);
+        pending = NvM_QueueCount;
+        pthread_mutex_unlock(&NvM_Lock);
+    } while (pending > 0);
+}
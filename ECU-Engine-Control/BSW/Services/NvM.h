@@ -0,0 +1,99 @@
+#ifndef NVM_H
+#define NVM_H
+
+#include <stdio.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Fls.h"
+
+// Vùng flash dành cho NvM: các sector cuối cùng của bộ nhớ flash mô phỏng.
+// Các sector được ghi nối tiếp theo vòng (log) để phân đều số lần xóa
+#define NVM_SECTOR_COUNT 16U
+#define NVM_AREA_SIZE (NVM_SECTOR_COUNT * FLS_SECTOR_SIZE)
+#define NVM_AREA_START (FLS_BASE_ADDRESS + FLS_TOTAL_SIZE - NVM_AREA_SIZE)
+
+// Độ dài tối đa của dữ liệu một block (byte)
+#define NVM_MAX_BLOCK_LENGTH 512U
+
+// Chu kỳ gọi NvM_MainFunction (ms), mỗi lần ghi tối đa một block xuống flash
+#define NVM_MAIN_FUNCTION_PERIOD_MS 10U
+
+// Định danh các block
+typedef uint16_t NvM_BlockIdType;
+#define NVM_BLOCK_TORQUE_CALIBRATION 1U
+#define NVM_BLOCK_SENSOR_CALIBRATION 2U
+#define NVM_NUM_BLOCKS 2U
+
+// Trạng thái của yêu cầu gần nhất trên một block
+typedef uint8_t NvM_RequestResultType;
+#define NVM_REQ_OK 0x00                 // Dữ liệu trong RAM khớp với flash
+#define NVM_REQ_NOT_OK 0x01             // Ghi xuống flash thất bại
+#define NVM_REQ_PENDING 0x02            // Đang chờ ghi trong hàng đợi
+#define NVM_REQ_INTEGRITY_FAILED 0x03   // Dữ liệu trên flash sai CRC, đã dùng giá trị mặc định
+#define NVM_REQ_NV_INVALIDATED 0x05     // Chưa có dữ liệu trên flash
+#define NVM_REQ_RESTORED_FROM_ROM 0x08  // Đã nạp giá trị mặc định
+
+// Kích thước bản đồ mô-men yêu cầu và đường cong bù tải của Torque Control
+#define NVM_TORQUE_MAP_SPEED_POINTS    6U
+#define NVM_TORQUE_MAP_THROTTLE_POINTS 6U
+#define NVM_LOAD_CURVE_POINTS          4U
+
+// Hiệu chuẩn của Torque Control
+typedef struct {
+    float MaxTorque;             // Mô-men xoắn tối đa (Nm)
+    float TorqueMapSpeed[NVM_TORQUE_MAP_SPEED_POINTS];        // Điểm chia trục tốc độ (km/h), tăng dần
+    float TorqueMapThrottle[NVM_TORQUE_MAP_THROTTLE_POINTS];  // Điểm chia trục bàn đạp ga (0..1), tăng dần
+    float TorqueMap[NVM_TORQUE_MAP_THROTTLE_POINTS][NVM_TORQUE_MAP_SPEED_POINTS];  // Mô-men yêu cầu (Nm) theo [ga][tốc độ]
+    float LoadCurveWeight[NVM_LOAD_CURVE_POINTS];             // Điểm chia trục tải trọng (kg), tăng dần
+    float LoadCurveOffset[NVM_LOAD_CURVE_POINTS];             // Mô-men cộng thêm theo tải trọng (Nm)
+    float TorqueKp;              // Hệ số tỉ lệ của vòng kín mô-men (Nm/Nm)
+    float TorqueKi;              // Hệ số tích phân của vòng kín mô-men (1/s)
+    float TorqueRateLimit;       // Tốc độ thay đổi tối đa của lệnh mô-men (Nm/s)
+} NvM_TorqueCalibrationType;
+
+// Hiệu chuẩn dải đo của các cảm biến và bộ điều khiển động cơ
+typedef struct {
+    uint16_t SpeedMaxValue;      // Tốc độ ứng với giá trị ADC tối đa (km/h)
+    uint16_t LoadMaxValue;       // Tải trọng ứng với giá trị ADC tối đa (kg)
+    uint16_t TorqueMaxValue;     // Mô-men xoắn ứng với giá trị ADC tối đa (Nm)
+    uint16_t MotorMaxTorque;     // Mô-men xoắn tối đa của động cơ (Nm)
+} NvM_SensorCalibrationType;
+
+// Mô tả một block: tên, RAM mirror và giá trị mặc định (ROM)
+typedef struct {
+    NvM_BlockIdType blockId;
+    const char* name;
+    void* ramBlock;              // RAM mirror do NvM sở hữu
+    uint16_t length;             // Độ dài dữ liệu (byte)
+    const void* romBlock;        // Giá trị mặc định khi flash không có dữ liệu hợp lệ
+} NvM_BlockDescriptorType;
+
+// Khởi tạo NvM: tìm sector đang hoạt động và dựng chỉ mục bản ghi mới nhất của từng block
+void NvM_Init(void);
+
+// Nạp toàn bộ block từ flash vào RAM mirror, block không hợp lệ được nạp giá trị mặc định.
+// Trả về E_NOT_OK nếu có block phải dùng giá trị mặc định
+Std_ReturnType NvM_ReadAll(void);
+
+// Sao chép RAM mirror của block vào bộ đệm của caller
+Std_ReturnType NvM_ReadBlock(NvM_BlockIdType blockId, void* dstPtr);
+
+// Cập nhật RAM mirror và xếp block vào hàng đợi ghi nền (không chặn)
+Std_ReturnType NvM_WriteBlock(NvM_BlockIdType blockId, const void* srcPtr);
+
+// Khôi phục RAM mirror về giá trị mặc định và xếp block vào hàng đợi ghi
+Std_ReturnType NvM_RestoreBlockDefaults(NvM_BlockIdType blockId);
+
+// Lấy trạng thái yêu cầu gần nhất của block
+Std_ReturnType NvM_GetErrorStatus(NvM_BlockIdType blockId, NvM_RequestResultType* requestResultPtr);
+
+// Tìm block theo tên
+Std_ReturnType NvM_GetBlockIdByName(const char* name, NvM_BlockIdType* blockIdPtr);
+
+// Hàm chu kỳ: ghi một block đang chờ trong hàng đợi xuống flash
+void NvM_MainFunction(void);
+
+// Ghi toàn bộ block đang chờ xuống flash (dùng khi tắt hệ thống)
+void NvM_WriteAll(void);
+
+#endif // NVM_H
@@ -1,9 +1,13 @@
 #include "Os.h"
+#include <errno.h>
 
 // Biến lưu trữ luồng
-#define MAX_TASKS 9
+#define MAX_TASKS 12
 pthread_t task_threads[MAX_TASKS];
 int task_count = 0;
+static int Os_RealtimeDenied = 0;   // 1 khi không có quyền dùng SCHED_FIFO (đã báo một lần)
+static int Os_VirtualClock = 0;     // 1 khi thời gian do Os_SetVirtualTimeNs đặt
+static uint64_t Os_VirtualTimeNs = 0;
 
 // Khởi tạo hệ điều hành
 void Os_Init(void) {
@@ -12,22 +16,126 @@ void Os_Init(void) {
 }
 
 // Tạo và khởi động một luồng
-void Os_CreateTask(void* (*task_func)(void*), const char* task_name) {
+void Os_CreateTask(void* (*task_func)(void*), const char* task_name, int priority) {
     if (task_count >= MAX_TASKS) {
         printf("Cannot create more tasks. Maximum task count reached.\n");
         return;
     }
-    
-    printf("Creating task: %s\n", task_name);
-    pthread_create(&task_threads[task_count], NULL, task_func, NULL);
+
+    printf("Creating task: %s (priority %d)\n", task_name, priority);
+    int result = EPERM;
+    if (priority > OS_PRIORITY_DEFAULT && !Os_RealtimeDenied) {
+        pthread_attr_t attr;
+        struct sched_param param = { .sched_priority = priority };
+        pthread_attr_init(&attr);
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+        result = pthread_create(&task_threads[task_count], &attr, task_func, NULL);
+        pthread_attr_destroy(&attr);
+        if (result == EPERM) {
+            printf("No permission for real-time scheduling, tasks run with default priority.\n");
+            Os_RealtimeDenied = 1;
+        }
+    }
+    if (result != 0) {
+        result = pthread_create(&task_threads[task_count], NULL, task_func, NULL);
+    }
+    if (result != 0) {
+        printf("Failed to create task: %s\n", task_name);
+        return;
+    }
     task_count++;
 }
 
 // Hàm delay để dừng luồng trong một khoảng thời gian
 void Os_Delay(int milliseconds) {
+    if (Os_VirtualClock) {
+        return;  // Đồng hồ ảo do nơi gọi tiến, không chờ theo thời gian thực
+    }
     usleep(milliseconds * 1000); // Sử dụng usleep cho delay tính theo mili giây
 }
 
+// Lấy thời gian hệ thống đơn điệu (không bị ảnh hưởng khi chỉnh đồng hồ), tính bằng mili giây
+uint32_t Os_GetTimeMs(void) {
+    if (Os_VirtualClock) {
+        return (uint32_t)(Os_VirtualTimeNs / 1000000U);
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U);
+}
+
+// Lấy thời gian hệ thống đơn điệu, tính bằng nano giây
+uint64_t Os_GetTimeNs(void) {
+    if (Os_VirtualClock) {
+        return Os_VirtualTimeNs;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+// Ngủ tới thời điểm tuyệt đối, dùng cho tác vụ chu kỳ ngắn (ví dụ vòng dòng điện ở tần số PWM)
+void Os_SleepUntilNs(uint64_t DeadlineNs) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(DeadlineNs / 1000000000U);
+    ts.tv_nsec = (long)(DeadlineNs % 1000000000U);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+        // Bị ngắt bởi tín hiệu: ngủ tiếp tới cùng thời điểm
+    }
+}
+
+// Chuyển sang đồng hồ ảo (mô phỏng một luồng, nhanh hơn thời gian thực)
+void Os_StartVirtualClock(uint64_t StartNs) {
+    Os_VirtualTimeNs = StartNs;
+    Os_VirtualClock = 1;
+}
+
+// Tiến đồng hồ ảo, không lùi
+void Os_SetVirtualTimeNs(uint64_t TimeNs) {
+    if (TimeNs > Os_VirtualTimeNs) {
+        Os_VirtualTimeNs = TimeNs;
+    }
+}
+
+// Khởi tạo đối tượng sự kiện, biến điều kiện dùng đồng hồ đơn điệu để thời hạn chờ khớp Os_GetTimeNs
+void Os_InitEvent(Os_EventType* Event) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&Event->Cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&Event->Lock, NULL);
+    Event->Pending = 0U;
+}
+
+// Đặt sự kiện và đánh thức task chờ
+void Os_SetEvent(Os_EventType* Event, Os_EventMaskType Mask) {
+    pthread_mutex_lock(&Event->Lock);
+    Event->Pending |= Mask;
+    pthread_cond_signal(&Event->Cond);
+    pthread_mutex_unlock(&Event->Lock);
+}
+
+// Chờ sự kiện hoặc hết thời hạn, trả về và xóa các sự kiện đã xảy ra
+Os_EventMaskType Os_WaitEvent(Os_EventType* Event, Os_EventMaskType Mask, uint64_t DeadlineNs) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(DeadlineNs / 1000000000U);
+    ts.tv_nsec = (long)(DeadlineNs % 1000000000U);
+
+    pthread_mutex_lock(&Event->Lock);
+    while ((Event->Pending & Mask) == 0U) {
+        if (pthread_cond_timedwait(&Event->Cond, &Event->Lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    Os_EventMaskType events = Event->Pending & Mask;
+    Event->Pending &= ~events;
+    pthread_mutex_unlock(&Event->Lock);
+    return events;
+}
+
 // Kết thúc hệ điều hành và chờ các luồng kết thúc
 void Os_Shutdown(void) {
     printf("Shutting down OS and waiting for tasks to finish...\n");
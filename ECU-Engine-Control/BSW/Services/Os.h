@@ -4,16 +4,57 @@
 #include <stdio.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <stdint.h>
+#include <time.h>
 
 // Khởi tạo hệ điều hành (OS)
 void Os_Init(void);
 
-// Tạo và khởi động một luồng (thread)
-void Os_CreateTask(void* (*task_func)(void*), const char* task_name);
+// Ưu tiên mặc định: task chạy theo lập lịch thường của hệ điều hành
+#define OS_PRIORITY_DEFAULT 0
 
-// Hàm delay để mô phỏng việc ngừng luồng trong một thời gian nhất định
+// Tạo và khởi động một luồng (thread). priority 1..99 chạy theo lập lịch thời gian thực
+// SCHED_FIFO (số lớn ưu tiên cao); khi không có quyền, task chạy với lập lịch thường
+void Os_CreateTask(void* (*task_func)(void*), const char* task_name, int priority);
+
+// Hàm delay để mô phỏng việc ngừng luồng trong một thời gian nhất định (trả về ngay khi dùng đồng hồ ảo)
 void Os_Delay(int milliseconds);
 
+// Lấy thời gian hệ thống đơn điệu (monotonic) tính bằng mili giây
+uint32_t Os_GetTimeMs(void);
+
+// Lấy thời gian hệ thống đơn điệu tính bằng nano giây (cho các tác vụ chu kỳ micro giây)
+uint64_t Os_GetTimeNs(void);
+
+// Ngủ tới thời điểm tuyệt đối DeadlineNs (theo Os_GetTimeNs), không tích lũy sai số chu kỳ
+void Os_SleepUntilNs(uint64_t DeadlineNs);
+
+// Chuyển Os_GetTimeMs/Os_GetTimeNs sang đồng hồ ảo bắt đầu tại StartNs, dùng khi mô phỏng nhanh
+// hơn thời gian thực: các runnable được gọi trực tiếp trên một luồng, không có task chờ theo thời gian
+void Os_StartVirtualClock(uint64_t StartNs);
+
+// Tiến đồng hồ ảo tới thời điểm TimeNs; thời điểm nhỏ hơn hiện tại bị bỏ qua (đồng hồ không lùi)
+void Os_SetVirtualTimeNs(uint64_t TimeNs);
+
+// Sự kiện của task: mỗi bit là một sự kiện, được đặt từ task khác và chờ bởi task sở hữu
+typedef uint32_t Os_EventMaskType;
+
+typedef struct {
+    pthread_mutex_t Lock;
+    pthread_cond_t Cond;          // Dùng đồng hồ CLOCK_MONOTONIC như Os_GetTimeNs
+    Os_EventMaskType Pending;     // Các sự kiện đã đặt nhưng chưa được xử lý
+} Os_EventType;
+
+// Khởi tạo đối tượng sự kiện; gọi trước khi các task dùng nó được tạo
+void Os_InitEvent(Os_EventType* Event);
+
+// Đặt các sự kiện trong Mask và đánh thức task đang chờ
+void Os_SetEvent(Os_EventType* Event, Os_EventMaskType Mask);
+
+// Chờ tới khi có sự kiện trong Mask hoặc tới thời điểm tuyệt đối DeadlineNs (theo Os_GetTimeNs).
+// Trả về các sự kiện đã xảy ra trong Mask và xóa chúng; trả về 0 khi hết thời gian chờ
+Os_EventMaskType Os_WaitEvent(Os_EventType* Event, Os_EventMaskType Mask, uint64_t DeadlineNs);
+
 // Hàm kết thúc hệ điều hành (OS) và chờ các luồng kết thúc
 void Os_Shutdown(void);
 
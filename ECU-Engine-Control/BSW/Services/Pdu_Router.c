@@ -1,13 +1,14 @@
 #include "Pdu_Router.h"
+#include "Dlt.h"
 
 // Khởi tạo hệ thống PDU Router
 void PduR_Init(void) {
-    printf("PDU Router Initialized.\n");
+    DLT_LOG_INFO(DLT_MSG_PDUR_INIT);
 }
 
 // Định tuyến PDU dựa trên giao thức
 void PduR_RoutePdu(Pdu_Type* pdu) {
-    printf("Routing PDU: Protocol ID = 0x%x, Data = %s, Length = %d\n", pdu->protocol_id, pdu->data, pdu->length);
+    DLT_LOG_DEBUG(DLT_MSG_PDUR_ROUTE, DLT_U32(pdu->protocol_id), DLT_I32(pdu->length));
 
     switch (pdu->protocol_id) {
         case PROTOCOL_CAN:
@@ -23,25 +24,25 @@ void PduR_RoutePdu(Pdu_Type* pdu) {
             break;
 
         default:
-            printf("Unknown protocol ID: 0x%x\n", pdu->protocol_id);
+            DLT_LOG_WARN(DLT_MSG_PDUR_UNKNOWN_PROTOCOL, DLT_U32(pdu->protocol_id));
             break;
     }
 }
 
 // Xử lý PDU cho giao thức CAN
 void PduR_CanHandler(Pdu_Type* pdu) {
-    printf("Handling CAN PDU: Data = %s, Length = %d\n", pdu->data, pdu->length);
+    DLT_LOG_DEBUG(DLT_MSG_PDUR_CAN, DLT_I32(pdu->length));
     // Xử lý dữ liệu theo giao thức CAN
 }
 
 // Xử lý PDU cho giao thức LIN
 void PduR_LinHandler(Pdu_Type* pdu) {
-    printf("Handling LIN PDU: Data = %s, Length = %d\n", pdu->data, pdu->length);
+    DLT_LOG_DEBUG(DLT_MSG_PDUR_LIN, DLT_I32(pdu->length));
     // Xử lý dữ liệu theo giao thức LIN
 }
 
 // Xử lý PDU cho giao thức Ethernet
 void PduR_EthernetHandler(Pdu_Type* pdu) {
-    printf("Handling Ethernet PDU: Data = %s, Length = %d\n", pdu->data, pdu->length);
+    DLT_LOG_DEBUG(DLT_MSG_PDUR_ETHERNET, DLT_I32(pdu->length));
     // Xử lý dữ liệu theo giao thức Ethernet
 }
@@ -0,0 +1,68 @@
+#include "Pid.h"
+
+static float Pid_Clamp(float Value, float Min, float Max) {
+    return (Value > Max) ? Max : ((Value < Min) ? Min : Value);
+}
+
+Std_ReturnType Pid_Configure(Pid_StateType* State, const Pid_ConfigType* Config) {
+    if (State == NULL || Config == NULL) {
+        return E_NOT_OK;
+    }
+    if (!(Config->SampleTime > 0.0f) || !(Config->OutputMin <= Config->OutputMax) ||
+        !(Config->Kp >= 0.0f) || !(Config->Ki >= 0.0f) || !(Config->Kd >= 0.0f) || !(Config->RateLimit >= 0.0f)) {
+        return E_NOT_OK;
+    }
+
+    State->Kp = Config->Kp;
+    State->KiTs = Config->Ki * Config->SampleTime;
+    State->KdDivTs = Config->Kd / Config->SampleTime;
+    State->MaxStep = Config->RateLimit * Config->SampleTime;
+    State->OutputMin = Config->OutputMin;
+    State->OutputMax = Config->OutputMax;
+
+    // Tích phân chỉ bù sai lệch của feed-forward nên không cần vượt quá độ rộng dải đầu ra
+    float span = Config->OutputMax - Config->OutputMin;
+    State->Integral = (Config->Ki > 0.0f) ? Pid_Clamp(State->Integral, -span, span) : 0.0f;
+    State->Output = Pid_Clamp(State->Output, Config->OutputMin, Config->OutputMax);
+    return E_OK;
+}
+
+void Pid_Reset(Pid_StateType* State, float Output) {
+    State->Integral = 0.0f;
+    State->PrevMeasurement = 0.0f;
+    State->Primed = 0U;
+    State->Output = Pid_Clamp(Output, State->OutputMin, State->OutputMax);
+}
+
+float Pid_Step(Pid_StateType* State, float Reference, float Measurement, float FeedForward) {
+    float error = Reference - Measurement;
+    if (!State->Primed) {
+        State->PrevMeasurement = Measurement;
+        State->Primed = 1U;
+    }
+
+    float proportional = State->Kp * error;
+    float derivative = -State->KdDivTs * (Measurement - State->PrevMeasurement);
+    State->PrevMeasurement = Measurement;
+
+    // Dải cho phép của bước này: dải đầu ra giao với dải theo tốc độ thay đổi
+    float lower = State->OutputMin;
+    float upper = State->OutputMax;
+    if (State->MaxStep > 0.0f) {
+        lower = (State->Output - State->MaxStep > lower) ? (State->Output - State->MaxStep) : lower;
+        upper = (State->Output + State->MaxStep < upper) ? (State->Output + State->MaxStep) : upper;
+    }
+
+    // Chỉ giữ phần tích phân mới khi không đẩy đầu ra sâu thêm vào giới hạn
+    float span = State->OutputMax - State->OutputMin;
+    float integral = Pid_Clamp(State->Integral + State->KiTs * error, -span, span);
+    float output = FeedForward + proportional + integral + derivative;
+    if ((output > upper && error > 0.0f) || (output < lower && error < 0.0f)) {
+        integral = State->Integral;
+        output = FeedForward + proportional + integral + derivative;
+    }
+    State->Integral = integral;
+
+    State->Output = Pid_Clamp(output, lower, upper);
+    return State->Output;
+}
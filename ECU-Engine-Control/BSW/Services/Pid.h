@@ -0,0 +1,49 @@
+#ifndef PID_H
+#define PID_H
+
+#include <stddef.h>
+#include "Std_Types.h"
+
+// Bộ điều khiển PID dấu phẩy động dạng bước cố định cho các vòng điều khiển chậm
+// (mô-men, tốc độ). Hàm bước phải được gọi đúng một lần mỗi SampleTime; các hệ số
+// được tính sẵn theo SampleTime khi cấu hình nên mỗi bước không có phép chia.
+// - Thành phần vi phân tính trên giá trị đo (không bị giật khi giá trị đặt thay đổi).
+// - Feed-forward được cộng vào đầu ra trước khi giới hạn, vòng kín chỉ bù sai lệch.
+// - Chống bão hòa tích phân: tích phân dừng khi đầu ra đang bị giới hạn (theo dải
+//   đầu ra hoặc theo tốc độ thay đổi) và sai số cùng chiều với giới hạn.
+
+typedef struct {
+    float Kp;                   // Hệ số tỉ lệ
+    float Ki;                   // Hệ số tích phân (1/s), 0 = không tích phân
+    float Kd;                   // Hệ số vi phân (s), 0 = bộ điều khiển PI
+    float SampleTime;           // Chu kỳ gọi Pid_Step (s), phải lớn hơn 0
+    float OutputMin;            // Giới hạn dưới của đầu ra
+    float OutputMax;            // Giới hạn trên của đầu ra
+    float RateLimit;            // Tốc độ thay đổi tối đa của đầu ra (đơn vị/s), 0 = không giới hạn
+} Pid_ConfigType;
+
+typedef struct {
+    float Kp;
+    float KiTs;                 // Ki * SampleTime, tính sẵn khi cấu hình
+    float KdDivTs;              // Kd / SampleTime, tính sẵn khi cấu hình
+    float MaxStep;              // RateLimit * SampleTime, 0 = không giới hạn
+    float OutputMin;
+    float OutputMax;
+    float Integral;             // Thành phần tích phân
+    float PrevMeasurement;      // Giá trị đo của bước trước (vi phân)
+    float Output;               // Đầu ra của bước trước (giới hạn tốc độ)
+    uint8_t Primed;             // 1 khi đã có giá trị đo của bước trước
+} Pid_StateType;
+
+// Áp dụng cấu hình mới mà không xóa lịch sử (đổi hiệu chuẩn khi đang chạy); tích phân
+// và đầu ra được đưa về dải mới. E_NOT_OK nếu tham số không hợp lệ, trạng thái giữ nguyên
+Std_ReturnType Pid_Configure(Pid_StateType* State, const Pid_ConfigType* Config);
+
+// Xóa tích phân và lịch sử; bước tiếp theo bắt đầu từ Output (khởi động không giật)
+void Pid_Reset(Pid_StateType* State, float Output);
+
+// Một bước điều khiển: trả về FeedForward + P + I + D sau khi giới hạn theo dải
+// đầu ra và tốc độ thay đổi
+float Pid_Step(Pid_StateType* State, float Reference, float Measurement, float FeedForward);
+
+#endif
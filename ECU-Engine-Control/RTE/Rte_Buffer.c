@@ -0,0 +1,93 @@
+/******************************************************************************
+ * @file    Rte_Buffer.c
+ * @brief   Triển khai bộ đệm ba không khóa cho các phần tử dữ liệu của RTE
+ *
+ * @details Ô giữa được trao đổi bằng `atomic_exchange` với thứ tự acquire/release:
+ *          dữ liệu producer ghi vào ô trước phép hoán đổi luôn nhìn thấy được với
+ *          consumer sau khi consumer lấy ô đó.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "Rte_Buffer.h"
+#include <string.h>
+
+/******************************************************************************
+ * @brief   Cờ dữ liệu mới trong `Middle` (các bit thấp là chỉ số ô)
+ ******************************************************************************/
+#define RTE_TRIPLE_BUFFER_FRESH      0x4U
+#define RTE_TRIPLE_BUFFER_INDEX_MASK 0x3U
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo bộ đệm ba
+ *
+ * @details Producer bắt đầu với ô 0, ô giữa là ô 1 (chưa có dữ liệu mới), consumer
+ *          bắt đầu với ô 2.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Storage - Bộ nhớ cho ba ô
+ * @param   Size - Kích thước một phần tử (byte)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Rte_TripleBuffer_Init(Rte_TripleBufferType* Buffer, uint8_t* Storage, size_t Size) {
+    if (Buffer == NULL || Storage == NULL || Size == 0U) {
+        return E_NOT_OK;
+    }
+
+    for (uint8_t i = 0; i < RTE_TRIPLE_BUFFER_SLOTS; i++) {
+        Buffer->Slot[i] = Storage + (size_t)i * Size;
+    }
+    Buffer->Size = Size;
+    Buffer->Back = 0U;
+    atomic_init(&Buffer->Middle, 1U);
+    Buffer->Front = 2U;
+    Buffer->Received = 0U;
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm ghi một phần tử (phía producer)
+ *
+ * @details Sau phép hoán đổi, ô giữa cũ (consumer chưa lấy hoặc đã trả lại) trở
+ *          thành ô ghi tiếp theo của producer; phần tử cũ chưa được đọc bị bỏ qua.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Data - Con trỏ tới phần tử cần ghi
+ * @return  void
+ ******************************************************************************/
+void Rte_TripleBuffer_Write(Rte_TripleBufferType* Buffer, const void* Data) {
+    memcpy(Buffer->Slot[Buffer->Back], Data, Buffer->Size);
+
+    unsigned int previous = atomic_exchange_explicit(&Buffer->Middle,
+                                                     Buffer->Back | RTE_TRIPLE_BUFFER_FRESH,
+                                                     memory_order_acq_rel);
+    Buffer->Back = (uint8_t)(previous & RTE_TRIPLE_BUFFER_INDEX_MASK);
+}
+
+/******************************************************************************
+ * @brief   Hàm đọc phần tử mới nhất (phía consumer)
+ *
+ * @details Khi không có phần tử mới, consumer đọc lại ô hiện tại mà không cần phép
+ *          toán nguyên tử nào ngoài một lần load.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Data - Con trỏ lưu trữ bản sao của phần tử
+ * @return  Std_ReturnType - Trả về E_OK nếu đã có phần tử, E_NOT_OK nếu producer chưa ghi lần nào
+ ******************************************************************************/
+Std_ReturnType Rte_TripleBuffer_Read(Rte_TripleBufferType* Buffer, void* Data) {
+    if ((atomic_load_explicit(&Buffer->Middle, memory_order_relaxed) & RTE_TRIPLE_BUFFER_FRESH) != 0U) {
+        unsigned int previous = atomic_exchange_explicit(&Buffer->Middle, Buffer->Front, memory_order_acq_rel);
+        Buffer->Front = (uint8_t)(previous & RTE_TRIPLE_BUFFER_INDEX_MASK);
+        Buffer->Received = 1U;
+    }
+
+    if (!Buffer->Received) {
+        return E_NOT_OK;
+    }
+    memcpy(Data, Buffer->Slot[Buffer->Front], Buffer->Size);
+    return E_OK;
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * @file    Rte_Buffer.h
+ * @brief   Bộ đệm ba (triple buffer) không khóa cho các phần tử dữ liệu của RTE
+ *
+ * @details Bộ đệm ba cho phép một task ghi (producer) và một task đọc (consumer)
+ *          trao đổi một phần tử dữ liệu có kích thước bất kỳ mà không dùng mutex.
+ *          Producer luôn ghi vào ô riêng của mình rồi hoán đổi nguyên tử với ô giữa;
+ *          consumer lấy ô giữa khi có dữ liệu mới. Hai bên không bao giờ truy cập
+ *          cùng một ô, nên bản sao mà consumer đọc luôn nhất quán (không bị ghi dở),
+ *          producer không bao giờ phải chờ và consumer luôn nhận bản mới nhất.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef RTE_BUFFER_H
+#define RTE_BUFFER_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+#include "Std_Types.h"
+
+/******************************************************************************
+ * @brief   Số ô của bộ đệm ba
+ ******************************************************************************/
+#define RTE_TRIPLE_BUFFER_SLOTS 3U
+
+/******************************************************************************
+ * @brief   Cấu trúc bộ đệm ba
+ *
+ * @details `Middle` chứa chỉ số ô giữa và cờ dữ liệu mới, được hoán đổi nguyên tử.
+ *          `Back` chỉ được producer truy cập, `Front` và `Received` chỉ được consumer
+ *          truy cập. Bộ nhớ của ba ô do người gọi cấp (thường là mảng tĩnh).
+ ******************************************************************************/
+typedef struct {
+    uint8_t* Slot[RTE_TRIPLE_BUFFER_SLOTS];  /**< Ba ô dữ liệu */
+    size_t Size;                             /**< Kích thước một phần tử (byte) */
+    atomic_uint Middle;                      /**< Ô giữa | cờ dữ liệu mới */
+    uint8_t Back;                            /**< Ô producer đang ghi */
+    uint8_t Front;                           /**< Ô consumer đang đọc */
+    uint8_t Received;                        /**< Consumer đã nhận ít nhất một phần tử */
+} Rte_TripleBufferType;
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo bộ đệm ba
+ *
+ * @details Phải được gọi trước khi các task producer và consumer bắt đầu chạy.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Storage - Bộ nhớ cho ba ô, tối thiểu `RTE_TRIPLE_BUFFER_SLOTS * Size` byte
+ * @param   Size - Kích thước một phần tử (byte)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu tham số không hợp lệ
+ ******************************************************************************/
+Std_ReturnType Rte_TripleBuffer_Init(Rte_TripleBufferType* Buffer, uint8_t* Storage, size_t Size);
+
+/******************************************************************************
+ * @brief   Hàm ghi một phần tử (phía producer)
+ *
+ * @details Sao chép phần tử vào ô của producer rồi công bố nó bằng một phép hoán
+ *          đổi nguyên tử. Không chờ, không khóa. Chỉ được gọi từ một task.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Data - Con trỏ tới phần tử cần ghi
+ * @return  void
+ ******************************************************************************/
+void Rte_TripleBuffer_Write(Rte_TripleBufferType* Buffer, const void* Data);
+
+/******************************************************************************
+ * @brief   Hàm đọc phần tử mới nhất (phía consumer)
+ *
+ * @details Nếu producer đã công bố phần tử mới, lấy ô đó bằng một phép hoán đổi
+ *          nguyên tử, sau đó sao chép ô hiện tại ra `Data`. Chỉ được gọi từ một task.
+ *
+ * @param   Buffer - Con trỏ tới bộ đệm
+ * @param   Data - Con trỏ lưu trữ bản sao của phần tử
+ * @return  Std_ReturnType - Trả về E_OK nếu đã có phần tử, E_NOT_OK nếu producer
+ *          chưa ghi lần nào (`Data` không thay đổi)
+ ******************************************************************************/
+Std_ReturnType Rte_TripleBuffer_Read(Rte_TripleBufferType* Buffer, void* Data);
+
+#endif /* RTE_BUFFER_H */
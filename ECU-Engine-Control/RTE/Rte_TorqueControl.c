@@ -1,11 +1,12 @@
 /******************************************************************************
  * @file    Rte_TorqueControl.c
- * @brief   Module cung cấp các API RTE cho hệ thống điều khiển mô-men xoắn.
+ * @brief   Module cung cấp phần viết tay của RTE cho hệ thống điều khiển mô-men xoắn.
  *
- * @details Module này triển khai các API RTE để đọc và ghi dữ liệu từ các cảm biến 
- *          và bộ điều khiển mô-men xoắn. Nó bao gồm các API để khởi tạo, đọc giá trị 
- *          từ cảm biến bàn đạp ga, tốc độ, tải trọng, và mô-men xoắn thực tế, cũng như
- *          ghi mô-men xoắn yêu cầu tới bộ điều khiển động cơ.
+ * @details Module này chứa bộ đệm của các phần tử dữ liệu, runnable thu thập cảm biến
+ *          (producer), bước sao chép dữ liệu vào runnable Torque Control (copy-in), thân
+ *          các task 1 ms, 10 ms và 100 ms của Torque Control và các hàm khởi tạo. Các API truy cập dữ liệu là hàm static inline được sinh
+ *          trong `Rte_TorqueControl.h`, phần tử dữ liệu và bảng cấu hình được sinh trong
+ *          `Rte_TorqueControl_Cfg.c`.
  * 
  * @version 1.0
  * @date    2024-10-25
@@ -15,174 +16,367 @@
  ******************************************************************************/
 
 #include "Rte_TorqueControl.h"
-#include "IoHwAb_ThrottleSensor.h"  // API IoHwAb để đọc cảm biến bàn đạp ga
-#include "IoHwAb_SpeedSensor.h"     // API IoHwAb để đọc cảm biến tốc độ
-#include "IoHwAb_LoadSensor.h"      // API IoHwAb để đọc cảm biến tải trọng
-#include "IoHwAb_TorqueSensor.h"    // API IoHwAb để đọc mô-men xoắn thực tế
+#include "Rte_Buffer.h"             // Bộ đệm ba cho các phần tử dữ liệu implicit
+#include "Torque_Control.h"         // Runnable của SWC Torque Control
+#include "IoHwAb_AnalogSensor.h"    // API IoHwAb để đọc tất cả cảm biến analog
 #include "IoHwAb_MotorDriver.h"     // API IoHwAb để điều khiển mô-men xoắn động cơ
+#include "NvM.h"                    // Hiệu chuẩn dải đo cảm biến và Torque Control
+#include "Os.h"                     // Đồng hồ và sự kiện kích hoạt runnable
 #include "Std_Types.h"
 
 /******************************************************************************
- * @brief   API đọc dữ liệu từ cảm biến bàn đạp ga
+ * @brief   Các task consumer của bản ghi cảm biến analog
+ ******************************************************************************/
+typedef enum {
+    RTE_ANALOG_SENSORS_CONSUMER_10MS = 0,   /**< TorqueControl_Arbitrate */
+    RTE_ANALOG_SENSORS_CONSUMER_100MS,      /**< TorqueControl_Monitor */
+    RTE_ANALOG_SENSORS_NUM_CONSUMERS
+} Rte_AnalogSensorsConsumerType;
+
+/******************************************************************************
+ * @brief   Bộ đệm ba của bản ghi cảm biến analog, một bộ cho mỗi task consumer
  *
- * @details Hàm này đọc giá trị vị trí bàn đạp ga từ cảm biến thông qua API của 
- *          IoHwAb. Kiểm tra nếu con trỏ đầu vào là NULL, trả về lỗi.
+ * @details Bộ đệm ba chỉ cho phép một consumer (`Front` không được bảo vệ), nên mỗi
+ *          task Torque Control đọc bộ đệm riêng; task thu thập cảm biến là producer
+ *          duy nhất và ghi vào mọi bộ đệm.
+ ******************************************************************************/
+static uint8_t Rte_AnalogSensorsStorage[RTE_ANALOG_SENSORS_NUM_CONSUMERS]
+                                       [RTE_TRIPLE_BUFFER_SLOTS * sizeof(Rte_AnalogSensorsDataType)];
+static Rte_TripleBufferType Rte_AnalogSensorsBuffer[RTE_ANALOG_SENSORS_NUM_CONSUMERS];
+
+/******************************************************************************
+ * @brief   Giá trị thay thế của từng cảm biến, tính sẵn từ bảng cấu hình
+ ******************************************************************************/
+static Rte_PhysicalValueType Rte_AnalogSensorSubstitute[IOHWAB_NUM_ANALOG_SENSORS];
+
+/******************************************************************************
+ * @brief   Trạng thái của data-received event bàn đạp ga (chỉ producer truy cập)
  *
- * @param   ThrottlePosition - Con trỏ để lưu trữ giá trị vị trí bàn đạp ga đọc được
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @details Lưu giá trị và trạng thái của mẫu đã báo lần trước để chỉ báo sự kiện
+ *          khi bàn đạp ga thực sự thay đổi.
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpThrottleSensor_ThrottlePosition(float* ThrottlePosition) {
-    if (ThrottlePosition == NULL) {
-        return E_NOT_OK;  // Trả về lỗi nếu con trỏ NULL
+static Rte_PhysicalValueType Rte_ThrottleReceivedThreshold;
+static Rte_PhysicalValueType Rte_ThrottleReportedValue;
+static IoHwAb_SensorStatusType Rte_ThrottleReportedStatus;
+
+/******************************************************************************
+ * @brief   Hàm khởi động RTE
+ *
+ * @details Khởi tạo bộ đệm ba của các phần tử dữ liệu, bảng giá trị thay thế của
+ *          cảm biến, đối tượng sự kiện của Torque Control và trace VFB (nếu bật). Phải được gọi trước khi
+ *          các task được tạo.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Rte_Start(void) {
+    for (uint8_t c = 0; c < RTE_ANALOG_SENSORS_NUM_CONSUMERS; c++) {
+        if (Rte_TripleBuffer_Init(&Rte_AnalogSensorsBuffer[c], Rte_AnalogSensorsStorage[c],
+                                  sizeof(Rte_AnalogSensorsDataType)) != E_OK) {
+            return E_NOT_OK;
+        }
+    }
+
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+        Rte_AnalogSensorSubstitute[i] = RTE_PHYSICAL_FROM_FLOAT(IoHwAb_AnalogSensorConfig.SubstituteValue[i]);
     }
-    return IoHwAb_ThrottleSensor_Read(ThrottlePosition);  // Gọi API từ IoHwAb để đọc giá trị từ cảm biến
+
+    Os_InitEvent(&Rte_TorqueControl_Event);
+    Rte_ThrottleReceivedThreshold = RTE_PHYSICAL_FROM_FLOAT(RTE_THROTTLE_RECEIVED_THRESHOLD);
+    Rte_ThrottleReportedValue = Rte_AnalogSensorSubstitute[IOHWAB_SENSOR_THROTTLE];
+    Rte_ThrottleReportedStatus = IOHWAB_SENSOR_STATUS_NO_DATA;
+
+#if (RTE_VFB_TRACE == STD_ON)
+    // Trace không bắt buộc: khi không mở được file, hook vẫn ghi vào bộ đệm nhưng không được chuyển đi
+    (void)Rte_Trace_Init(Rte_TorqueControl_TraceApiName, Rte_TorqueControl_TraceApiFormat,
+                         RTE_TORQUECONTROL_TRACE_NUM_APIS);
+#endif
+    return E_OK;
 }
 
 /******************************************************************************
- * @brief   API đọc dữ liệu từ cảm biến tốc độ
+ * @brief   API khởi tạo các cảm biến analog
  *
- * @details Hàm này đọc giá trị tốc độ xe từ cảm biến thông qua API của IoHwAb.
- *          Kiểm tra nếu con trỏ đầu vào là NULL, trả về lỗi.
+ * @details Hàm này khởi tạo bộ xử lý cảm biến analog của IoHwAb với bảng cấu hình
+ *          mặc định, sau đó áp dụng dải đo hiệu chuẩn từ NvM cho cảm biến tốc độ,
+ *          tải trọng và mô-men xoắn.
  *
- * @param   Speed - Con trỏ để lưu trữ giá trị tốc độ đọc được
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpSpeedSensor_Speed(float* Speed) {
-    if (Speed == NULL) {
+Std_ReturnType Rte_Call_RpAnalogSensors_Init(void) {
+    NvM_SensorCalibrationType calibration;
+    if (NvM_ReadBlock(NVM_BLOCK_SENSOR_CALIBRATION, &calibration) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    if (IoHwAb_AnalogSensor_Init(&IoHwAb_AnalogSensorConfig) != E_OK) {  // Gọi API từ IoHwAb để khởi tạo tất cả cảm biến analog
+        return E_NOT_OK;
+    }
+
+    // Dải đo hiệu chuẩn (mặc định 200 km/h, 1000 kg, 500 Nm)
+    if (IoHwAb_AnalogSensor_SetFullScale(IOHWAB_SENSOR_SPEED, (float)calibration.SpeedMaxValue) != E_OK ||
+        IoHwAb_AnalogSensor_SetFullScale(IOHWAB_SENSOR_LOAD, (float)calibration.LoadMaxValue) != E_OK ||
+        IoHwAb_AnalogSensor_SetFullScale(IOHWAB_SENSOR_TORQUE, (float)calibration.TorqueMaxValue) != E_OK) {
         return E_NOT_OK;
     }
-    return IoHwAb_SpeedSensor_Read(Speed);  // Gọi API từ IoHwAb để đọc giá trị từ cảm biến tốc độ
+    return E_OK;
 }
 
 /******************************************************************************
- * @brief   API đọc dữ liệu từ cảm biến tải trọng
+ * @brief   Runnable thu thập các cảm biến analog (producer)
  *
- * @details Hàm này đọc giá trị tải trọng từ cảm biến thông qua API của IoHwAb.
- *          Kiểm tra nếu con trỏ đầu vào là NULL, trả về lỗi.
+ * @details Hàm này yêu cầu IoHwAb đọc tất cả các kênh trong một lần chuyển đổi nhóm
+ *          ADC, sau đó ghi giá trị, thời điểm và trạng thái của mọi cảm biến vào bộ
+ *          đệm ba của từng task consumer như một bản ghi duy nhất. Được gọi định kỳ từ task thu thập cảm biến,
+ *          độc lập với chu kỳ của Torque Control. Bản ghi vẫn được ghi khi đọc ADC lỗi
+ *          để tuổi của mẫu tiếp tục tăng phía consumer.
  *
- * @param   LoadWeight - Con trỏ để lưu trữ giá trị tải trọng đọc được
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ *          Sau khi công bố bản ghi, đặt data-received event của task 10 ms nếu bàn
+ *          đạp ga lệch khỏi giá trị đã báo lần trước quá ngưỡng hoặc trạng thái mẫu
+ *          thay đổi. Sự kiện được đặt sau phép ghi nên runnable luôn thấy mẫu mới.
+ *
+ * @param   void
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpLoadSensor_LoadWeight(float* LoadWeight) {
-    if (LoadWeight == NULL) {
-        return E_NOT_OK;
+void Rte_Run_AnalogSensors_Acquire(void) {
+    Rte_AnalogSensorsDataType data;
+
+    (void)IoHwAb_ReadAllSensors();  // Gọi API từ IoHwAb để đọc và chuyển đổi tất cả cảm biến
+
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+#if (IOHWAB_FIXED_POINT == STD_ON)
+        IoHwAb_SensorSampleFixedType sample = { 0 };
+        (void)IoHwAb_AnalogSensor_GetSampleFixed((IoHwAb_SensorIdType)i, &sample);
+#else
+        IoHwAb_SensorSampleType sample = { 0 };
+        (void)IoHwAb_AnalogSensor_GetSample((IoHwAb_SensorIdType)i, &sample);
+#endif
+        data.Value[i] = sample.Value;
+        data.TimestampMs[i] = sample.TimestampMs;
+        data.AgeMs[i] = 0U;
+        data.Status[i] = sample.Status;
+    }
+
+    for (uint8_t c = 0; c < RTE_ANALOG_SENSORS_NUM_CONSUMERS; c++) {
+        Rte_TripleBuffer_Write(&Rte_AnalogSensorsBuffer[c], &data);
+    }
+
+    Rte_PhysicalValueType throttle = data.Value[IOHWAB_SENSOR_THROTTLE];
+    Rte_PhysicalValueType delta = (throttle > Rte_ThrottleReportedValue) ? (throttle - Rte_ThrottleReportedValue)
+                                                                          : (Rte_ThrottleReportedValue - throttle);
+    if (delta > Rte_ThrottleReceivedThreshold || data.Status[IOHWAB_SENSOR_THROTTLE] != Rte_ThrottleReportedStatus) {
+        Rte_ThrottleReportedValue = throttle;
+        Rte_ThrottleReportedStatus = data.Status[IOHWAB_SENSOR_THROTTLE];
+        Os_SetEvent(&Rte_TorqueControl_Event, RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED);
     }
-    return IoHwAb_LoadSensor_Read(LoadWeight);  // Gọi API từ IoHwAb để đọc giá trị từ cảm biến tải trọng
 }
 
 /******************************************************************************
- * @brief   API đọc mô-men xoắn thực tế từ cảm biến mô-men xoắn
+ * @brief   Hàm nội bộ sao chép dữ liệu vào runnable Torque Control (copy-in)
  *
- * @details Hàm này đọc giá trị mô-men xoắn thực tế từ cảm biến thông qua API của IoHwAb.
- *          Kiểm tra nếu con trỏ đầu vào là NULL, trả về lỗi.
+ * @details Lấy bản ghi mới nhất từ bộ đệm ba của task đang chạy vào bản sao của task
+ *          và tính lại tuổi của từng mẫu tại thời điểm runnable bắt đầu. Mỗi task có bộ
+ *          đệm và bản sao riêng nên runnable 10 ms và 100 ms không thấy dữ liệu thay
+ *          đổi giữa chừng khi task kia sao chép. Mẫu hợp lệ nhưng vượt quá tuổi tối đa (ví dụ task
+ *          thu thập bị dừng) được đánh dấu quá cũ và thay bằng giá trị thay thế. Khi
+ *          chưa có bản ghi nào, bản sao được đặt về trạng thái chưa có dữ liệu với giá
+ *          trị thay thế. Giá trị hợp lệ được lưu lại cho DataServices của DCM, chỉ từ
+ *          task 10 ms để mỗi giá trị có một task ghi duy nhất.
  *
- * @param   ActualTorque - Con trỏ để lưu trữ giá trị mô-men xoắn thực tế đọc được
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @param   Consumer - Task consumer đang chạy
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpTorqueSensor_ActualTorque(float* ActualTorque) {
-    if (ActualTorque == NULL) {
-        return E_NOT_OK;
+static void Rte_CopyIn_TorqueControl(Rte_AnalogSensorsConsumerType Consumer) {
+    Rte_AnalogSensorsDataType* data = &Rte_TorqueControl_AnalogSensors;
+    if (Rte_TripleBuffer_Read(&Rte_AnalogSensorsBuffer[Consumer], data) != E_OK) {
+        for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+            data->Value[i] = Rte_AnalogSensorSubstitute[i];
+            data->TimestampMs[i] = 0U;
+            data->AgeMs[i] = 0U;
+            data->Status[i] = IOHWAB_SENSOR_STATUS_NO_DATA;
+        }
+        return;
+    }
+
+    uint32_t nowMs = Os_GetTimeMs();
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+        if (data->Status[i] == IOHWAB_SENSOR_STATUS_NO_DATA) {
+            continue;
+        }
+        data->AgeMs[i] = nowMs - data->TimestampMs[i];  // Phép trừ không dấu an toàn khi bộ đếm tràn
+        uint32_t maxAgeMs = IoHwAb_AnalogSensorConfig.MaxAgeMs[i];
+        if (data->Status[i] == IOHWAB_SENSOR_STATUS_VALID && maxAgeMs != 0U && data->AgeMs[i] > maxAgeMs) {
+            data->Status[i] = IOHWAB_SENSOR_STATUS_STALE;
+            data->Value[i] = Rte_AnalogSensorSubstitute[i];
+        }
+        if (Consumer == RTE_ANALOG_SENSORS_CONSUMER_10MS && data->Status[i] == IOHWAB_SENSOR_STATUS_VALID &&
+            Rte_AnalogSensors_LastValue[i] != NULL) {
+            *Rte_AnalogSensors_LastValue[i] = data->Value[i];  // Giá trị hợp lệ mới nhất cho DataServices
+        }
     }
-    return IoHwAb_TorqueSensor_Read(ActualTorque);  // Gọi API từ IoHwAb để đọc mô-men xoắn thực tế
 }
 
 /******************************************************************************
- * @brief   API ghi mô-men xoắn yêu cầu tới bộ điều khiển động cơ
+ * @brief   Hàm nội bộ tính mốc kích hoạt tiếp theo của một task chu kỳ
  *
- * @details Hàm này ghi giá trị mô-men xoắn yêu cầu tới bộ điều khiển động cơ 
- *          thông qua API của IoHwAb.
+ * @details Mốc được cộng dồn theo chu kỳ (bước cố định, không trôi). Khi task bị trễ
+ *          quá một chu kỳ, các lần kích hoạt bị lỡ được bỏ qua thay vì chạy dồn.
  *
- * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu
- * @return  Std_ReturnType - Trả về E_OK nếu ghi thành công, E_NOT_OK nếu có lỗi
+ * @param   DeadlineNs - Mốc kích hoạt vừa chạy (ns)
+ * @param   PeriodNs   - Chu kỳ của task (ns)
+ * @return  uint64_t   - Mốc kích hoạt tiếp theo (ns)
  ******************************************************************************/
-Std_ReturnType Rte_Write_PpMotorDriver_SetTorque(float TorqueValue) {
-    return IoHwAb_MotorDriver_SetTorque(TorqueValue);  // Gọi API từ IoHwAb để ghi mô-men xoắn yêu cầu tới động cơ
+static uint64_t Rte_NextActivation(uint64_t DeadlineNs, uint64_t PeriodNs) {
+    uint64_t nowNs = Os_GetTimeNs();
+    DeadlineNs += PeriodNs;
+    if (nowNs >= DeadlineNs) {
+        DeadlineNs = nowNs + PeriodNs;
+    }
+    return DeadlineNs;
 }
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến bàn đạp ga
+ * @brief   Runnable phân xử mô-men và vòng kín Torque Control
  *
- * @details Hàm này khởi tạo cấu hình cho cảm biến bàn đạp ga và gọi API khởi tạo
- *          từ IoHwAb để thiết lập cảm biến bàn đạp ga.
+ * @details Tạo bản sao implicit của các cảm biến cho task 10 ms rồi gọi runnable của
+ *          SWC. Mọi lần đọc cảm biến trong `TorqueControl_Arbitrate` dùng bản sao này.
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpThrottleSensor_Init(void) {
-    ThrottleSensor_ConfigType throttleSensorConfig = {
-        .ThrottleSensor_Channel = 0  // Kênh ADC cho cảm biến bàn đạp ga
-    };
-    return IoHwAb_ThrottleSensor_Init(&throttleSensorConfig);  // Gọi API từ IoHwAb để khởi tạo cảm biến bàn đạp ga
+void Rte_Run_TorqueControl_Arbitrate(void) {
+    Rte_CopyIn_TorqueControl(RTE_ANALOG_SENSORS_CONSUMER_10MS);
+    TorqueControl_Arbitrate();
 }
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến tốc độ
+ * @brief   Runnable cập nhật tải trọng và giám sát Torque Control
  *
- * @details Hàm này thiết lập cấu hình cho cảm biến tốc độ và gọi API khởi tạo
- *          từ IoHwAb để khởi tạo cảm biến tốc độ.
+ * @details Tạo bản sao implicit của các cảm biến cho task 100 ms rồi gọi runnable
+ *          của SWC.
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpSpeedSensor_Init(void) {
-    // Cấu hình cho cảm biến tốc độ
-    SpeedSensor_ConfigType speedSensorConfig = {
-        .SpeedSensor_Channel = 1,        // Kênh ADC cho cảm biến tốc độ
-        .SpeedSensor_MaxValue = 200      // Tốc độ tối đa giả lập (200 km/h)
-    };
-    return IoHwAb_SpeedSensor_Init(&speedSensorConfig);  // Gọi API từ IoHwAb để khởi tạo cảm biến tốc độ
+void Rte_Run_TorqueControl_Monitor(void) {
+    Rte_CopyIn_TorqueControl(RTE_ANALOG_SENSORS_CONSUMER_100MS);
+    TorqueControl_Monitor();
 }
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến tải trọng
+ * @brief   Thân task 1 ms của Torque Control
  *
- * @details Hàm này thiết lập cấu hình cho cảm biến tải trọng và gọi API khởi tạo
- *          từ IoHwAb để khởi tạo cảm biến tải trọng.
+ * @details Chạy `TorqueControl_Actuate` theo mốc thời gian tuyệt đối. Runnable chỉ
+ *          dùng biến nội bộ (inter-runnable variable) nên không cần copy-in.
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpLoadSensor_Init(void) {
-    // Cấu hình cho cảm biến tải trọng
-    LoadSensor_ConfigType loadSensorConfig = {
-        .LoadSensor_Channel = 2,         // Kênh ADC cho cảm biến tải trọng
-        .LoadSensor_MaxValue = 1000      // Tải trọng tối đa giả lập (1000 kg)
-    };
-    return IoHwAb_LoadSensor_Init(&loadSensorConfig);  // Gọi API từ IoHwAb để khởi tạo cảm biến tải trọng
+void Rte_Task_TorqueControl_1ms(void) {
+    const uint64_t periodNs = (uint64_t)RTE_TORQUECONTROL_ACTUATE_PERIOD_MS * 1000000U;
+    uint64_t deadlineNs = Os_GetTimeNs();
+
+    while (1) {
+        Os_SleepUntilNs(deadlineNs);
+        TorqueControl_Actuate();
+        deadlineNs = Rte_NextActivation(deadlineNs, periodNs);
+    }
 }
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến mô-men xoắn
+ * @brief   Thân task 10 ms của Torque Control
  *
- * @details Hàm này thiết lập cấu hình cho cảm biến mô-men xoắn và gọi API khởi tạo
- *          từ IoHwAb để khởi tạo cảm biến mô-men xoắn.
+ * @details Task chờ trên `Rte_TorqueControl_Event` tới mốc timing event tiếp theo:
+ *          - operation-invoked: chạy `TorqueControl_ReloadCalibration` ngay, trên
+ *            cùng task với bộ điều khiển nên không cần khóa trạng thái PI;
+ *          - timing hoặc data-received: chạy `Rte_Run_TorqueControl_Arbitrate`, sau
+ *            khi nạp lại hiệu chuẩn (nếu có) để bước điều khiển dùng ngay hiệu chuẩn
+ *            mới, nhưng không sớm hơn RTE_TORQUECONTROL_ARBITRATE_MIN_INTERVAL_MS kể
+ *            từ lần chạy trước. Data-received event đến sớm được giữ lại và xử lý một
+ *            lần khi hết khoảng cách.
+ *          Sau một lần chạy sớm, mốc timing event được tính lại từ lần chạy đó nên
+ *          khi bàn đạp ga thay đổi liên tục, runnable bám theo nhịp của task thu thập
+ *          thay vì chạy thêm do timing event.
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  void
+ ******************************************************************************/
+void Rte_Task_TorqueControl_10ms(void) {
+    const uint64_t periodNs = (uint64_t)RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS * 1000000U;
+    const uint64_t minIntervalNs = (uint64_t)RTE_TORQUECONTROL_ARBITRATE_MIN_INTERVAL_MS * 1000000U;
+    uint64_t deadlineNs = Os_GetTimeNs();  // Lần chạy đầu tiên ngay khi task bắt đầu
+    uint64_t lastRunNs = deadlineNs - minIntervalNs;
+    Os_EventMaskType pending = 0U;
+
+    while (1) {
+        // Khi đang giữ data-received event, chỉ cần chờ tới lúc hết khoảng cách tối thiểu
+        uint64_t waitNs = deadlineNs;
+        if ((pending & RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED) != 0U && lastRunNs + minIntervalNs < waitNs) {
+            waitNs = lastRunNs + minIntervalNs;
+        }
+
+        pending |= Os_WaitEvent(&Rte_TorqueControl_Event,
+                                RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED | RTE_EV_TORQUECONTROL_RELOAD_CALIBRATION,
+                                waitNs);
+        if ((pending & RTE_EV_TORQUECONTROL_RELOAD_CALIBRATION) != 0U) {
+            pending &= ~RTE_EV_TORQUECONTROL_RELOAD_CALIBRATION;
+            TorqueControl_ReloadCalibration();
+        }
+
+        uint64_t nowNs = Os_GetTimeNs();
+        if (nowNs >= deadlineNs) {
+            deadlineNs = Rte_NextActivation(deadlineNs, periodNs);
+        } else if ((pending & RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED) != 0U && nowNs - lastRunNs >= minIntervalNs) {
+            deadlineNs = nowNs + periodNs;
+        } else {
+            continue;
+        }
+        pending &= ~RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED;
+        lastRunNs = nowNs;
+        Rte_Run_TorqueControl_Arbitrate();
+    }
+}
+
+/******************************************************************************
+ * @brief   Thân task 100 ms của Torque Control
+ *
+ * @details Chạy `Rte_Run_TorqueControl_Monitor` theo mốc thời gian tuyệt đối. Lần
+ *          chạy đầu tiên sau một chu kỳ để task thu thập và task 10 ms kịp tạo dữ liệu.
+ *
+ * @param   void
+ * @return  void
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpTorqueSensor_Init(void) {
-    // Cấu hình cho cảm biến mô-men xoắn
-    TorqueSensor_ConfigType torqueSensorConfig = {
-        .TorqueSensor_Channel = 3,       // Kênh ADC cho cảm biến mô-men xoắn
-        .TorqueSensor_MaxValue = 500     // Mô-men xoắn tối đa giả lập (500 Nm)
-    };
-    return IoHwAb_TorqueSensor_Init(&torqueSensorConfig);  // Gọi API từ IoHwAb để khởi tạo cảm biến mô-men xoắn
+void Rte_Task_TorqueControl_100ms(void) {
+    const uint64_t periodNs = (uint64_t)RTE_TORQUECONTROL_MONITOR_PERIOD_MS * 1000000U;
+    uint64_t deadlineNs = Os_GetTimeNs() + periodNs;
+
+    while (1) {
+        Os_SleepUntilNs(deadlineNs);
+        Rte_Run_TorqueControl_Monitor();
+        deadlineNs = Rte_NextActivation(deadlineNs, periodNs);
+    }
 }
 
 /******************************************************************************
  * @brief   API khởi tạo bộ điều khiển mô-men xoắn
  *
- * @details Hàm này thiết lập cấu hình cho bộ điều khiển mô-men xoắn và gọi API khởi tạo
- *          từ IoHwAb để khởi tạo bộ điều khiển mô-men xoắn.
+ * @details Hàm này khởi tạo bộ điều khiển mô-men xoắn từ bảng cấu hình const
+ *          `Rte_MotorDriverConfig`, sau đó áp dụng mô-men xoắn tối đa hiệu chuẩn từ NvM.
  *
  * @param   void
  * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
 Std_ReturnType Rte_Call_PpMotorDriver_Init(void) {
-    // Cấu hình cho bộ điều khiển mô-men xoắn
-    MotorDriver_ConfigType motorDriverConfig = {
-        .Motor_Channel = 1,              // Kênh điều khiển mô-tơ
-        .Motor_MaxTorque = 300           // Mô-men xoắn tối đa giả lập (300 Nm)
-    };
-    return IoHwAb_MotorDriver_Init(&motorDriverConfig);  // Gọi API từ IoHwAb để khởi tạo bộ điều khiển mô-men xoắn
+    NvM_SensorCalibrationType calibration;
+    if (NvM_ReadBlock(NVM_BLOCK_SENSOR_CALIBRATION, &calibration) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    if (IoHwAb_MotorDriver_Init(&Rte_MotorDriverConfig) != E_OK) {  // Gọi API từ IoHwAb để khởi tạo bộ điều khiển mô-men xoắn
+        return E_NOT_OK;
+    }
+
+    // Mô-men xoắn tối đa hiệu chuẩn (mặc định 300 Nm)
+    return IoHwAb_MotorDriver_SetMaxTorque(calibration.MotorMaxTorque);
 }
@@ -4,12 +4,15 @@
  *
  * @details File này định nghĩa các hàm API RTE dùng để đọc dữ liệu từ các cảm biến
  *          (bàn đạp ga, tốc độ, tải trọng, và mô-men xoắn thực tế) và ghi dữ liệu
- *          mô-men xoắn yêu cầu tới bộ điều khiển động cơ. Nó cũng bao gồm các hàm 
- *          khởi tạo cho từng cảm biến và bộ điều khiển mô-men xoắn.
- * 
+ *          mô-men xoắn yêu cầu tới bộ điều khiển động cơ. Các API truy cập dữ liệu là
+ *          hàm static inline đọc/ghi trực tiếp phần tử dữ liệu của RTE.
+ *
+ *          File được sinh bởi Tools/RteGen/rte_gen.py từ TorqueControl.json,
+ *          không sửa trực tiếp.
+ *
  * @version 1.0
  * @date    2024-10-25
- * @author  
+ * @author
  *          HALA Academy
  *          Tong Xuan Hoang
  ******************************************************************************/
@@ -17,106 +20,859 @@
 #ifndef RTE_TORQUECONTROL_H
 #define RTE_TORQUECONTROL_H
 
-#include "Std_Types.h"  // Bao gồm các kiểu dữ liệu tiêu chuẩn
+#include <stdatomic.h>
+#include "Std_Types.h"           // Bao gồm các kiểu dữ liệu tiêu chuẩn
+#include "NvM.h"                 // Kiểu dữ liệu hiệu chuẩn lưu trong NvM
+#include "Os.h"                  // Sự kiện kích hoạt runnable
+#include "Rte_Trace.h"           // Hook trace VFB
+#include "IoHwAb_Cfg.h"          // Kiểu dữ liệu dấu phẩy tĩnh của IoHwAb
+#include "IoHwAb_AnalogSensor.h" // ID, mẫu và trạng thái của cảm biến analog
+#include "IoHwAb_MotorDriver.h"  // API IoHwAb để điều khiển mô-men xoắn động cơ
+#include "Dem.h"                 // Báo sự kiện chẩn đoán
 
 /******************************************************************************
- * @brief   API để đọc dữ liệu từ cảm biến bàn đạp ga
+ * @brief   Chu kỳ của task thu thập cảm biến (ms)
  *
- * @details Đọc giá trị vị trí bàn đạp ga từ cảm biến, lưu vào biến con trỏ đầu vào.
+ * @details Phải nhỏ hơn tuổi tối đa nhỏ nhất trong bảng cấu hình cảm biến để mẫu
+ *          không bị coi là quá cũ giữa hai lần thu thập.
+ ******************************************************************************/
+#define RTE_SENSOR_ACQUISITION_PERIOD_MS 10
+
+/******************************************************************************
+ * @brief   Chu kỳ của runnable chấp hành TorqueControl_Actuate (ms)
  *
- * @param   ThrottlePosition - Con trỏ lưu trữ giá trị vị trí bàn đạp ga
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @details Lệnh mô-men được chia đều thành các bước theo chu kỳ này trong một chu kỳ
+ *          phân xử, nên mô-men gửi tới bộ điều khiển động cơ không thay đổi dạng bậc.
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpThrottleSensor_ThrottlePosition(float* ThrottlePosition);
+#define RTE_TORQUECONTROL_ACTUATE_PERIOD_MS 1
 
 /******************************************************************************
- * @brief   API để đọc dữ liệu từ cảm biến tốc độ
+ * @brief   Chu kỳ của runnable phân xử mô-men TorqueControl_Arbitrate (ms)
  *
- * @details Đọc giá trị tốc độ xe từ cảm biến, lưu vào biến con trỏ đầu vào.
+ * @details Cũng là chu kỳ lấy mẫu của bộ điều khiển PI vòng kín mô-men; các hệ số
+ *          được tính theo giá trị này khi nạp hiệu chuẩn. Nên bằng chu kỳ thu thập
+ *          cảm biến để mỗi bước điều khiển có một mẫu mô-men thực tế mới.
+ ******************************************************************************/
+#define RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS 10
+
+/******************************************************************************
+ * @brief   Khoảng cách tối thiểu giữa hai lần chạy TorqueControl_Arbitrate (ms)
  *
- * @param   Speed - Con trỏ lưu trữ giá trị tốc độ xe
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @details Data-received event đến sớm hơn được gộp lại và xử lý một lần khi hết
+ *          khoảng cách này. Bước PI tính theo chu kỳ cố định nên một lần chạy sớm chỉ
+ *          rút ngắn tối đa một nửa chu kỳ phân xử.
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpSpeedSensor_Speed(float* Speed);
+#define RTE_TORQUECONTROL_ARBITRATE_MIN_INTERVAL_MS 5
 
 /******************************************************************************
- * @brief   API để đọc dữ liệu từ cảm biến tải trọng
+ * @brief   Ngưỡng thay đổi vị trí bàn đạp ga tạo data-received event (0.0 - 1.0)
  *
- * @details Đọc giá trị tải trọng từ cảm biến, lưu vào biến con trỏ đầu vào.
+ * @details Mẫu mới chỉ kích hoạt sớm TorqueControl_Arbitrate khi lệch khỏi giá trị đã
+ *          báo lần trước quá ngưỡng này hoặc khi trạng thái mẫu thay đổi.
+ ******************************************************************************/
+#define RTE_THROTTLE_RECEIVED_THRESHOLD 0.02f
+
+/******************************************************************************
+ * @brief   Chu kỳ của runnable cập nhật tải trọng và giám sát TorqueControl_Monitor (ms)
  *
- * @param   LoadWeight - Con trỏ lưu trữ giá trị tải trọng
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @details Tải trọng thay đổi chậm, các kiểm tra hợp lý được lọc theo nhiều chu kỳ
+ *          nên không cần chạy nhanh hơn.
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpLoadSensor_LoadWeight(float* LoadWeight);
+#define RTE_TORQUECONTROL_MONITOR_PERIOD_MS 100
 
 /******************************************************************************
- * @brief   API để đọc mô-men xoắn thực tế từ cảm biến mô-men xoắn
+ * @brief   Kiểu giá trị vật lý của các phần tử dữ liệu
  *
- * @details Đọc giá trị mô-men xoắn thực tế từ cảm biến, lưu vào biến con trỏ đầu vào.
+ * @details Khi bật dấu phẩy tĩnh, giá trị được lưu ở dạng Q16.16 và chỉ chuyển sang
+ *          float khi cần.
+ ******************************************************************************/
+#if (IOHWAB_FIXED_POINT == STD_ON)
+typedef IoHwAb_Q16_16Type Rte_PhysicalValueType;
+#define RTE_PHYSICAL_TO_FLOAT(v)      IOHWAB_Q16_16_TO_FLOAT(v)
+#define RTE_PHYSICAL_FROM_FLOAT(f)    IOHWAB_FLOAT_TO_Q16_16(f)
+#define RTE_PHYSICAL_TO_TRACE(v)      ((uint32_t)(v))
+#define RTE_TRACE_VALUE_FORMAT        RTE_TRACE_FORMAT_Q16_16
+#else
+typedef float Rte_PhysicalValueType;
+#define RTE_PHYSICAL_TO_FLOAT(v)      (v)
+#define RTE_PHYSICAL_FROM_FLOAT(f)    (f)
+#define RTE_PHYSICAL_TO_TRACE(v)      Rte_Trace_FloatBits(v)
+#define RTE_TRACE_VALUE_FORMAT        RTE_TRACE_FORMAT_FLOAT
+#endif
+
+/******************************************************************************
+ * @brief   ID trace VFB của các API RTE
  *
- * @param   ActualTorque - Con trỏ lưu trữ giá trị mô-men xoắn thực tế
- * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ * @details Giá trị của bản ghi là giá trị vật lý đọc/ghi (định dạng
+ *          RTE_TRACE_VALUE_FORMAT), hoặc trạng thái trả về với API NvM.
  ******************************************************************************/
-Std_ReturnType Rte_Read_RpTorqueSensor_ActualTorque(float* ActualTorque);
+#define RTE_TRACE_ID_CALL_PPTORQUECONTROL_RELOADCALIBRATION         0U
+#define RTE_TRACE_ID_READ_RPTHROTTLESENSOR_THROTTLEPOSITION         1U
+#define RTE_TRACE_ID_READ_RPSPEEDSENSOR_SPEED                       2U
+#define RTE_TRACE_ID_READ_RPLOADSENSOR_LOADWEIGHT                   3U
+#define RTE_TRACE_ID_READ_RPTORQUESENSOR_ACTUALTORQUE               4U
+#define RTE_TRACE_ID_READ_RPANALOGSENSORS_SAMPLE                    5U
+#define RTE_TRACE_ID_WRITE_PPMOTORDRIVER_SETTORQUE                  6U
+#define RTE_TRACE_ID_READ_RPCALIBRATION_TORQUECALIBRATION           7U
+#define RTE_TRACE_ID_WRITE_PPCALIBRATION_TORQUECALIBRATION          8U
+#define RTE_TRACE_ID_CALL_DATASERVICES_THROTTLEPOSITION_READDATA    9U
+#define RTE_TRACE_ID_CALL_DATASERVICES_VEHICLESPEED_READDATA        10U
+#define RTE_TRACE_ID_CALL_DATASERVICES_LOADWEIGHT_READDATA          11U
+#define RTE_TRACE_ID_CALL_DATASERVICES_ACTUALTORQUE_READDATA        12U
+#define RTE_TRACE_ID_CALL_DATASERVICES_DESIREDTORQUE_READDATA       13U
+#define RTE_TRACE_ID_CALL_DATASERVICES_TORQUECOMMAND_READDATA       14U
+#define RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUEDEMAND  15U
+#define RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUEDEMAND     16U
+#define RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUECOMMAND 17U
+#define RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ACTUATE_TORQUECOMMAND    18U
+#define RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUECOMMAND    19U
+#define RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_MONITOR_LOADWEIGHT      20U
+#define RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ARBITRATE_LOADWEIGHT     21U
+#define RTE_TRACE_ID_CALL_EVENT_TORQUETRACKING_SETEVENTSTATUS       22U
+#define RTE_TRACE_ID_CALL_EVENT_THROTTLESENSOR_SETEVENTSTATUS       23U
+#define RTE_TRACE_ID_CALL_EVENT_SPEEDSENSOR_SETEVENTSTATUS          24U
+#define RTE_TRACE_ID_CALL_EVENT_LOADSENSOR_SETEVENTSTATUS           25U
+#define RTE_TRACE_ID_CALL_EVENT_TORQUESENSOR_SETEVENTSTATUS         26U
+#define RTE_TORQUECONTROL_TRACE_NUM_APIS                            27U
+
+#if (RTE_VFB_TRACE == STD_ON)
+extern const char* const Rte_TorqueControl_TraceApiName[RTE_TORQUECONTROL_TRACE_NUM_APIS];  /**< Tên API theo ID */
+extern const uint8_t Rte_TorqueControl_TraceApiFormat[RTE_TORQUECONTROL_TRACE_NUM_APIS];    /**< Định dạng giá trị theo ID */
+#endif
 
 /******************************************************************************
- * @brief   API để ghi dữ liệu mô-men xoắn yêu cầu tới bộ điều khiển động cơ
+ * @brief   Phần tử dữ liệu của các cảm biến analog
  *
- * @details Ghi giá trị mô-men xoắn yêu cầu tới bộ điều khiển động cơ.
+ * @details Một bản ghi gồm giá trị, thời điểm chuyển đổi và trạng thái của tất cả
+ *          cảm biến trong cùng một lần đọc nhóm. Task thu thập cảm biến ghi bản ghi
+ *          vào bộ đệm ba; mỗi runnable nhận một bản sao nhất quán ở đầu mỗi lần chạy
+ *          (ngữ nghĩa implicit).
+ ******************************************************************************/
+typedef struct {
+    Rte_PhysicalValueType Value[IOHWAB_NUM_ANALOG_SENSORS];     /**< Giá trị đã lọc hoặc giá trị thay thế */
+    uint32_t TimestampMs[IOHWAB_NUM_ANALOG_SENSORS];            /**< Thời điểm chuyển đổi (ms) */
+    uint32_t AgeMs[IOHWAB_NUM_ANALOG_SENSORS];                  /**< Tuổi của mẫu lúc sao chép vào runnable (ms) */
+    IoHwAb_SensorStatusType Status[IOHWAB_NUM_ANALOG_SENSORS];  /**< Trạng thái của mẫu */
+} Rte_AnalogSensorsDataType;
+
+/******************************************************************************
+ * @brief   Bản sao implicit của AnalogSensors theo task (TorqueControl_Arbitrate, TorqueControl_Monitor)
  *
- * @param   TorqueValue - Giá trị mô-men xoắn yêu cầu
- * @return  Std_ReturnType - Trả về E_OK nếu ghi thành công, E_NOT_OK nếu có lỗi
+ * @details Mỗi task có một bản sao riêng (_Thread_local), chỉ được ghi khi runnable
+ *          của task đó bắt đầu (copy-in); các API `Rte_Read_*` đọc bản sao của task
+ *          đang gọi. Các runnable trên cùng một task dùng chung bản sao.
+ ******************************************************************************/
+extern _Thread_local Rte_AnalogSensorsDataType Rte_TorqueControl_AnalogSensors;
+
+/******************************************************************************
+ * @brief   Giá trị mới nhất của các phần tử dữ liệu đi qua RTE
+ *
+ * @details Nguồn dữ liệu cho các DataServices mà DCM đọc từ task khác. Giá trị cảm
+ *          biến được cập nhật khi copy-in với mẫu hợp lệ (chỉ từ một task), giá trị
+ *          ghi được cập nhật khi ghi thành công.
  ******************************************************************************/
-Std_ReturnType Rte_Write_PpMotorDriver_SetTorque(float TorqueValue);
+extern volatile Rte_PhysicalValueType Rte_Last_ThrottlePosition;
+extern volatile Rte_PhysicalValueType Rte_Last_Speed;
+extern volatile Rte_PhysicalValueType Rte_Last_LoadWeight;
+extern volatile Rte_PhysicalValueType Rte_Last_ActualTorque;
+extern volatile Rte_PhysicalValueType Rte_Last_TorqueCommand;
+
+extern volatile Rte_PhysicalValueType* const Rte_AnalogSensors_LastValue[IOHWAB_NUM_ANALOG_SENSORS];
+
+/******************************************************************************
+ * @brief   Cấu hình mặc định của bộ điều khiển mô-tơ
+ *
+ * @details Mô-men xoắn tối đa được thay bằng giá trị hiệu chuẩn trong NvM khi khởi tạo.
+ ******************************************************************************/
+extern const MotorDriver_ConfigType Rte_MotorDriverConfig;
+
+/******************************************************************************
+ * @brief   Đối tượng sự kiện của task TorqueControl
+ *
+ * @details Producer, timer và client đặt sự kiện; task của SWC chờ trên đối tượng này
+ *          và gọi runnable tương ứng. Được khởi tạo trong `Rte_Start`.
+ ******************************************************************************/
+extern Os_EventType Rte_TorqueControl_Event;
+
+/******************************************************************************
+ * @brief   Mặt nạ các sự kiện RTE của TorqueControl
+ *
+ * @details Timing event không có mặt nạ: task chờ tới mốc thời gian tuyệt đối của chu kỳ.
+ ******************************************************************************/
+#define RTE_EV_TORQUECONTROL_THROTTLE_RECEIVED ((Os_EventMaskType)0x01U)   /**< dataReceived: TorqueControl_Arbitrate - bàn đạp ga thay đổi quá ngưỡng, task 10 ms */
+#define RTE_EV_TORQUECONTROL_RELOAD_CALIBRATION ((Os_EventMaskType)0x02U)  /**< operationInvoked: TorqueControl_ReloadCalibration - nạp lại hiệu chuẩn Torque Control, task 10 ms */
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến bàn đạp ga
+ * @brief   API yêu cầu nạp lại hiệu chuẩn Torque Control, task 10 ms
  *
- * @details Thiết lập cấu hình và khởi tạo cảm biến bàn đạp ga.
+ * @details Đặt sự kiện operation-invoked để task của TorqueControl chạy runnable
+ *          `TorqueControl_ReloadCalibration`, sau đó trả về ngay mà không chờ runnable chạy xong.
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  Std_ReturnType - Trả về E_OK khi yêu cầu đã được ghi nhận
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpThrottleSensor_Init(void);
+static inline Std_ReturnType Rte_Call_PpTorqueControl_ReloadCalibration(void) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_PPTORQUECONTROL_RELOADCALIBRATION, 0U);
+    Os_SetEvent(&Rte_TorqueControl_Event, RTE_EV_TORQUECONTROL_RELOAD_CALIBRATION);
+    return E_OK;
+}
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến tốc độ
+ * @brief   Biến trao đổi giữa các runnable: mô-men xoắn yêu cầu sau phân xử (Nm)
  *
- * @details Thiết lập cấu hình và khởi tạo cảm biến tốc độ.
+ * @details Ghi bởi `TorqueControl_Arbitrate`, đọc bởi `TorqueControl_Monitor`.
+ *          Các runnable chạy trên các task khác nhau; mỗi lần đọc/ghi là một thao tác
+ *          atomic trên giá trị mới nhất (explicit), không có thứ tự giữa các biến.
+ ******************************************************************************/
+extern _Atomic float Rte_Irv_TorqueControl_TorqueDemand;
+
+/******************************************************************************
+ * @brief   API ghi mô-men xoắn yêu cầu sau phân xử (Nm) từ runnable TorqueControl_Arbitrate
+ *
+ * @param   TorqueDemand - Giá trị mới
+ * @return  void
+ ******************************************************************************/
+static inline void Rte_IrvWrite_TorqueControl_Arbitrate_TorqueDemand(float TorqueDemand) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUEDEMAND, Rte_Trace_FloatBits(TorqueDemand));
+    atomic_store_explicit(&Rte_Irv_TorqueControl_TorqueDemand, TorqueDemand, memory_order_relaxed);
+}
+
+/******************************************************************************
+ * @brief   API đọc mô-men xoắn yêu cầu sau phân xử (Nm) từ runnable TorqueControl_Monitor
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  float - Giá trị mới nhất
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpSpeedSensor_Init(void);
+static inline float Rte_IrvRead_TorqueControl_Monitor_TorqueDemand(void) {
+    float value = atomic_load_explicit(&Rte_Irv_TorqueControl_TorqueDemand, memory_order_relaxed);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUEDEMAND, Rte_Trace_FloatBits(value));
+    return value;
+}
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến tải trọng
+ * @brief   Biến trao đổi giữa các runnable: lệnh mô-men xoắn của vòng kín (Nm)
  *
- * @details Thiết lập cấu hình và khởi tạo cảm biến tải trọng.
+ * @details Ghi bởi `TorqueControl_Arbitrate`, đọc bởi `TorqueControl_Actuate`, `TorqueControl_Monitor`.
+ *          Các runnable chạy trên các task khác nhau; mỗi lần đọc/ghi là một thao tác
+ *          atomic trên giá trị mới nhất (explicit), không có thứ tự giữa các biến.
+ ******************************************************************************/
+extern _Atomic float Rte_Irv_TorqueControl_TorqueCommand;
+
+/******************************************************************************
+ * @brief   API ghi lệnh mô-men xoắn của vòng kín (Nm) từ runnable TorqueControl_Arbitrate
+ *
+ * @param   TorqueCommand - Giá trị mới
+ * @return  void
+ ******************************************************************************/
+static inline void Rte_IrvWrite_TorqueControl_Arbitrate_TorqueCommand(float TorqueCommand) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUECOMMAND, Rte_Trace_FloatBits(TorqueCommand));
+    atomic_store_explicit(&Rte_Irv_TorqueControl_TorqueCommand, TorqueCommand, memory_order_relaxed);
+}
+
+/******************************************************************************
+ * @brief   API đọc lệnh mô-men xoắn của vòng kín (Nm) từ runnable TorqueControl_Actuate
  *
  * @param   void
- * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
+ * @return  float - Giá trị mới nhất
+ ******************************************************************************/
+static inline float Rte_IrvRead_TorqueControl_Actuate_TorqueCommand(void) {
+    float value = atomic_load_explicit(&Rte_Irv_TorqueControl_TorqueCommand, memory_order_relaxed);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ACTUATE_TORQUECOMMAND, Rte_Trace_FloatBits(value));
+    return value;
+}
+
+/******************************************************************************
+ * @brief   API đọc lệnh mô-men xoắn của vòng kín (Nm) từ runnable TorqueControl_Monitor
+ *
+ * @param   void
+ * @return  float - Giá trị mới nhất
+ ******************************************************************************/
+static inline float Rte_IrvRead_TorqueControl_Monitor_TorqueCommand(void) {
+    float value = atomic_load_explicit(&Rte_Irv_TorqueControl_TorqueCommand, memory_order_relaxed);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUECOMMAND, Rte_Trace_FloatBits(value));
+    return value;
+}
+
+/******************************************************************************
+ * @brief   Biến trao đổi giữa các runnable: tải trọng hợp lệ gần nhất (kg)
+ *
+ * @details Ghi bởi `TorqueControl_Monitor`, đọc bởi `TorqueControl_Arbitrate`.
+ *          Các runnable chạy trên các task khác nhau; mỗi lần đọc/ghi là một thao tác
+ *          atomic trên giá trị mới nhất (explicit), không có thứ tự giữa các biến.
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpLoadSensor_Init(void);
+extern _Atomic float Rte_Irv_TorqueControl_LoadWeight;
 
 /******************************************************************************
- * @brief   API khởi tạo cảm biến mô-men xoắn
+ * @brief   API ghi tải trọng hợp lệ gần nhất (kg) từ runnable TorqueControl_Monitor
  *
- * @details Thiết lập cấu hình và khởi tạo cảm biến mô-men xoắn.
+ * @param   LoadWeight - Giá trị mới
+ * @return  void
+ ******************************************************************************/
+static inline void Rte_IrvWrite_TorqueControl_Monitor_LoadWeight(float LoadWeight) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_MONITOR_LOADWEIGHT, Rte_Trace_FloatBits(LoadWeight));
+    atomic_store_explicit(&Rte_Irv_TorqueControl_LoadWeight, LoadWeight, memory_order_relaxed);
+}
+
+/******************************************************************************
+ * @brief   API đọc tải trọng hợp lệ gần nhất (kg) từ runnable TorqueControl_Arbitrate
+ *
+ * @param   void
+ * @return  float - Giá trị mới nhất
+ ******************************************************************************/
+static inline float Rte_IrvRead_TorqueControl_Arbitrate_LoadWeight(void) {
+    float value = atomic_load_explicit(&Rte_Irv_TorqueControl_LoadWeight, memory_order_relaxed);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ARBITRATE_LOADWEIGHT, Rte_Trace_FloatBits(value));
+    return value;
+}
+
+/******************************************************************************
+ * @brief   Hàm khởi động RTE
+ *
+ * @details Khởi tạo các bộ đệm của phần tử dữ liệu. Gọi một lần trước khi tạo task.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+Std_ReturnType Rte_Start(void);
+
+/******************************************************************************
+ * @brief   API khởi tạo các cảm biến analog
+ *
+ * @details Khởi tạo bàn đạp ga, tốc độ, tải trọng và mô-men xoắn từ một bảng cấu
+ *          hình chung và áp dụng dải đo hiệu chuẩn.
  *
  * @param   void
  * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
-Std_ReturnType Rte_Call_RpTorqueSensor_Init(void);
+Std_ReturnType Rte_Call_RpAnalogSensors_Init(void);
 
 /******************************************************************************
  * @brief   API khởi tạo bộ điều khiển mô-men xoắn
  *
- * @details Thiết lập cấu hình và khởi tạo bộ điều khiển mô-men xoắn.
+ * @details Khởi tạo bộ điều khiển mô-men xoắn từ bảng cấu hình `Rte_MotorDriverConfig`
+ *          và áp dụng mô-men xoắn tối đa hiệu chuẩn.
  *
  * @param   void
  * @return  Std_ReturnType - Trả về E_OK nếu khởi tạo thành công, E_NOT_OK nếu có lỗi
  ******************************************************************************/
 Std_ReturnType Rte_Call_PpMotorDriver_Init(void);
 
+/******************************************************************************
+ * @brief   Runnable thu thập các cảm biến analog
+ *
+ * @details Đọc tất cả cảm biến trong một lần chuyển đổi nhóm và ghi kết quả vào bộ
+ *          đệm ba của RTE, sau đó báo data-received event khi bàn đạp ga thay đổi.
+ *          Gọi định kỳ từ task thu thập cảm biến.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Run_AnalogSensors_Acquire(void);
+
+/******************************************************************************
+ * @brief   Runnable phân xử mô-men và vòng kín Torque Control
+ *
+ * @details Sao chép dữ liệu cảm biến mới nhất vào bản sao implicit của task rồi gọi
+ *          `TorqueControl_Arbitrate`.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Run_TorqueControl_Arbitrate(void);
+
+/******************************************************************************
+ * @brief   Runnable cập nhật tải trọng và giám sát Torque Control
+ *
+ * @details Sao chép dữ liệu cảm biến mới nhất vào bản sao implicit của task rồi gọi
+ *          `TorqueControl_Monitor`.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Run_TorqueControl_Monitor(void);
+
+/******************************************************************************
+ * @brief   Thân task 1 ms của Torque Control
+ *
+ * @details Chạy `TorqueControl_Actuate` mỗi RTE_TORQUECONTROL_ACTUATE_PERIOD_MS theo
+ *          mốc thời gian tuyệt đối. Không bao giờ trả về.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Task_TorqueControl_1ms(void);
+
+/******************************************************************************
+ * @brief   Thân task 10 ms của Torque Control
+ *
+ * @details Chạy `Rte_Run_TorqueControl_Arbitrate` mỗi RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS
+ *          hoặc sớm hơn khi có data-received event của bàn đạp ga, và
+ *          `TorqueControl_ReloadCalibration` khi có sự kiện operation-invoked.
+ *          Không bao giờ trả về.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Task_TorqueControl_10ms(void);
+
+/******************************************************************************
+ * @brief   Thân task 100 ms của Torque Control
+ *
+ * @details Chạy `Rte_Run_TorqueControl_Monitor` mỗi RTE_TORQUECONTROL_MONITOR_PERIOD_MS
+ *          theo mốc thời gian tuyệt đối. Không bao giờ trả về.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Task_TorqueControl_100ms(void);
+
+/******************************************************************************
+ * @brief   API đọc vị trí bàn đạp ga
+ *
+ * @details Đọc từ bản sao implicit được tạo khi runnable bắt đầu, không truy cập
+ *          IoHwAb hay ADC.
+ *
+ * @param   ThrottlePosition - Con trỏ lưu trữ giá trị vị trí bàn đạp ga
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpThrottleSensor_ThrottlePosition(float* ThrottlePosition) {
+    *ThrottlePosition = RTE_PHYSICAL_TO_FLOAT(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_THROTTLE]);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPTHROTTLESENSOR_THROTTLEPOSITION, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_THROTTLE]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_THROTTLE] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   API đọc vị trí bàn đạp ga dạng dấu phẩy tĩnh
+ *
+ * @param   ThrottlePosition - Con trỏ lưu trữ vị trí bàn đạp ga dạng Q15
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpThrottleSensor_ThrottlePositionFixed(IoHwAb_Q15Type* ThrottlePosition) {
+    *ThrottlePosition = IOHWAB_Q16_16_TO_Q15(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_THROTTLE]);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPTHROTTLESENSOR_THROTTLEPOSITION, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_THROTTLE]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_THROTTLE] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+#endif
+
+/******************************************************************************
+ * @brief   API đọc tốc độ xe
+ *
+ * @details Đọc từ bản sao implicit được tạo khi runnable bắt đầu, không truy cập
+ *          IoHwAb hay ADC.
+ *
+ * @param   Speed - Con trỏ lưu trữ giá trị tốc độ xe
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpSpeedSensor_Speed(float* Speed) {
+    *Speed = RTE_PHYSICAL_TO_FLOAT(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_SPEED]);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPSPEEDSENSOR_SPEED, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_SPEED]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_SPEED] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   API đọc tốc độ xe dạng dấu phẩy tĩnh
+ *
+ * @param   Speed - Con trỏ lưu trữ tốc độ xe dạng Q16.16 (km/h)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpSpeedSensor_SpeedFixed(IoHwAb_Q16_16Type* Speed) {
+    *Speed = Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_SPEED];
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPSPEEDSENSOR_SPEED, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_SPEED]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_SPEED] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+#endif
+
+/******************************************************************************
+ * @brief   API đọc tải trọng
+ *
+ * @details Đọc từ bản sao implicit được tạo khi runnable bắt đầu, không truy cập
+ *          IoHwAb hay ADC.
+ *
+ * @param   LoadWeight - Con trỏ lưu trữ giá trị tải trọng
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpLoadSensor_LoadWeight(float* LoadWeight) {
+    *LoadWeight = RTE_PHYSICAL_TO_FLOAT(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_LOAD]);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPLOADSENSOR_LOADWEIGHT, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_LOAD]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_LOAD] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   API đọc tải trọng dạng dấu phẩy tĩnh
+ *
+ * @param   LoadWeight - Con trỏ lưu trữ tải trọng dạng Q16.16 (kg)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpLoadSensor_LoadWeightFixed(IoHwAb_Q16_16Type* LoadWeight) {
+    *LoadWeight = Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_LOAD];
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPLOADSENSOR_LOADWEIGHT, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_LOAD]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_LOAD] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+#endif
+
+/******************************************************************************
+ * @brief   API đọc mô-men xoắn thực tế
+ *
+ * @details Đọc từ bản sao implicit được tạo khi runnable bắt đầu, không truy cập
+ *          IoHwAb hay ADC.
+ *
+ * @param   ActualTorque - Con trỏ lưu trữ giá trị mô-men xoắn thực tế
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpTorqueSensor_ActualTorque(float* ActualTorque) {
+    *ActualTorque = RTE_PHYSICAL_TO_FLOAT(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_TORQUE]);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPTORQUESENSOR_ACTUALTORQUE, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_TORQUE]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_TORQUE] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   API đọc mô-men xoắn thực tế dạng dấu phẩy tĩnh
+ *
+ * @param   ActualTorque - Con trỏ lưu trữ mô-men xoắn thực tế dạng Q16.16 (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ
+ *          hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpTorqueSensor_ActualTorqueFixed(IoHwAb_Q16_16Type* ActualTorque) {
+    *ActualTorque = Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_TORQUE];
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPTORQUESENSOR_ACTUALTORQUE, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[IOHWAB_SENSOR_TORQUE]));
+    return (Rte_TorqueControl_AnalogSensors.Status[IOHWAB_SENSOR_TORQUE] == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+#endif
+
+/******************************************************************************
+ * @brief   API đọc mẫu kèm thời điểm và trạng thái
+ *
+ * @details Trả về giá trị, thời điểm chuyển đổi, tuổi (tính khi runnable bắt đầu)
+ *          và trạng thái của mẫu. Mẫu quá tuổi tối đa mang giá trị thay thế.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Con trỏ lưu trữ mẫu
+ * @return  Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu ID không hợp lệ
+ *          hoặc mẫu đã được thay thế
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpAnalogSensors_Sample(IoHwAb_SensorIdType SensorId, IoHwAb_SensorSampleType* Sample) {
+    if ((uint32_t)SensorId >= IOHWAB_NUM_ANALOG_SENSORS) {
+        return E_NOT_OK;
+    }
+    Sample->Value = RTE_PHYSICAL_TO_FLOAT(Rte_TorqueControl_AnalogSensors.Value[SensorId]);
+    Sample->TimestampMs = Rte_TorqueControl_AnalogSensors.TimestampMs[SensorId];
+    Sample->AgeMs = Rte_TorqueControl_AnalogSensors.AgeMs[SensorId];
+    Sample->Status = Rte_TorqueControl_AnalogSensors.Status[SensorId];
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPANALOGSENSORS_SAMPLE, RTE_PHYSICAL_TO_TRACE(Rte_TorqueControl_AnalogSensors.Value[SensorId]));
+    return (Sample->Status == IOHWAB_SENSOR_STATUS_VALID) ? E_OK : E_NOT_OK;
+}
+
+/******************************************************************************
+ * @brief   API ghi lệnh mô-men xoắn tới bộ điều khiển động cơ
+ *
+ * @details Chuyển tiếp tới `IoHwAb_MotorDriver_SetTorque` và lưu giá trị mới nhất.
+ *
+ * @param   TorqueValue - Giá trị cần ghi
+ * @return  Std_ReturnType - Trả về E_OK nếu ghi thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Write_PpMotorDriver_SetTorque(float TorqueValue) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_WRITE_PPMOTORDRIVER_SETTORQUE, RTE_PHYSICAL_TO_TRACE(RTE_PHYSICAL_FROM_FLOAT(TorqueValue)));
+    Std_ReturnType status = IoHwAb_MotorDriver_SetTorque(TorqueValue);
+    if (status == E_OK) {
+        Rte_Last_TorqueCommand = RTE_PHYSICAL_FROM_FLOAT(TorqueValue);
+    }
+    return status;
+}
+
+#if (IOHWAB_FIXED_POINT == STD_ON)
+/******************************************************************************
+ * @brief   API ghi lệnh mô-men xoắn tới bộ điều khiển động cơ dạng dấu phẩy tĩnh
+ *
+ * @param   TorqueValue - Giá trị cần ghi dạng Q16.16 (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu ghi thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Write_PpMotorDriver_SetTorqueFixed(IoHwAb_Q16_16Type TorqueValue) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_WRITE_PPMOTORDRIVER_SETTORQUE, RTE_PHYSICAL_TO_TRACE(TorqueValue));
+    Std_ReturnType status = IoHwAb_MotorDriver_SetTorqueFixed(TorqueValue);
+    if (status == E_OK) {
+        Rte_Last_TorqueCommand = TorqueValue;
+    }
+    return status;
+}
+#endif
+
+/******************************************************************************
+ * @brief   API đọc block NvM TorqueCalibration
+ *
+ * @details Sao chép bộ hiệu chuẩn (mô-men tối đa, các ngưỡng tốc độ và tải trọng)
+ *          từ RAM mirror của NvM. Giá trị mặc định được dùng khi flash chưa có dữ liệu.
+ *
+ * @param   TorqueCalibration - Con trỏ lưu trữ dữ liệu
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Read_RpCalibration_TorqueCalibration(NvM_TorqueCalibrationType* TorqueCalibration) {
+    Std_ReturnType status = NvM_ReadBlock(NVM_BLOCK_TORQUE_CALIBRATION, TorqueCalibration);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_READ_RPCALIBRATION_TORQUECALIBRATION, status);
+    return status;
+}
+
+/******************************************************************************
+ * @brief   API ghi block NvM TorqueCalibration
+ *
+ * @details Cập nhật RAM mirror của NvM; dữ liệu được ghi xuống flash trong nền.
+ *          Sau khi ghi thành công, Torque Control được yêu cầu nạp lại hiệu chuẩn.
+ *
+ * @param   TorqueCalibration - Con trỏ tới dữ liệu mới
+ * @return  Std_ReturnType - Trả về E_OK nếu yêu cầu được chấp nhận, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Write_PpCalibration_TorqueCalibration(const NvM_TorqueCalibrationType* TorqueCalibration) {
+    Std_ReturnType status = NvM_WriteBlock(NVM_BLOCK_TORQUE_CALIBRATION, TorqueCalibration);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_WRITE_PPCALIBRATION_TORQUECALIBRATION, status);
+    if (status == E_OK) {
+        (void)Rte_Call_PpTorqueControl_ReloadCalibration();
+    }
+    return status;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị vị trí bàn đạp ga mới nhất cho DCM
+ *
+ * @details Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập
+ *          phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị vị trí bàn đạp ga (0.0 - 1.0)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_ThrottlePosition_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    Rte_PhysicalValueType value = Rte_Last_ThrottlePosition;
+    *Data = RTE_PHYSICAL_TO_FLOAT(value);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_THROTTLEPOSITION_READDATA, RTE_PHYSICAL_TO_TRACE(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị tốc độ xe mới nhất cho DCM
+ *
+ * @details Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập
+ *          phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị tốc độ xe (km/h)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_VehicleSpeed_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    Rte_PhysicalValueType value = Rte_Last_Speed;
+    *Data = RTE_PHYSICAL_TO_FLOAT(value);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_VEHICLESPEED_READDATA, RTE_PHYSICAL_TO_TRACE(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị tải trọng mới nhất cho DCM
+ *
+ * @details Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập
+ *          phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị tải trọng (kg)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_LoadWeight_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    Rte_PhysicalValueType value = Rte_Last_LoadWeight;
+    *Data = RTE_PHYSICAL_TO_FLOAT(value);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_LOADWEIGHT_READDATA, RTE_PHYSICAL_TO_TRACE(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị mô-men xoắn thực tế mới nhất cho DCM
+ *
+ * @details Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập
+ *          phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị mô-men xoắn thực tế (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_ActualTorque_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    Rte_PhysicalValueType value = Rte_Last_ActualTorque;
+    *Data = RTE_PHYSICAL_TO_FLOAT(value);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_ACTUALTORQUE_READDATA, RTE_PHYSICAL_TO_TRACE(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị mô-men xoắn yêu cầu mới nhất cho DCM
+ *
+ * @details Trả về giá trị mới nhất của biến trao đổi `TorqueDemand` giữa các runnable,
+ *          không truy cập phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị mô-men xoắn yêu cầu (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_DesiredTorque_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    float value = atomic_load_explicit(&Rte_Irv_TorqueControl_TorqueDemand, memory_order_relaxed);
+    *Data = value;
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_DESIREDTORQUE_READDATA, Rte_Trace_FloatBits(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   DataServices: đọc giá trị lệnh mô-men xoắn gửi tới động cơ mới nhất cho DCM
+ *
+ * @details Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập
+ *          phần cứng. Dùng cho dịch vụ ReadDataByIdentifier.
+ *
+ * @param   Data - Con trỏ lưu trữ giá trị lệnh mô-men xoắn gửi tới động cơ (Nm)
+ * @return  Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_DataServices_TorqueCommand_ReadData(float* Data) {
+    if (Data == NULL) {
+        return E_NOT_OK;
+    }
+    Rte_PhysicalValueType value = Rte_Last_TorqueCommand;
+    *Data = RTE_PHYSICAL_TO_FLOAT(value);
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_DATASERVICES_TORQUECOMMAND_READDATA, RTE_PHYSICAL_TO_TRACE(value));
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   ID sự kiện chẩn đoán của TorqueControl
+ *
+ * @details ID là mã DTC 3 byte mà DEM lưu và DCM báo qua ReadDTCInformation.
+ ******************************************************************************/
+#define RTE_DEM_EVENT_TORQUECONTROL_TORQUETRACKING 0x1A0000UL  /**< Torque tracking fault */
+#define RTE_DEM_EVENT_TORQUECONTROL_THROTTLESENSOR 0x1A0100UL  /**< Throttle sensor invalid */
+#define RTE_DEM_EVENT_TORQUECONTROL_SPEEDSENSOR    0x1A0200UL  /**< Speed sensor invalid */
+#define RTE_DEM_EVENT_TORQUECONTROL_LOADSENSOR     0x1A0300UL  /**< Load sensor invalid */
+#define RTE_DEM_EVENT_TORQUECONTROL_TORQUESENSOR   0x1A0400UL  /**< Torque sensor invalid */
+
+/******************************************************************************
+ * @brief   API báo kết quả kiểm tra: mô-men xoắn thực tế không bám lệnh
+ *
+ * @details DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,
+ *          DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).
+ *          Chỉ nên gọi khi kết quả thay đổi.
+ *
+ * @param   EventStatus - Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_Event_TorqueTracking_SetEventStatus(Dem_EventStatusType EventStatus) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_EVENT_TORQUETRACKING_SETEVENTSTATUS, EventStatus);
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        Dem_ReportErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_TORQUETRACKING, "Torque tracking fault");
+    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {
+        Dem_ClearErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_TORQUETRACKING);
+    } else {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   API báo kết quả kiểm tra: cảm biến bàn đạp ga không hợp lệ
+ *
+ * @details DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,
+ *          DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).
+ *          Chỉ nên gọi khi kết quả thay đổi.
+ *
+ * @param   EventStatus - Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_Event_ThrottleSensor_SetEventStatus(Dem_EventStatusType EventStatus) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_EVENT_THROTTLESENSOR_SETEVENTSTATUS, EventStatus);
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        Dem_ReportErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_THROTTLESENSOR, "Throttle sensor invalid");
+    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {
+        Dem_ClearErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_THROTTLESENSOR);
+    } else {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   API báo kết quả kiểm tra: cảm biến tốc độ không hợp lệ
+ *
+ * @details DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,
+ *          DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).
+ *          Chỉ nên gọi khi kết quả thay đổi.
+ *
+ * @param   EventStatus - Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_Event_SpeedSensor_SetEventStatus(Dem_EventStatusType EventStatus) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_EVENT_SPEEDSENSOR_SETEVENTSTATUS, EventStatus);
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        Dem_ReportErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_SPEEDSENSOR, "Speed sensor invalid");
+    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {
+        Dem_ClearErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_SPEEDSENSOR);
+    } else {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   API báo kết quả kiểm tra: cảm biến tải trọng không hợp lệ
+ *
+ * @details DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,
+ *          DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).
+ *          Chỉ nên gọi khi kết quả thay đổi.
+ *
+ * @param   EventStatus - Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_Event_LoadSensor_SetEventStatus(Dem_EventStatusType EventStatus) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_EVENT_LOADSENSOR_SETEVENTSTATUS, EventStatus);
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        Dem_ReportErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_LOADSENSOR, "Load sensor invalid");
+    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {
+        Dem_ClearErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_LOADSENSOR);
+    } else {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   API báo kết quả kiểm tra: cảm biến mô-men xoắn không hợp lệ
+ *
+ * @details DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,
+ *          DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).
+ *          Chỉ nên gọi khi kết quả thay đổi.
+ *
+ * @param   EventStatus - Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ
+ ******************************************************************************/
+static inline Std_ReturnType Rte_Call_Event_TorqueSensor_SetEventStatus(Dem_EventStatusType EventStatus) {
+    RTE_TRACE_HOOK(RTE_TRACE_ID_CALL_EVENT_TORQUESENSOR_SETEVENTSTATUS, EventStatus);
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        Dem_ReportErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_TORQUESENSOR, "Torque sensor invalid");
+    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {
+        Dem_ClearErrorStatus((int)RTE_DEM_EVENT_TORQUECONTROL_TORQUESENSOR);
+    } else {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
 #endif // RTE_TORQUECONTROL_H
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * @file    Rte_TorqueControl_Cfg.c
+ * @brief   Phần tử dữ liệu và bảng cấu hình RTE của TorqueControl
+ *
+ * @details File được sinh bởi Tools/RteGen/rte_gen.py từ TorqueControl.json,
+ *          không sửa trực tiếp.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "Rte_TorqueControl.h"
+
+_Thread_local Rte_AnalogSensorsDataType Rte_TorqueControl_AnalogSensors;
+
+_Atomic float Rte_Irv_TorqueControl_TorqueDemand = 0.0f;
+_Atomic float Rte_Irv_TorqueControl_TorqueCommand = 0.0f;
+_Atomic float Rte_Irv_TorqueControl_LoadWeight = 0.0f;
+
+Os_EventType Rte_TorqueControl_Event;
+
+volatile Rte_PhysicalValueType Rte_Last_ThrottlePosition = 0;
+volatile Rte_PhysicalValueType Rte_Last_Speed = 0;
+volatile Rte_PhysicalValueType Rte_Last_LoadWeight = 0;
+volatile Rte_PhysicalValueType Rte_Last_ActualTorque = 0;
+volatile Rte_PhysicalValueType Rte_Last_TorqueCommand = 0;
+
+volatile Rte_PhysicalValueType* const Rte_AnalogSensors_LastValue[IOHWAB_NUM_ANALOG_SENSORS] = {
+    [IOHWAB_SENSOR_THROTTLE] = &Rte_Last_ThrottlePosition,
+    [IOHWAB_SENSOR_SPEED] = &Rte_Last_Speed,
+    [IOHWAB_SENSOR_LOAD] = &Rte_Last_LoadWeight,
+    [IOHWAB_SENSOR_TORQUE] = &Rte_Last_ActualTorque,
+};
+
+#if (RTE_VFB_TRACE == STD_ON)
+const char* const Rte_TorqueControl_TraceApiName[RTE_TORQUECONTROL_TRACE_NUM_APIS] = {
+    [RTE_TRACE_ID_CALL_PPTORQUECONTROL_RELOADCALIBRATION] = "Rte_Call_PpTorqueControl_ReloadCalibration",
+    [RTE_TRACE_ID_READ_RPTHROTTLESENSOR_THROTTLEPOSITION] = "Rte_Read_RpThrottleSensor_ThrottlePosition",
+    [RTE_TRACE_ID_READ_RPSPEEDSENSOR_SPEED] = "Rte_Read_RpSpeedSensor_Speed",
+    [RTE_TRACE_ID_READ_RPLOADSENSOR_LOADWEIGHT] = "Rte_Read_RpLoadSensor_LoadWeight",
+    [RTE_TRACE_ID_READ_RPTORQUESENSOR_ACTUALTORQUE] = "Rte_Read_RpTorqueSensor_ActualTorque",
+    [RTE_TRACE_ID_READ_RPANALOGSENSORS_SAMPLE] = "Rte_Read_RpAnalogSensors_Sample",
+    [RTE_TRACE_ID_WRITE_PPMOTORDRIVER_SETTORQUE] = "Rte_Write_PpMotorDriver_SetTorque",
+    [RTE_TRACE_ID_READ_RPCALIBRATION_TORQUECALIBRATION] = "Rte_Read_RpCalibration_TorqueCalibration",
+    [RTE_TRACE_ID_WRITE_PPCALIBRATION_TORQUECALIBRATION] = "Rte_Write_PpCalibration_TorqueCalibration",
+    [RTE_TRACE_ID_CALL_DATASERVICES_THROTTLEPOSITION_READDATA] = "Rte_Call_DataServices_ThrottlePosition_ReadData",
+    [RTE_TRACE_ID_CALL_DATASERVICES_VEHICLESPEED_READDATA] = "Rte_Call_DataServices_VehicleSpeed_ReadData",
+    [RTE_TRACE_ID_CALL_DATASERVICES_LOADWEIGHT_READDATA] = "Rte_Call_DataServices_LoadWeight_ReadData",
+    [RTE_TRACE_ID_CALL_DATASERVICES_ACTUALTORQUE_READDATA] = "Rte_Call_DataServices_ActualTorque_ReadData",
+    [RTE_TRACE_ID_CALL_DATASERVICES_DESIREDTORQUE_READDATA] = "Rte_Call_DataServices_DesiredTorque_ReadData",
+    [RTE_TRACE_ID_CALL_DATASERVICES_TORQUECOMMAND_READDATA] = "Rte_Call_DataServices_TorqueCommand_ReadData",
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUEDEMAND] = "Rte_IrvWrite_TorqueControl_Arbitrate_TorqueDemand",
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUEDEMAND] = "Rte_IrvRead_TorqueControl_Monitor_TorqueDemand",
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUECOMMAND] = "Rte_IrvWrite_TorqueControl_Arbitrate_TorqueCommand",
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ACTUATE_TORQUECOMMAND] = "Rte_IrvRead_TorqueControl_Actuate_TorqueCommand",
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUECOMMAND] = "Rte_IrvRead_TorqueControl_Monitor_TorqueCommand",
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_MONITOR_LOADWEIGHT] = "Rte_IrvWrite_TorqueControl_Monitor_LoadWeight",
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ARBITRATE_LOADWEIGHT] = "Rte_IrvRead_TorqueControl_Arbitrate_LoadWeight",
+    [RTE_TRACE_ID_CALL_EVENT_TORQUETRACKING_SETEVENTSTATUS] = "Rte_Call_Event_TorqueTracking_SetEventStatus",
+    [RTE_TRACE_ID_CALL_EVENT_THROTTLESENSOR_SETEVENTSTATUS] = "Rte_Call_Event_ThrottleSensor_SetEventStatus",
+    [RTE_TRACE_ID_CALL_EVENT_SPEEDSENSOR_SETEVENTSTATUS] = "Rte_Call_Event_SpeedSensor_SetEventStatus",
+    [RTE_TRACE_ID_CALL_EVENT_LOADSENSOR_SETEVENTSTATUS] = "Rte_Call_Event_LoadSensor_SetEventStatus",
+    [RTE_TRACE_ID_CALL_EVENT_TORQUESENSOR_SETEVENTSTATUS] = "Rte_Call_Event_TorqueSensor_SetEventStatus",
+};
+
+const uint8_t Rte_TorqueControl_TraceApiFormat[RTE_TORQUECONTROL_TRACE_NUM_APIS] = {
+    [RTE_TRACE_ID_CALL_PPTORQUECONTROL_RELOADCALIBRATION] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_READ_RPTHROTTLESENSOR_THROTTLEPOSITION] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_READ_RPSPEEDSENSOR_SPEED] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_READ_RPLOADSENSOR_LOADWEIGHT] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_READ_RPTORQUESENSOR_ACTUALTORQUE] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_READ_RPANALOGSENSORS_SAMPLE] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_WRITE_PPMOTORDRIVER_SETTORQUE] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_READ_RPCALIBRATION_TORQUECALIBRATION] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_WRITE_PPCALIBRATION_TORQUECALIBRATION] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_CALL_DATASERVICES_THROTTLEPOSITION_READDATA] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_CALL_DATASERVICES_VEHICLESPEED_READDATA] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_CALL_DATASERVICES_LOADWEIGHT_READDATA] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_CALL_DATASERVICES_ACTUALTORQUE_READDATA] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_CALL_DATASERVICES_DESIREDTORQUE_READDATA] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_CALL_DATASERVICES_TORQUECOMMAND_READDATA] = RTE_TRACE_VALUE_FORMAT,
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUEDEMAND] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUEDEMAND] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_ARBITRATE_TORQUECOMMAND] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ACTUATE_TORQUECOMMAND] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_MONITOR_TORQUECOMMAND] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVWRITE_TORQUECONTROL_MONITOR_LOADWEIGHT] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_IRVREAD_TORQUECONTROL_ARBITRATE_LOADWEIGHT] = RTE_TRACE_FORMAT_FLOAT,
+    [RTE_TRACE_ID_CALL_EVENT_TORQUETRACKING_SETEVENTSTATUS] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_CALL_EVENT_THROTTLESENSOR_SETEVENTSTATUS] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_CALL_EVENT_SPEEDSENSOR_SETEVENTSTATUS] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_CALL_EVENT_LOADSENSOR_SETEVENTSTATUS] = RTE_TRACE_FORMAT_RAW,
+    [RTE_TRACE_ID_CALL_EVENT_TORQUESENSOR_SETEVENTSTATUS] = RTE_TRACE_FORMAT_RAW,
+};
+#endif
+
+const MotorDriver_ConfigType Rte_MotorDriverConfig = {
+    .Motor_Channel = 1,                 // Kênh PWM pha A (pha B, C: kênh 2, 3)
+    .Motor_MaxTorque = 300              // Mô-men xoắn tối đa mặc định (Nm)
+};
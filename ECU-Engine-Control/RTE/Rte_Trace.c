@@ -0,0 +1,170 @@
+/******************************************************************************
+ * @file    Rte_Trace.c
+ * @brief   Triển khai bộ đệm trace theo task và task chuyển trace xuống file
+ *
+ * @details Định dạng file (little-endian):
+ *          - "RTET", uint8 phiên bản, uint8 dự trữ, uint16 số API;
+ *          - với mỗi API: uint8 định dạng giá trị, uint8 độ dài tên, tên (không có
+ *            ký tự kết thúc);
+ *          - sau đó là các `Rte_TraceRecordType` (16 byte). Bản ghi của các task
+ *            khác nhau xen kẽ theo từng lần chuyển, thời điểm chỉ tăng dần trong
+ *            cùng một task.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "Rte_Trace.h"
+
+#if (RTE_VFB_TRACE == STD_ON)
+
+#include <stdio.h>
+
+#define RTE_TRACE_FILE_VERSION  1U
+#define RTE_TRACE_BATCH_SIZE    256U   /**< Số bản ghi mỗi lần fwrite */
+
+_Thread_local Rte_TraceRingType* Rte_Trace_ThreadRing = NULL;
+
+static Rte_TraceRingType Rte_TraceRing[RTE_TRACE_MAX_THREADS];
+static atomic_uint Rte_TraceThreadCount;
+static FILE* Rte_TraceFile = NULL;
+
+/******************************************************************************
+ * @brief   Hiệu chuẩn bộ đếm của hook theo Os_GetTimeNs
+ *
+ * @details Điểm gốc được lấy khi khởi tạo; tỉ lệ ns/tick được tính lại ở mỗi lần
+ *          chuyển từ điểm gốc tới hiện tại nên càng chạy lâu càng chính xác.
+ ******************************************************************************/
+static uint64_t Rte_TraceBaseTicks;
+static uint64_t Rte_TraceBaseNs;
+static double Rte_TraceNsPerTick = 1.0;
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo trace
+ *
+ * @details Mở file đầu ra và ghi phần đầu file. Tên dài hơn 255 ký tự bị cắt.
+ *
+ * @param   PortName - Bảng tên API theo ID
+ * @param   PortFormat - Bảng định dạng giá trị (RTE_TRACE_FORMAT_*) theo ID
+ * @param   PortCount - Số phần tử của các bảng
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu không mở được file
+ ******************************************************************************/
+Std_ReturnType Rte_Trace_Init(const char* const* PortName, const uint8_t* PortFormat, uint16_t PortCount) {
+    Rte_TraceFile = fopen(RTE_TRACE_FILE_PATH, "wb");
+    if (Rte_TraceFile == NULL) {
+        printf("RTE trace: không mở được file %s.\n", RTE_TRACE_FILE_PATH);
+        return E_NOT_OK;
+    }
+
+    uint8_t header[8] = { 'R', 'T', 'E', 'T', RTE_TRACE_FILE_VERSION, 0U,
+                          (uint8_t)(PortCount & 0xFFU), (uint8_t)(PortCount >> 8) };
+    fwrite(header, 1, sizeof(header), Rte_TraceFile);
+    for (uint16_t i = 0; i < PortCount; i++) {
+        size_t length = strlen(PortName[i]);
+        uint8_t entry[2] = { PortFormat[i], (uint8_t)((length > 255U) ? 255U : length) };
+        fwrite(entry, 1, sizeof(entry), Rte_TraceFile);
+        fwrite(PortName[i], 1, entry[1], Rte_TraceFile);
+    }
+    fflush(Rte_TraceFile);
+
+    Rte_TraceBaseTicks = Rte_Trace_Timestamp();
+    Rte_TraceBaseNs = Os_GetTimeNs();
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm gán bộ đệm cho task hiện tại
+ *
+ * @details Bộ đệm được cấp theo thứ tự task gọi API RTE lần đầu. Khi đã hết bộ đệm,
+ *          task đó không được trace.
+ *
+ * @param   void
+ * @return  Rte_TraceRingType* - Bộ đệm của task, NULL nếu đã hết bộ đệm
+ ******************************************************************************/
+Rte_TraceRingType* Rte_Trace_AttachThread(void) {
+    if (atomic_load_explicit(&Rte_TraceThreadCount, memory_order_relaxed) >= RTE_TRACE_MAX_THREADS) {
+        return NULL;
+    }
+    unsigned int index = atomic_fetch_add_explicit(&Rte_TraceThreadCount, 1U, memory_order_relaxed);
+    if (index >= RTE_TRACE_MAX_THREADS) {
+        return NULL;
+    }
+    Rte_Trace_ThreadRing = &Rte_TraceRing[index];
+    return Rte_Trace_ThreadRing;
+}
+
+/******************************************************************************
+ * @brief   Hàm chuyển các bản ghi của một bộ đệm xuống file
+ *
+ * @param   Ring - Bộ đệm
+ * @param   ThreadId - Chỉ số của bộ đệm
+ * @return  void
+ ******************************************************************************/
+static void Rte_Trace_DrainRing(Rte_TraceRingType* Ring, uint16_t ThreadId) {
+    Rte_TraceRecordType batch[RTE_TRACE_BATCH_SIZE];
+    unsigned int tail = atomic_load_explicit(&Ring->Tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&Ring->Head, memory_order_acquire);
+
+    while (tail != head) {
+        unsigned int count = head - tail;
+        if (count > RTE_TRACE_BATCH_SIZE) {
+            count = RTE_TRACE_BATCH_SIZE;
+        }
+        for (unsigned int i = 0; i < count; i++) {
+            batch[i] = Ring->Record[(tail + i) & (RTE_TRACE_RING_SIZE - 1U)];
+            batch[i].TimestampNs = Rte_TraceBaseNs +
+                (uint64_t)((double)(int64_t)(batch[i].TimestampNs - Rte_TraceBaseTicks) * Rte_TraceNsPerTick);
+            batch[i].ThreadId = ThreadId;
+        }
+        tail += count;
+        // Trả ô lại cho task ghi ngay sau khi sao chép, trước khi ghi file
+        atomic_store_explicit(&Ring->Tail, tail, memory_order_release);
+        fwrite(batch, sizeof(Rte_TraceRecordType), count, Rte_TraceFile);
+    }
+
+    unsigned int dropped = atomic_load_explicit(&Ring->Dropped, memory_order_relaxed);
+    if (dropped != Ring->DroppedReported) {
+        Rte_TraceRecordType record = {
+            .TimestampNs = Os_GetTimeNs(),
+            .Value = dropped - Ring->DroppedReported,
+            .PortId = RTE_TRACE_ID_DROPPED,
+            .ThreadId = ThreadId
+        };
+        Ring->DroppedReported = dropped;
+        fwrite(&record, sizeof(record), 1, Rte_TraceFile);
+    }
+}
+
+/******************************************************************************
+ * @brief   Hàm chuyển các bản ghi xuống file
+ *
+ * @details Gọi định kỳ từ task trace; chỉ task này đọc các bộ đệm và ghi file.
+ *          Thời điểm của bản ghi được đổi từ bộ đếm CPU sang ns trước khi ghi.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Trace_MainFunction(void) {
+    if (Rte_TraceFile == NULL) {
+        return;
+    }
+
+    uint64_t ticks = Rte_Trace_Timestamp() - Rte_TraceBaseTicks;
+    if (ticks > 0U) {
+        Rte_TraceNsPerTick = (double)(Os_GetTimeNs() - Rte_TraceBaseNs) / (double)ticks;
+    }
+
+    unsigned int threads = atomic_load_explicit(&Rte_TraceThreadCount, memory_order_relaxed);
+    if (threads > RTE_TRACE_MAX_THREADS) {
+        threads = RTE_TRACE_MAX_THREADS;
+    }
+    for (unsigned int i = 0; i < threads; i++) {
+        Rte_Trace_DrainRing(&Rte_TraceRing[i], (uint16_t)i);
+    }
+    fflush(Rte_TraceFile);
+}
+
+#endif /* RTE_VFB_TRACE */
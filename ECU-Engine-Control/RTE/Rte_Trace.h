@@ -0,0 +1,206 @@
+/******************************************************************************
+ * @file    Rte_Trace.h
+ * @brief   Hook trace VFB dạng nhị phân cho các API truy cập dữ liệu của RTE
+ *
+ * @details Khi bật `RTE_VFB_TRACE`, mỗi lần gọi API RTE (`Rte_Read_*`, `Rte_Write_*`,
+ *          `Rte_Call_*`) ghi một bản ghi gồm ID cổng, thời điểm và giá trị vào bộ
+ *          đệm vòng riêng của task đang gọi. Mỗi bộ đệm chỉ có một task ghi và một
+ *          task đọc (task trace), nên không cần khóa: hook chỉ gồm một lần đọc bộ
+ *          đếm chu kỳ của CPU, một lần ghi 16 byte và một phép store release. Task
+ *          trace định kỳ đổi bộ đếm sang thời gian của Os và chuyển các bản ghi
+ *          xuống file nhị phân; dùng
+ *          `Tools/RteTrace/rte_trace_dump.py` để giải mã.
+ *
+ *          Khi tắt (mặc định), `RTE_TRACE_HOOK` không sinh mã và đối số không được
+ *          tính.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef RTE_TRACE_H
+#define RTE_TRACE_H
+
+#include <stdatomic.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Os.h"                      // Đồng hồ đơn điệu cho thời điểm của bản ghi
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>               // __rdtsc
+#endif
+
+/******************************************************************************
+ * @brief   Bật/tắt hook trace VFB khi biên dịch
+ *
+ * @details STD_OFF: các hook bị loại bỏ hoàn toàn. Có thể ghi đè khi biên dịch,
+ *          ví dụ `-DRTE_VFB_TRACE=STD_ON`.
+ ******************************************************************************/
+#ifndef RTE_VFB_TRACE
+#define RTE_VFB_TRACE STD_OFF
+#endif
+
+/******************************************************************************
+ * @brief   Cấu hình trace
+ ******************************************************************************/
+#define RTE_TRACE_RING_SIZE          4096U               /**< Số bản ghi mỗi bộ đệm (lũy thừa của 2) */
+#define RTE_TRACE_MAX_THREADS        8U                  /**< Số task tối đa được trace */
+#define RTE_TRACE_DRAIN_PERIOD_MS    50U                 /**< Chu kỳ của task trace (ms) */
+#define RTE_TRACE_FILE_PATH          "Rte_Trace.bin"     /**< File đầu ra */
+
+/******************************************************************************
+ * @brief   Định dạng giá trị trong bản ghi
+ ******************************************************************************/
+#define RTE_TRACE_FORMAT_FLOAT       0U    /**< Bit của số float */
+#define RTE_TRACE_FORMAT_Q16_16      1U    /**< Số dấu phẩy tĩnh Q16.16 */
+#define RTE_TRACE_FORMAT_RAW         2U    /**< Số nguyên không dấu (trạng thái trả về) */
+
+/******************************************************************************
+ * @brief   ID cổng đặc biệt: số bản ghi bị bỏ do bộ đệm đầy
+ ******************************************************************************/
+#define RTE_TRACE_ID_DROPPED         0xFFFFU
+
+/******************************************************************************
+ * @brief   ID của một API RTE được trace (sinh bởi RteGen)
+ ******************************************************************************/
+typedef uint16_t Rte_TracePortIdType;
+
+/******************************************************************************
+ * @brief   Bản ghi trace (16 byte, ghi nguyên dạng xuống file)
+ ******************************************************************************/
+typedef struct {
+    uint64_t TimestampNs;            /**< Thời điểm gọi API: bộ đếm CPU trong bộ đệm, ns (Os_GetTimeNs) trong file */
+    uint32_t Value;                  /**< Giá trị đọc/ghi hoặc trạng thái trả về */
+    uint16_t PortId;                 /**< ID của API */
+    uint16_t ThreadId;               /**< Chỉ số bộ đệm, do task trace điền */
+} Rte_TraceRecordType;
+
+/******************************************************************************
+ * @brief   Bộ đệm vòng của một task
+ *
+ * @details `Head` chỉ được task sở hữu ghi, `Tail` chỉ được task trace ghi; hai chỉ
+ *          số nằm trên các cache line khác nhau để tránh chia sẻ giả.
+ ******************************************************************************/
+typedef struct {
+    Rte_TraceRecordType Record[RTE_TRACE_RING_SIZE];  /**< Các bản ghi */
+    _Alignas(64) atomic_uint Head;                    /**< Số bản ghi đã ghi */
+    atomic_uint Dropped;                              /**< Số bản ghi bị bỏ do đầy */
+    _Alignas(64) atomic_uint Tail;                    /**< Số bản ghi đã chuyển xuống file */
+    unsigned int DroppedReported;                     /**< Số bản ghi bỏ đã báo (task trace) */
+} Rte_TraceRingType;
+
+#if (RTE_VFB_TRACE == STD_ON)
+
+/******************************************************************************
+ * @brief   Bộ đệm của task hiện tại (NULL khi task chưa gọi API RTE nào)
+ ******************************************************************************/
+extern _Thread_local Rte_TraceRingType* Rte_Trace_ThreadRing;
+
+/******************************************************************************
+ * @brief   Hàm khởi tạo trace
+ *
+ * @details Mở file đầu ra và ghi phần đầu file gồm tên và định dạng giá trị của
+ *          các API. Gọi một lần từ `Rte_Start` trước khi tạo task.
+ *
+ * @param   PortName - Bảng tên API theo ID
+ * @param   PortFormat - Bảng định dạng giá trị (RTE_TRACE_FORMAT_*) theo ID
+ * @param   PortCount - Số phần tử của các bảng
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu không mở được file
+ ******************************************************************************/
+Std_ReturnType Rte_Trace_Init(const char* const* PortName, const uint8_t* PortFormat, uint16_t PortCount);
+
+/******************************************************************************
+ * @brief   Hàm gán bộ đệm cho task hiện tại
+ *
+ * @details Được gọi ở lần trace đầu tiên của mỗi task.
+ *
+ * @param   void
+ * @return  Rte_TraceRingType* - Bộ đệm của task, NULL nếu đã hết bộ đệm
+ ******************************************************************************/
+Rte_TraceRingType* Rte_Trace_AttachThread(void);
+
+/******************************************************************************
+ * @brief   Hàm chuyển các bản ghi xuống file
+ *
+ * @details Gọi định kỳ từ task trace. Với mỗi bộ đệm, ghi các bản ghi mới và một
+ *          bản ghi RTE_TRACE_ID_DROPPED nếu có bản ghi bị bỏ kể từ lần trước.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void Rte_Trace_MainFunction(void);
+
+/******************************************************************************
+ * @brief   Hàm đọc bộ đếm thời gian của hook
+ *
+ * @details Đọc trực tiếp bộ đếm chu kỳ bất biến của CPU (TSC trên x86, CNTVCT trên
+ *          AArch64) thay vì gọi `clock_gettime`, vốn chiếm phần lớn chi phí của hook.
+ *          Nền tảng khác dùng `Os_GetTimeNs`.
+ *
+ * @param   void
+ * @return  uint64_t - Giá trị bộ đếm
+ ******************************************************************************/
+static inline uint64_t Rte_Trace_Timestamp(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return Os_GetTimeNs();
+#endif
+}
+
+/******************************************************************************
+ * @brief   Hàm ghi một bản ghi trace (phía task gọi API)
+ *
+ * @details Không khóa, không chờ: khi bộ đệm đầy, bản ghi bị bỏ và được đếm.
+ *
+ * @param   PortId - ID của API
+ * @param   Value - Giá trị đã mã hóa theo định dạng của file
+ * @return  void
+ ******************************************************************************/
+static inline void Rte_Trace_Record(Rte_TracePortIdType PortId, uint32_t Value) {
+    Rte_TraceRingType* ring = Rte_Trace_ThreadRing;
+    if (ring == NULL) {
+        ring = Rte_Trace_AttachThread();
+        if (ring == NULL) {
+            return;
+        }
+    }
+
+    unsigned int head = atomic_load_explicit(&ring->Head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&ring->Tail, memory_order_acquire) >= RTE_TRACE_RING_SIZE) {
+        atomic_store_explicit(&ring->Dropped, atomic_load_explicit(&ring->Dropped, memory_order_relaxed) + 1U,
+                              memory_order_relaxed);
+        return;
+    }
+
+    Rte_TraceRecordType* record = &ring->Record[head & (RTE_TRACE_RING_SIZE - 1U)];
+    record->TimestampNs = Rte_Trace_Timestamp();
+    record->Value = Value;
+    record->PortId = PortId;
+    atomic_store_explicit(&ring->Head, head + 1U, memory_order_release);
+}
+
+/******************************************************************************
+ * @brief   Hàm lấy bit của số float để lưu vào bản ghi
+ ******************************************************************************/
+static inline uint32_t Rte_Trace_FloatBits(float Value) {
+    uint32_t bits;
+    memcpy(&bits, &Value, sizeof(bits));
+    return bits;
+}
+
+#define RTE_TRACE_HOOK(PortId, Value)   Rte_Trace_Record((PortId), (uint32_t)(Value))
+
+#else
+
+#define RTE_TRACE_HOOK(PortId, Value)   ((void)0)
+
+#endif /* RTE_VFB_TRACE */
+
+#endif /* RTE_TRACE_H */
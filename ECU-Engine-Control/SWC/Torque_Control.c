@@ -4,9 +4,14 @@
  *          bao gồm các hàm khởi tạo và cập nhật.
  *
  * @details Module này tương tác với RTE để khởi tạo và điều khiển các cảm biến
- *          và bộ truyền động liên quan đến điều khiển mô-men xoắn. Nó đọc các 
- *          giá trị từ bàn đạp ga, tốc độ, tải trọng và mô-men xoắn thực tế để
- *          tính toán mô-men xoắn yêu cầu và điều chỉnh cho phù hợp.
+ *          và bộ truyền động liên quan đến điều khiển mô-men xoắn. Các runnable chạy
+ *          trên ba task với chu kỳ khác nhau và trao đổi dữ liệu qua biến nội bộ
+ *          (inter-runnable variable) của RTE:
+ *          - 1 ms: chia nhỏ lệnh mô-men thành các bước đều và gửi tới động cơ;
+ *          - 10 ms: tra mô-men yêu cầu trên bản đồ hiệu chuẩn theo tốc độ và bàn đạp
+ *            ga, cộng phần bù theo tải trọng, vòng kín PI theo mô-men xoắn thực tế
+ *            quanh giá trị yêu cầu (feed-forward);
+ *          - 100 ms: cập nhật tải trọng, giám sát cảm biến và độ bám của mô-men.
  * 
  * @version 1.0
  * @author  
@@ -17,7 +22,174 @@
 
 #include "Rte_TorqueControl.h"   // Bao gồm interface của RTE cho Torque Control 
 #include "Torque_Control.h"
-#include <stdio.h>               // Thư viện cho printf 
+#include "Mem.h"                 // Arena tạm cho dữ liệu trong một chu kỳ
+#include "Pid.h"                 // Bộ điều khiển PI của vòng kín mô-men
+#include "Intp.h"                // Nội suy bản đồ mô-men yêu cầu và đường cong bù tải
+#include "Dlt.h"                 // Log bất đồng bộ
+
+/******************************************************************************
+ * @brief   Dữ liệu của một chu kỳ cập nhật mô-men xoắn
+ *
+ * @details Ảnh chụp các giá trị đọc từ cảm biến và kết quả tính toán trong một
+ *          chu kỳ, được cấp phát từ arena tạm thay vì trên stack.
+ ******************************************************************************/
+typedef struct {
+    float throttle_input;   /**< Vị trí bàn đạp ga (0..1) */
+    float current_speed;    /**< Tốc độ xe (km/h) */
+    float load_weight;      /**< Tải trọng (kg), do runnable 100 ms cập nhật */
+    float desired_torque;   /**< Mô-men xoắn yêu cầu (Nm) */
+    float actual_torque;    /**< Mô-men xoắn thực tế (Nm) */
+    float command;          /**< Lệnh mô-men xoắn sau vòng kín (Nm) */
+} TorqueControl_CycleDataType;
+
+/******************************************************************************
+ * @brief   Bảng tra của bộ hiệu chuẩn đang dùng
+ *
+ * @details Bản đồ mô-men yêu cầu (trục X: tốc độ, trục Y: bàn đạp ga) và đường cong
+ *          bù tải trỏ trực tiếp vào mảng của bộ hiệu chuẩn; nghịch đảo khoảng cách
+ *          giữa các điểm chia được tính sẵn khi nạp hiệu chuẩn.
+ ******************************************************************************/
+typedef struct {
+    float SpeedInvDelta[NVM_TORQUE_MAP_SPEED_POINTS - 1U];
+    float ThrottleInvDelta[NVM_TORQUE_MAP_THROTTLE_POINTS - 1U];
+    float LoadInvDelta[NVM_LOAD_CURVE_POINTS - 1U];
+    Intp_MapF32Type DemandMap;
+    Intp_CurveF32Type LoadCurve;
+} TorqueControl_TablesType;
+
+static uint8_t TorqueControl_ScratchBuffer[TORQUE_CONTROL_SCRATCH_SIZE];  /**< Bộ nhớ của arena */
+static Mem_ArenaType TorqueControl_Arena;                                /**< Arena tạm theo chu kỳ */
+static NvM_TorqueCalibrationType TorqueControl_Calibration;              /**< Bộ hiệu chuẩn đang dùng */
+static Pid_StateType TorqueControl_Pid;                                  /**< Bộ điều khiển PI vòng kín mô-men (task 10 ms) */
+static TorqueControl_TablesType TorqueControl_Tables;                    /**< Bảng tra của bộ hiệu chuẩn đang dùng */
+static uint8_t TorqueControl_CalibrationLoaded = 0U;                     /**< 1 khi đã nạp được bộ hiệu chuẩn */
+static Intp_CacheType TorqueControl_SpeedCache;                          /**< Đoạn trục tốc độ của lần tra trước */
+static Intp_CacheType TorqueControl_ThrottleCache;                       /**< Đoạn trục bàn đạp ga của lần tra trước */
+static Intp_CacheType TorqueControl_LoadCache;                           /**< Đoạn trục tải trọng của lần tra trước */
+
+static float TorqueControl_ActuateTarget = MIN_TORQUE;                   /**< Lệnh mô-men đang được tiến tới (task 1 ms) */
+static float TorqueControl_ActuateStep = 0.0f;                           /**< Bước thay đổi mỗi chu kỳ 1 ms (Nm) */
+static float TorqueControl_Applied = MIN_TORQUE;                         /**< Mô-men đã gửi tới động cơ (Nm) */
+
+static uint8_t TorqueControl_SensorValid[IOHWAB_NUM_ANALOG_SENSORS] = { 1U, 1U, 1U, 1U };  /**< Trạng thái đã báo (task 100 ms) */
+static uint8_t TorqueControl_TrackingCount = 0U;                         /**< Số chu kỳ liên tiếp bám sai (task 100 ms) */
+static uint8_t TorqueControl_TrackingFault = 0U;                         /**< 1 khi đã báo lỗi bám mô-men */
+
+/******************************************************************************
+ * @brief   Tên cảm biến dùng trong log, theo ID cảm biến
+ ******************************************************************************/
+static const char* const TorqueControl_SensorName[IOHWAB_NUM_ANALOG_SENSORS] = {
+    [IOHWAB_SENSOR_THROTTLE] = "bàn đạp ga",
+    [IOHWAB_SENSOR_SPEED]    = "tốc độ",
+    [IOHWAB_SENSOR_LOAD]     = "tải trọng",
+    [IOHWAB_SENSOR_TORQUE]   = "mô-men xoắn thực tế"
+};
+
+/******************************************************************************
+ * @brief   API báo sự kiện chẩn đoán của từng cảm biến, theo ID cảm biến
+ ******************************************************************************/
+static Std_ReturnType (*const TorqueControl_SensorEvent[IOHWAB_NUM_ANALOG_SENSORS])(Dem_EventStatusType) = {
+    [IOHWAB_SENSOR_THROTTLE] = Rte_Call_Event_ThrottleSensor_SetEventStatus,
+    [IOHWAB_SENSOR_SPEED]    = Rte_Call_Event_SpeedSensor_SetEventStatus,
+    [IOHWAB_SENSOR_LOAD]     = Rte_Call_Event_LoadSensor_SetEventStatus,
+    [IOHWAB_SENSOR_TORQUE]   = Rte_Call_Event_TorqueSensor_SetEventStatus
+};
+
+/******************************************************************************
+ * @brief   Hàm báo cáo cảm biến đang dùng giá trị thay thế
+ *
+ * @details Dựa vào trạng thái và tuổi của mẫu để phân biệt trường hợp chưa có dữ
+ *          liệu với mẫu quá cũ, sau đó log giá trị thay thế đang được dùng.
+ *
+ * @param   SensorId - ID của cảm biến
+ * @param   Sample - Mẫu đọc qua RTE
+ * @return  void
+ ******************************************************************************/
+static void TorqueControl_ReportSubstitute(IoHwAb_SensorIdType SensorId, const IoHwAb_SensorSampleType* Sample) {
+    const char* name = TorqueControl_SensorName[SensorId];
+    if (Sample->Status == IOHWAB_SENSOR_STATUS_STALE) {
+        DLT_LOG_WARN(DLT_MSG_TC_SENSOR_STALE, DLT_STR(name), DLT_U32(Sample->AgeMs), DLT_F32(Sample->Value));
+    } else {
+        DLT_LOG_WARN(DLT_MSG_TC_SENSOR_NO_DATA, DLT_STR(name), DLT_F32(Sample->Value));
+    }
+}
+
+/******************************************************************************
+ * @brief   Hàm dựng bảng tra từ một bộ hiệu chuẩn
+ *
+ * @param   Tables - Bảng tra cần dựng
+ * @param   Calibration - Bộ hiệu chuẩn chứa điểm chia và giá trị, phải tồn tại lâu
+ *                        hơn bảng tra
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu điểm chia của
+ *                           một trục không tăng dần nghiêm ngặt
+ ******************************************************************************/
+static Std_ReturnType TorqueControl_InitTables(TorqueControl_TablesType* Tables,
+                                               const NvM_TorqueCalibrationType* Calibration) {
+    Tables->DemandMap.AxisX = (Intp_AxisF32Type){ Calibration->TorqueMapSpeed, Tables->SpeedInvDelta,
+                                                  NVM_TORQUE_MAP_SPEED_POINTS };
+    Tables->DemandMap.AxisY = (Intp_AxisF32Type){ Calibration->TorqueMapThrottle, Tables->ThrottleInvDelta,
+                                                  NVM_TORQUE_MAP_THROTTLE_POINTS };
+    Tables->DemandMap.Values = &Calibration->TorqueMap[0][0];
+    Tables->LoadCurve.Axis = (Intp_AxisF32Type){ Calibration->LoadCurveWeight, Tables->LoadInvDelta,
+                                                 NVM_LOAD_CURVE_POINTS };
+    Tables->LoadCurve.Values = Calibration->LoadCurveOffset;
+
+    if (Intp_InitMapF32(&Tables->DemandMap) != E_OK || Intp_InitCurveF32(&Tables->LoadCurve) != E_OK) {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm nạp bộ hiệu chuẩn Torque Control từ NvM
+ *
+ * @details Mô-men xoắn tối đa được giới hạn trong khoảng an toàn. Bảng tra được
+ *          kiểm tra trên bản sao trước khi áp dụng. Hệ số của vòng kín được áp dụng
+ *          cho bộ điều khiển PI mà không xóa tích phân, nên nạp lại khi đang chạy
+ *          không làm lệnh mô-men bị giật. Khi đọc lỗi, bảng tra hoặc hệ số không hợp
+ *          lệ, bộ hiệu chuẩn đang dùng được giữ nguyên.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu nạp thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static Std_ReturnType TorqueControl_LoadCalibration(void) {
+    NvM_TorqueCalibrationType calibration;
+    TorqueControl_TablesType tables;
+
+    if (Rte_Read_RpCalibration_TorqueCalibration(&calibration) != E_OK) {
+        DLT_LOG_ERROR(DLT_MSG_TC_CALIBRATION_FAILED);
+        return E_NOT_OK;
+    }
+    if (calibration.MaxTorque > MAX_TORQUE || calibration.MaxTorque < MIN_TORQUE) {
+        calibration.MaxTorque = MAX_TORQUE;
+    }
+    if (TorqueControl_InitTables(&tables, &calibration) != E_OK) {
+        DLT_LOG_ERROR(DLT_MSG_TC_TORQUE_MAP_INVALID);
+        return E_NOT_OK;
+    }
+
+    Pid_ConfigType pidConfig = {
+        .Kp = calibration.TorqueKp,
+        .Ki = calibration.TorqueKi,
+        .Kd = 0.0f,
+        .SampleTime = (float)RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS / 1000.0f,
+        .OutputMin = MIN_TORQUE,
+        .OutputMax = calibration.MaxTorque,
+        .RateLimit = calibration.TorqueRateLimit
+    };
+    if (Pid_Configure(&TorqueControl_Pid, &pidConfig) != E_OK) {
+        DLT_LOG_ERROR(DLT_MSG_TC_CALIBRATION_INVALID);
+        return E_NOT_OK;
+    }
+
+    TorqueControl_Calibration = calibration;
+    (void)TorqueControl_InitTables(&TorqueControl_Tables, &TorqueControl_Calibration);  // Đã kiểm tra trên bản sao
+    TorqueControl_CalibrationLoaded = 1U;
+    DLT_LOG_INFO(DLT_MSG_TC_CALIBRATION_LOADED, DLT_F32(TorqueControl_Calibration.MaxTorque),
+                 DLT_F32(TorqueControl_Calibration.TorqueKp), DLT_F32(TorqueControl_Calibration.TorqueKi),
+                 DLT_F32(TorqueControl_Calibration.TorqueRateLimit));
+    return E_OK;
+}
 
 /******************************************************************************
  * @brief   Hàm khởi tạo hệ thống điều khiển mô-men xoắn
@@ -25,7 +197,9 @@
  * @details Khởi tạo các cảm biến và bộ điều khiển cần thiết cho hệ thống điều
  *          khiển mô-men xoắn, bao gồm cảm biến bàn đạp ga, tốc độ, tải trọng,
  *          mô-men xoắn và bộ điều khiển động cơ. Báo lỗi nếu quá trình khởi tạo
- *          bất kỳ thành phần nào không thành công.
+ *          bất kỳ thành phần nào không thành công. Hiệu chuẩn không hợp lệ không
+ *          dừng quá trình khởi tạo: mô-men yêu cầu giữ bằng 0 đến khi
+ *          `TorqueControl_ReloadCalibration` nạp được hiệu chuẩn.
  *
  * @param   void
  * @return  void
@@ -33,132 +207,224 @@
 void TorqueControl_Init(void) {
     Std_ReturnType status;
 
-    printf("Khởi tạo hệ thống Torque Control...\n");
+    DLT_LOG_INFO(DLT_MSG_TC_INIT);
 
-    // Khởi tạo cảm biến bàn đạp ga
-    status = Rte_Call_RpThrottleSensor_Init();
-    if (status == E_OK) {
-        printf("Cảm biến bàn đạp ga đã khởi tạo thành công.\n");
-    } else {
-        printf("Lỗi khi khởi tạo cảm biến bàn đạp ga.\n");
-        return;
-    }
+    // Gắn bộ đệm tĩnh cho arena tạm dùng trong mỗi chu kỳ cập nhật
+    Mem_ArenaInit(&TorqueControl_Arena, TorqueControl_ScratchBuffer, sizeof(TorqueControl_ScratchBuffer));
 
-    // Khởi tạo cảm biến tốc độ
-    status = Rte_Call_RpSpeedSensor_Init();
-    if (status == E_OK) {
-        printf("Cảm biến tốc độ đã khởi tạo thành công.\n");
-    } else {
-        printf("Lỗi khi khởi tạo cảm biến tốc độ.\n");
-        return;
+    // Đọc bộ hiệu chuẩn từ NvM và cấu hình vòng kín, lệnh mô-men bắt đầu từ 0. Khi hiệu
+    // chuẩn lỗi, các runnable vẫn chạy với mô-men yêu cầu bằng 0 và cảm biến, động cơ vẫn
+    // được khởi tạo để lần nạp lại hiệu chuẩn sau đó (qua chẩn đoán) đưa ECU về hoạt động
+    Pid_Reset(&TorqueControl_Pid, MIN_TORQUE);
+    if (TorqueControl_LoadCalibration() != E_OK) {
+        DLT_LOG_WARN(DLT_MSG_TC_UNCALIBRATED);
     }
 
-    // Khởi tạo cảm biến tải trọng
-    status = Rte_Call_RpLoadSensor_Init();
+    // Khởi tạo các cảm biến bàn đạp ga, tốc độ, tải trọng và mô-men xoắn thực tế
+    status = Rte_Call_RpAnalogSensors_Init();
     if (status == E_OK) {
-        printf("Cảm biến tải trọng đã khởi tạo thành công.\n");
+        DLT_LOG_INFO(DLT_MSG_TC_SENSORS_INIT_OK);
     } else {
-        printf("Lỗi khi khởi tạo cảm biến tải trọng.\n");
-        return;
-    }
-
-    // Khởi tạo cảm biến mô-men xoắn thực tế
-    status = Rte_Call_RpTorqueSensor_Init();
-    if (status == E_OK) {
-        printf("Cảm biến mô-men xoắn thực tế đã khởi tạo thành công.\n");
-    } else {
-        printf("Lỗi khi khởi tạo cảm biến mô-men xoắn.\n");
+        DLT_LOG_ERROR(DLT_MSG_TC_SENSORS_INIT_FAILED);
         return;
     }
 
     // Khởi tạo bộ điều khiển mô-men xoắn
     status = Rte_Call_PpMotorDriver_Init();
     if (status == E_OK) {
-        printf("Bộ điều khiển mô-men xoắn đã khởi tạo thành công.\n");
+        DLT_LOG_INFO(DLT_MSG_TC_MOTOR_INIT_OK);
     } else {
-        printf("Lỗi khi khởi tạo bộ điều khiển mô-men xoắn.\n");
+        DLT_LOG_ERROR(DLT_MSG_TC_MOTOR_INIT_FAILED);
         return;
     }
 
-    printf("Hệ thống Torque Control đã sẵn sàng.\n");
+    DLT_LOG_INFO(DLT_MSG_TC_READY);
 }
 
 /******************************************************************************
- * @brief   Hàm cập nhật hệ thống điều khiển mô-men xoắn
+ * @brief   Runnable phân xử mô-men và vòng kín (10 ms)
+ *
+ * @details Đọc bàn đạp ga và tốc độ xe từ bản sao implicit của task (giá trị thay
+ *          thế khi mẫu không hợp lệ, việc báo lỗi do runnable 100 ms đảm nhận) và
+ *          tải trọng từ biến nội bộ do runnable 100 ms cập nhật. Mô-men xoắn yêu cầu
+ *          được nội suy song tuyến trên bản đồ hiệu chuẩn theo tốc độ và bàn đạp ga,
+ *          cộng phần bù nội suy trên đường cong tải trọng; mỗi trục giữ cache đoạn
+ *          của lần tra trước nên đầu vào thay đổi chậm không phải tìm lại.
+ *          Mô-men yêu cầu là giá trị đặt và feed-forward của một bước PI với chu kỳ
+ *          cố định RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS; giá trị đo là mô-men xoắn
+ *          thực tế.
+ *          Lệnh được giới hạn trong [MIN_TORQUE, mô-men tối đa hiệu chuẩn] và theo
+ *          tốc độ thay đổi hiệu chuẩn, rồi được runnable 1 ms gửi tới động cơ.
  *
- * @details Đọc các giá trị từ cảm biến bao gồm bàn đạp ga, tốc độ xe và tải trọng. 
- *          Tính toán mô-men xoắn yêu cầu dựa trên các giá trị này và gửi tới bộ 
- *          điều khiển động cơ. Cuối cùng, đọc mô-men xoắn thực tế từ cảm biến để 
- *          so sánh và điều chỉnh nếu cần thiết.
+ *          Khi cảm biến mô-men xoắn không hợp lệ, sai số được coi là 0: tích phân
+ *          được giữ nguyên và lệnh chỉ theo feed-forward cho tới khi có lại phản hồi.
+ *          Dữ liệu tạm của chu kỳ được cấp phát từ arena và giải phóng ở cuối hàm.
  *
  * @param   void
  * @return  void
  ******************************************************************************/
-void TorqueControl_Update(void) {
-    float throttle_input = 0.0f;
-    float current_speed = 0.0f;
-    float load_weight = 0.0f;
-    float actual_torque = 0.0f;
-    float desired_torque = 0.0f;
-
-    // Đọc dữ liệu từ cảm biến bàn đạp ga
-    if (Rte_Read_RpThrottleSensor_ThrottlePosition(&throttle_input) == E_OK) {
-        printf("Giá trị bàn đạp ga: %.2f%%\n", throttle_input * 100);
-    } else {
-        printf("Lỗi khi đọc cảm biến bàn đạp ga!\n");
-    }
+void TorqueControl_Arbitrate(void) {
+    Mem_ArenaBegin(&TorqueControl_Arena);
 
-    // Đọc dữ liệu từ cảm biến tốc độ
-    if (Rte_Read_RpSpeedSensor_Speed(&current_speed) == E_OK) {
-        printf("Tốc độ xe hiện tại: %.2f km/h\n", current_speed);
-    } else {
-        printf("Lỗi khi đọc cảm biến tốc độ!\n");
+    TorqueControl_CycleDataType* cycle = Mem_ArenaAlloc(&TorqueControl_Arena, sizeof(TorqueControl_CycleDataType));
+    if (cycle == NULL) {
+        DLT_LOG_ERROR(DLT_MSG_TC_NO_SCRATCH);
+        Mem_ArenaReset(&TorqueControl_Arena);
+        return;
     }
 
-    // Đọc dữ liệu từ cảm biến tải trọng
-    if (Rte_Read_RpLoadSensor_LoadWeight(&load_weight) == E_OK) {
-        printf("Tải trọng hiện tại: %.2f kg\n", load_weight);
-    } else {
-        printf("Lỗi khi đọc cảm biến tải trọng!\n");
+    // Giá trị thay thế được ghi vào khi mẫu không hợp lệ
+    (void)Rte_Read_RpThrottleSensor_ThrottlePosition(&cycle->throttle_input);
+    (void)Rte_Read_RpSpeedSensor_Speed(&cycle->current_speed);
+    cycle->load_weight = Rte_IrvRead_TorqueControl_Arbitrate_LoadWeight();
+    DLT_LOG_VERBOSE(DLT_MSG_TC_THROTTLE, DLT_F32(cycle->throttle_input * 100));
+    DLT_LOG_VERBOSE(DLT_MSG_TC_SPEED, DLT_F32(cycle->current_speed));
+
+    // Tính toán mô-men xoắn yêu cầu: bản đồ tốc độ × bàn đạp ga cộng phần bù theo tải trọng
+    cycle->desired_torque = MIN_TORQUE;
+    if (TorqueControl_CalibrationLoaded) {
+        cycle->desired_torque = Intp_MapF32(&TorqueControl_Tables.DemandMap, &TorqueControl_SpeedCache,
+                                            &TorqueControl_ThrottleCache, cycle->current_speed, cycle->throttle_input)
+                              + Intp_CurveF32(&TorqueControl_Tables.LoadCurve, &TorqueControl_LoadCache,
+                                              cycle->load_weight);
     }
 
-    // Tính toán mô-men xoắn yêu cầu
-    desired_torque = throttle_input * MAX_TORQUE;
-    if (current_speed > 50.0f) {
-        desired_torque *= 0.8f;  // Giảm mô-men xoắn nếu tốc độ cao
+    // Giới hạn mô-men xoắn trong phạm vi an toàn (bao gồm cả giá trị NaN từ hiệu chuẩn sai)
+    if (cycle->desired_torque > TorqueControl_Calibration.MaxTorque) {
+        cycle->desired_torque = TorqueControl_Calibration.MaxTorque;
+    } else if (!(cycle->desired_torque >= MIN_TORQUE)) {
+        cycle->desired_torque = MIN_TORQUE;
     }
-    if (load_weight > 500.0f) {
-        desired_torque += 10.0f;  // Tăng mô-men xoắn nếu tải trọng lớn
+    Rte_IrvWrite_TorqueControl_Arbitrate_TorqueDemand(cycle->desired_torque);
+
+    // Một bước vòng kín; mất phản hồi thì sai số bằng 0
+    if (Rte_Read_RpTorqueSensor_ActualTorque(&cycle->actual_torque) != E_OK) {
+        cycle->actual_torque = cycle->desired_torque;
     }
+    cycle->command = Pid_Step(&TorqueControl_Pid, cycle->desired_torque, cycle->actual_torque, cycle->desired_torque);
+    Rte_IrvWrite_TorqueControl_Arbitrate_TorqueCommand(cycle->command);
+
+    DLT_LOG_DEBUG(DLT_MSG_TC_CONTROL_STEP, DLT_F32(cycle->desired_torque), DLT_F32(cycle->actual_torque),
+                  DLT_F32(cycle->command));
+
+    // Giải phóng toàn bộ dữ liệu tạm của chu kỳ
+    Mem_ArenaReset(&TorqueControl_Arena);
+}
 
-    // Giới hạn mô-men xoắn trong phạm vi an toàn
-    if (desired_torque > MAX_TORQUE) {
-        desired_torque = MAX_TORQUE;
-    } else if (desired_torque < MIN_TORQUE) {
-        desired_torque = MIN_TORQUE;
+/******************************************************************************
+ * @brief   Runnable chấp hành mô-men (1 ms)
+ *
+ * @details Khi runnable 10 ms đưa ra lệnh mới, lệnh được chia đều thành
+ *          RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS / RTE_TORQUECONTROL_ACTUATE_PERIOD_MS
+ *          bước, nên mô-men gửi tới động cơ thay đổi theo đường dốc thay vì nhảy bậc
+ *          mỗi 10 ms. Chỉ ghi tới động cơ khi giá trị thay đổi.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_Actuate(void) {
+    const float stepsPerCommand = (float)RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS / (float)RTE_TORQUECONTROL_ACTUATE_PERIOD_MS;
+    float target = Rte_IrvRead_TorqueControl_Actuate_TorqueCommand();
+
+    if (target != TorqueControl_ActuateTarget) {
+        TorqueControl_ActuateTarget = target;
+        TorqueControl_ActuateStep = (target - TorqueControl_Applied) / stepsPerCommand;
+    }
+    if (TorqueControl_Applied == TorqueControl_ActuateTarget) {
+        return;
     }
 
-    // In ra mô-men xoắn yêu cầu
-    printf("Mô-men xoắn yêu cầu: %.2f Nm\n", desired_torque);
+    float applied = TorqueControl_Applied + TorqueControl_ActuateStep;
+    if ((TorqueControl_ActuateStep > 0.0f && applied > TorqueControl_ActuateTarget) ||
+        (TorqueControl_ActuateStep < 0.0f && applied < TorqueControl_ActuateTarget) ||
+        TorqueControl_ActuateStep == 0.0f) {
+        applied = TorqueControl_ActuateTarget;
+    }
 
-    // Ghi mô-men xoắn yêu cầu tới bộ điều khiển động cơ
-    if (Rte_Write_PpMotorDriver_SetTorque(desired_torque) == E_OK) {
-        printf("Đã gửi mô-men xoắn yêu cầu tới động cơ.\n");
+    // Ghi lệnh mô-men xoắn tới bộ điều khiển động cơ
+    if (Rte_Write_PpMotorDriver_SetTorque(applied) == E_OK) {
+        TorqueControl_Applied = applied;
+        DLT_LOG_VERBOSE(DLT_MSG_TC_TORQUE_SENT);
     } else {
-        printf("Lỗi khi gửi mô-men xoắn tới động cơ!\n");
+        DLT_LOG_ERROR(DLT_MSG_TC_TORQUE_SEND_FAILED);
     }
+}
 
-    // Đọc mô-men xoắn thực tế để so sánh với mô-men xoắn yêu cầu
-    if (Rte_Read_RpTorqueSensor_ActualTorque(&actual_torque) == E_OK) {
-        printf("Mô-men xoắn thực tế: %.2f Nm\n", actual_torque);
-    } else {
-        printf("Lỗi khi đọc mô-men xoắn thực tế!\n");
+/******************************************************************************
+ * @brief   Runnable cập nhật tải trọng và giám sát (100 ms)
+ *
+ * @details - Log và báo sự kiện chẩn đoán một lần khi một cảm biến chuyển sang giá
+ *            trị thay thế và khi hoạt động trở lại.
+ *          - Công bố tải trọng (giá trị thay thế khi không hợp lệ) cho runnable 10 ms;
+ *            tải trọng thay đổi chậm nên không cần đọc ở chu kỳ 10 ms.
+ *          - Kiểm tra độ bám: khi mô-men xoắn thực tế lệch khỏi lệnh quá
+ *            TORQUE_CONTROL_TRACKING_TOLERANCE trong TORQUE_CONTROL_TRACKING_DEBOUNCE
+ *            chu kỳ liên tiếp thì báo lỗi một lần (sự kiện chẩn đoán), rồi báo khi
+ *            bám trở lại.
+ *          - Log trạng thái của vòng điều khiển.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_Monitor(void) {
+    IoHwAb_SensorSampleType sample = { 0 };
+
+    for (uint8_t i = 0; i < IOHWAB_NUM_ANALOG_SENSORS; i++) {
+        uint8_t valid = (Rte_Read_RpAnalogSensors_Sample((IoHwAb_SensorIdType)i, &sample) == E_OK) ? 1U : 0U;
+        if (valid == TorqueControl_SensorValid[i]) {
+            continue;
+        }
+        TorqueControl_SensorValid[i] = valid;
+        if (valid) {
+            DLT_LOG_INFO(DLT_MSG_TC_SENSOR_RESTORED, DLT_STR(TorqueControl_SensorName[i]));
+            (void)TorqueControl_SensorEvent[i](DEM_EVENT_STATUS_PASSED);
+        } else {
+            TorqueControl_ReportSubstitute((IoHwAb_SensorIdType)i, &sample);
+            (void)TorqueControl_SensorEvent[i](DEM_EVENT_STATUS_FAILED);
+        }
     }
 
-    // So sánh và điều chỉnh nếu có sự sai lệch giữa mô-men xoắn thực tế và yêu cầu
-    if (actual_torque < desired_torque) {
-        printf("Tăng mô-men xoắn để đạt mức yêu cầu.\n");
-    } else if (actual_torque > desired_torque) {
-        printf("Giảm mô-men xoắn để đạt mức yêu cầu.\n");
+    float loadWeight = 0.0f;
+    (void)Rte_Read_RpLoadSensor_LoadWeight(&loadWeight);
+    Rte_IrvWrite_TorqueControl_Monitor_LoadWeight(loadWeight);
+
+    float demand = Rte_IrvRead_TorqueControl_Monitor_TorqueDemand();
+    float command = Rte_IrvRead_TorqueControl_Monitor_TorqueCommand();
+    float actualTorque = command;
+    if (Rte_Read_RpTorqueSensor_ActualTorque(&actualTorque) == E_OK) {
+        float error = (actualTorque > command) ? (actualTorque - command) : (command - actualTorque);
+        if (error <= TORQUE_CONTROL_TRACKING_TOLERANCE) {
+            TorqueControl_TrackingCount = 0U;
+            if (TorqueControl_TrackingFault) {
+                TorqueControl_TrackingFault = 0U;
+                DLT_LOG_INFO(DLT_MSG_TC_TRACKING_RECOVERED);
+                (void)Rte_Call_Event_TorqueTracking_SetEventStatus(DEM_EVENT_STATUS_PASSED);
+            }
+        } else if (TorqueControl_TrackingCount < TORQUE_CONTROL_TRACKING_DEBOUNCE) {
+            TorqueControl_TrackingCount++;
+            if (TorqueControl_TrackingCount == TORQUE_CONTROL_TRACKING_DEBOUNCE && !TorqueControl_TrackingFault) {
+                TorqueControl_TrackingFault = 1U;
+                DLT_LOG_WARN(DLT_MSG_TC_TRACKING_FAULT, DLT_F32(command), DLT_F32(actualTorque));
+                (void)Rte_Call_Event_TorqueTracking_SetEventStatus(DEM_EVENT_STATUS_FAILED);
+            }
+        }
     }
+
+    DLT_LOG_INFO(DLT_MSG_TC_STATUS, DLT_F32(demand), DLT_F32(command), DLT_F32(actualTorque), DLT_F32(loadWeight));
+}
+
+/******************************************************************************
+ * @brief   Runnable nạp lại hiệu chuẩn Torque Control
+ *
+ * @details Được RTE gọi trên task 10 ms khi có yêu cầu nạp lại hiệu chuẩn
+ *          (operation-invoked event), ví dụ sau khi bộ hiệu chuẩn được ghi qua
+ *          `Rte_Write_PpCalibration_TorqueCalibration`. Vì chạy cùng task với
+ *          `TorqueControl_Arbitrate`, bộ hiệu chuẩn và trạng thái PI không đổi trong
+ *          một lần chạy của runnable này.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_ReloadCalibration(void) {
+    (void)TorqueControl_LoadCalibration();
 }
@@ -3,7 +3,7 @@
  * @brief   Header file cho hệ thống điều khiển mô-men xoắn
  *
  * @details Định nghĩa các hằng số và khai báo các hàm chính cho hệ thống điều
- *          khiển mô-men xoắn, bao gồm hàm khởi tạo và hàm cập nhật.
+ *          khiển mô-men xoắn, bao gồm hàm khởi tạo và các runnable 1 ms, 10 ms, 100 ms.
  *          Giới hạn mô-men xoắn tối đa và tối thiểu cũng được xác định tại đây.
  *
  * @version 1.0
@@ -18,14 +18,32 @@
 /******************************************************************************
  * @brief   Định nghĩa các giá trị giới hạn cho mô-men xoắn
  *
- * @details MAX_TORQUE và MIN_TORQUE là các giá trị giới hạn mô-men xoắn mà hệ
- *          thống điều khiển mô-men xoắn có thể đạt được. MAX_TORQUE giới hạn 
- *          mô-men xoắn yêu cầu ở mức tối đa để đảm bảo an toàn, trong khi 
- *          MIN_TORQUE đặt giới hạn tối thiểu.
+ * @details MAX_TORQUE và MIN_TORQUE là giới hạn an toàn tuyệt đối của mô-men xoắn
+ *          yêu cầu. Mô-men xoắn tối đa thực tế được lấy từ bộ hiệu chuẩn trong NvM
+ *          và luôn bị giới hạn trong khoảng này, kể cả khi dữ liệu hiệu chuẩn sai.
  ******************************************************************************/
 #define MAX_TORQUE 100.0f  /**< Giá trị mô-men xoắn tối đa */
 #define MIN_TORQUE 0.0f    /**< Giá trị mô-men xoắn tối thiểu */
 
+/******************************************************************************
+ * @brief   Ngưỡng giám sát độ bám của mô-men xoắn
+ *
+ * @details Lỗi bám được báo khi mô-men xoắn thực tế lệch khỏi lệnh quá
+ *          TORQUE_CONTROL_TRACKING_TOLERANCE trong TORQUE_CONTROL_TRACKING_DEBOUNCE
+ *          chu kỳ giám sát (RTE_TORQUECONTROL_MONITOR_PERIOD_MS) liên tiếp.
+ ******************************************************************************/
+#define TORQUE_CONTROL_TRACKING_TOLERANCE 20.0f  /**< Sai lệch cho phép (Nm) */
+#define TORQUE_CONTROL_TRACKING_DEBOUNCE  5U     /**< Số chu kỳ liên tiếp trước khi báo lỗi */
+
+/******************************************************************************
+ * @brief   Kích thước arena tạm cho một chu kỳ cập nhật
+ *
+ * @details Dữ liệu tạm của TorqueControl_Arbitrate (ảnh chụp giá trị cảm biến, kết
+ *          quả tính toán) được cấp phát từ arena này và giải phóng toàn bộ ở cuối
+ *          mỗi chu kỳ. Giá trị có thể được điều chỉnh theo high-water mark đo được.
+ ******************************************************************************/
+#define TORQUE_CONTROL_SCRATCH_SIZE 256U  /**< Dung lượng arena (byte) */
+
 /******************************************************************************
  * @brief   Hàm khởi tạo hệ thống điều khiển mô-men xoắn
  *
@@ -38,15 +56,50 @@
 void TorqueControl_Init(void);
 
 /******************************************************************************
- * @brief   Hàm cập nhật hệ thống điều khiển mô-men xoắn
+ * @brief   Runnable chấp hành mô-men xoắn (1 ms)
+ *
+ * @details Gửi lệnh mô-men xoắn của runnable 10 ms tới bộ điều khiển động cơ,
+ *          chia mỗi lần thay đổi lệnh thành các bước đều theo chu kỳ 1 ms.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_Actuate(void);
+
+/******************************************************************************
+ * @brief   Runnable phân xử mô-men xoắn và vòng kín (10 ms)
+ *
+ * @details Tra mô-men xoắn yêu cầu trên bản đồ hiệu chuẩn theo tốc độ và bàn đạp ga,
+ *          cộng phần bù theo tải trọng, sau đó một
+ *          bước của bộ điều khiển PI theo mô-men xoắn thực tế (feed-forward cộng đầu
+ *          ra PI, có chống bão hòa tích phân và giới hạn tốc độ thay đổi) tạo lệnh
+ *          mô-men xoắn cho runnable 1 ms.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_Arbitrate(void);
+
+/******************************************************************************
+ * @brief   Runnable cập nhật tải trọng và giám sát (100 ms)
+ *
+ * @details Cập nhật tải trọng cho runnable 10 ms, báo cảm biến dùng giá trị thay
+ *          thế và kiểm tra độ bám giữa lệnh và mô-men xoắn thực tế.
+ *
+ * @param   void
+ * @return  void
+ ******************************************************************************/
+void TorqueControl_Monitor(void);
+
+/******************************************************************************
+ * @brief   Runnable nạp lại hiệu chuẩn Torque Control
  *
- * @details Hàm này cập nhật mô-men xoắn yêu cầu dựa trên các giá trị đọc được từ
- *          cảm biến, sau đó gửi mô-men xoắn yêu cầu tới động cơ và điều chỉnh nếu 
- *          cần thiết.
+ * @details Đọc lại bộ hiệu chuẩn từ NvM khi RTE nhận yêu cầu nạp lại hiệu chuẩn.
+ *          Chạy trên cùng task với `TorqueControl_Arbitrate`.
  *
  * @param   void
  * @return  void
  ******************************************************************************/
-void TorqueControl_Update(void);
+void TorqueControl_ReloadCalibration(void);
 
 #endif // TORQUE_CONTROL_H
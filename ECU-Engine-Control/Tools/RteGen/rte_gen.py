@@ -0,0 +1,613 @@
+#!/usr/bin/env python3
+"""Sinh RTE cho một SWC từ file mô tả JSON (hoặc YAML nếu có PyYAML).
+
+Đầu ra:
+  Rte_<Swc>.h      - API truy cập dữ liệu dạng static inline, khai báo phần tử dữ
+                     liệu, bảng cấu hình và các hàm RTE viết tay
+  Rte_<Swc>_Cfg.c  - Định nghĩa phần tử dữ liệu và bảng cấu hình const
+
+Các phần tử trong file mô tả:
+  defines           - hằng số cấu hình
+  valueType         - kiểu giá trị vật lý (float hoặc dấu phẩy tĩnh)
+  records           - bản ghi implicit của các runnable (giá trị, thời điểm, tuổi, trạng thái);
+                      perTask: mỗi task có một bản sao riêng (_Thread_local)
+  lastValues        - giá trị mới nhất cho DataServices, có thể gắn với một phần tử bản ghi
+  implicitReceivers - Rte_Read_<Port>_<Element>: đọc một phần tử của bản ghi implicit
+  sampleReaders     - Rte_Read_<Port>_<Element>: đọc mẫu đầy đủ theo ID
+  senders           - Rte_Write_<Port>_<Element>: chuyển tiếp tới hàm BSW và lưu giá trị mới nhất
+  nvBlocks          - Rte_Read/Rte_Write_Rp/Pp<Port>_<Element>: đọc/ghi block NvM,
+                      có thể gọi một operation sau khi ghi thành công (onWrite)
+  dataServices      - Rte_Call_DataServices_<Name>_ReadData cho DCM, đọc một giá trị mới
+                      nhất (source) hoặc một biến trao đổi giữa các runnable (irv)
+  diagnosticEvents  - Rte_Call_Event_<Name>_SetEventStatus: báo kết quả kiểm tra của SWC
+                      tới DEM (ID sự kiện là mã DTC 3 byte)
+  interRunnableVariables
+                    - Rte_IrvWrite/Rte_IrvRead_<Runnable>_<Name>: biến trao đổi giữa các
+                      runnable của SWC chạy trên các task khác nhau (explicit, atomic)
+  configTables      - bảng cấu hình const
+  events            - sự kiện RTE kích hoạt runnable trên task của SWC (timing,
+                      dataReceived, operationInvoked); operationInvoked sinh thêm
+                      Rte_Call_<Port>_<Operation> phía client. Timing event do task
+                      tự thực hiện theo mốc thời gian nên không có mặt nạ sự kiện
+  operations        - nguyên mẫu các hàm RTE viết tay (khởi tạo, runnable)
+
+Mỗi API truy cập dữ liệu được gán một ID trace VFB (RTE_TRACE_ID_*) và gọi
+RTE_TRACE_HOOK; hook chỉ sinh mã khi biên dịch với RTE_VFB_TRACE == STD_ON
+(xem RTE/Rte_Trace.h). Bảng tên API theo ID được sinh trong Rte_<Swc>_Cfg.c.
+
+Cách dùng:
+  python3 Tools/RteGen/rte_gen.py RTE/Config/TorqueControl.json -o RTE
+"""
+
+import argparse
+import json
+import os
+import sys
+
+BANNER = "/" + "*" * 78
+BANNER_END = " " + "*" * 78 + "/"
+
+
+def load_description(path):
+    with open(path, encoding="utf-8") as f:
+        if path.endswith((".yaml", ".yml")):
+            try:
+                import yaml
+            except ImportError:
+                sys.exit("rte_gen: cần PyYAML để đọc file YAML, hoặc dùng JSON")
+            return yaml.safe_load(f)
+        return json.load(f)
+
+
+def as_lines(text):
+    if text is None:
+        return []
+    if isinstance(text, str):
+        return [text]
+    return list(text)
+
+
+def doc(brief, details=None, params=None, returns=None):
+    """Sinh chú thích dạng banner như các file viết tay của dự án."""
+    out = [BANNER, f" * @brief   {brief}"]
+    details = as_lines(details)
+    if details:
+        out.append(" *")
+        out.append(f" * @details {details[0]}")
+        out.extend(f" *          {line}" for line in details[1:])
+    if params is not None or returns is not None:
+        out.append(" *")
+        if params == "void":
+            out.append(" * @param   void")
+        for name, text in (params if params != "void" else []) or []:
+            out.append(f" * @param   {name} - {text}")
+        if returns is not None:
+            for i, line in enumerate(as_lines(returns)):
+                prefix = " * @return  " if i == 0 else " *          "
+                out.append(prefix + line)
+    out.append(BANNER_END)
+    return out
+
+
+RET_STATUS = ["Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu mẫu quá cũ",
+              "hoặc chưa có dữ liệu (giá trị đầu ra là giá trị thay thế)"]
+
+
+class Generator:
+    def __init__(self, desc):
+        self.d = desc
+        self.swc = desc["swc"]
+        self.switch = desc.get("fixedPointSwitch")
+        self.vt = desc["valueType"]
+        self.records = {r["name"]: r for r in desc.get("records", [])}
+        self.trace_apis = self.collect_trace_apis()
+
+    # Danh sách API được trace, theo thứ tự ID
+    def collect_trace_apis(self):
+        d = self.d
+        # (tên API, định dạng giá trị: RTE_TRACE_VALUE_FORMAT cho giá trị vật lý,
+        #  RTE_TRACE_FORMAT_FLOAT cho biến float, RTE_TRACE_FORMAT_RAW cho trạng thái/số nguyên)
+        physical, raw, flt = "RTE_TRACE_VALUE_FORMAT", "RTE_TRACE_FORMAT_RAW", "RTE_TRACE_FORMAT_FLOAT"
+        apis = [(f"Rte_Call_{e['port']}_{e['operation']}", raw)
+                for e in d.get("events", []) if e["kind"] == "operationInvoked"]
+        apis += [(f"Rte_Read_{r['port']}_{r['element']}", physical) for r in d.get("implicitReceivers", [])]
+        apis += [(f"Rte_Read_{r['port']}_{r['element']}", physical) for r in d.get("sampleReaders", [])]
+        apis += [(f"Rte_Write_{s['port']}_{s['element']}", physical) for s in d.get("senders", [])]
+        for n in d.get("nvBlocks", []):
+            apis += [(f"Rte_Read_Rp{n['port']}_{n['element']}", raw),
+                     (f"Rte_Write_Pp{n['port']}_{n['element']}", raw)]
+        apis += [(f"Rte_Call_DataServices_{ds['name']}_ReadData", flt if ds.get("irv") else physical)
+                 for ds in d.get("dataServices", [])]
+        for v in d.get("interRunnableVariables", []):
+            apis += [(self.irv_api("Write", v["writer"], v), flt)]
+            apis += [(self.irv_api("Read", r, v), flt) for r in v["readers"]]
+        apis += [(self.event_status_api(ev), raw) for ev in d.get("diagnosticEvents", [])]
+        return apis
+
+    @staticmethod
+    def trace_id(api):
+        return "RTE_TRACE_ID_" + api[len("Rte_"):].upper()
+
+    def trace_count(self):
+        return f"RTE_{self.swc.upper()}_TRACE_NUM_APIS"
+
+    # Tên biến bản sao implicit của một bản ghi: theo SWC nếu mỗi task có bản sao riêng,
+    # theo runnable nếu chỉ có một runnable dùng bản ghi
+    def record_var(self, name):
+        r = self.records[name]
+        return f"Rte_{self.swc}_{name}" if r.get("perTask") else f"Rte_{r['runnables'][0]}_{name}"
+
+    def record_storage(self, name):
+        return "_Thread_local " if self.records[name].get("perTask") else ""
+
+    @staticmethod
+    def irv_api(kind, runnable, v):
+        return f"Rte_Irv{kind}_{runnable}_{v['name']}"
+
+    def irv_var(self, v):
+        return f"Rte_Irv_{self.swc}_{v['name']}"
+
+    @staticmethod
+    def event_status_api(ev):
+        return f"Rte_Call_Event_{ev['name']}_SetEventStatus"
+
+    def dem_event_id(self, ev):
+        return f"RTE_DEM_EVENT_{self.swc.upper()}_{ev['name'].upper()}"
+
+    def record_type(self, name):
+        return f"Rte_{name}DataType"
+
+    def fixed_if(self):
+        return f"#if ({self.switch} == STD_ON)"
+
+    # ---------------------------------------------------------------- header
+    def header(self, json_name):
+        guard = f"RTE_{self.swc.upper()}_H"
+        o = []
+        o += [BANNER,
+              f" * @file    Rte_{self.swc}.h",
+              f" * @brief   {self.d['brief']}",
+              " *"]
+        details = as_lines(self.d.get("details"))
+        if details:
+            o.append(f" * @details {details[0]}")
+            o += [f" *          {line}" for line in details[1:]]
+            o.append(" *")
+        o += [f" *          File được sinh bởi Tools/RteGen/rte_gen.py từ {json_name},",
+              " *          không sửa trực tiếp.",
+              " *",
+              " * @version 1.0",
+              " * @date    2024-10-25",
+              " * @author",
+              " *          HALA Academy",
+              " *          Tong Xuan Hoang",
+              BANNER_END, "",
+              f"#ifndef {guard}", f"#define {guard}", ""]
+        if self.d.get("interRunnableVariables"):
+            o.append("#include <stdatomic.h>")
+        for inc in self.d.get("includes", []):
+            line = f'#include "{inc["file"]}"'
+            if inc.get("comment"):
+                line = f"{line:<32} // {inc['comment']}"
+            o.append(line)
+        o.append("")
+
+        for d in self.d.get("defines", []):
+            o += doc(d["brief"], d.get("details"))
+            o += [f"#define {d['name']} {d['value']}", ""]
+
+        o += self.value_type()
+        o += self.trace_ids()
+        for r in self.records.values():
+            o += self.record(r)
+        o += self.last_values_decl()
+        o += self.config_tables_decl()
+        o += self.events_decl()
+        for v in self.d.get("interRunnableVariables", []):
+            o += self.inter_runnable_variable(v)
+        for op in self.d.get("operations", []):
+            o += self.operation(op)
+        for r in self.d.get("implicitReceivers", []):
+            o += self.implicit_receiver(r)
+        for r in self.d.get("sampleReaders", []):
+            o += self.sample_reader(r)
+        for s in self.d.get("senders", []):
+            o += self.sender(s)
+        for n in self.d.get("nvBlocks", []):
+            o += self.nv_block(n)
+        for ds in self.d.get("dataServices", []):
+            o += self.data_service(ds)
+        o += self.diagnostic_events()
+        o += [f"#endif // {guard}", ""]
+        return "\n".join(o)
+
+    def value_type(self):
+        vt = self.vt
+        o = doc(vt["brief"], vt.get("details"))
+        o += [self.fixed_if(),
+              f"typedef {vt['fixed']} {vt['name']};",
+              f"#define {vt['toFloat']}(v)      {vt['fixedToFloat']}(v)",
+              f"#define {vt['fromFloat']}(f)    {vt['fixedFromFloat']}(f)",
+              "#define RTE_PHYSICAL_TO_TRACE(v)      ((uint32_t)(v))",
+              "#define RTE_TRACE_VALUE_FORMAT        RTE_TRACE_FORMAT_Q16_16",
+              "#else",
+              f"typedef {vt['float']} {vt['name']};",
+              f"#define {vt['toFloat']}(v)      (v)",
+              f"#define {vt['fromFloat']}(f)    (f)",
+              "#define RTE_PHYSICAL_TO_TRACE(v)      Rte_Trace_FloatBits(v)",
+              "#define RTE_TRACE_VALUE_FORMAT        RTE_TRACE_FORMAT_FLOAT",
+              "#endif", ""]
+        return o
+
+    def trace_ids(self):
+        o = doc("ID trace VFB của các API RTE",
+                ["Giá trị của bản ghi là giá trị vật lý đọc/ghi (định dạng",
+                 "RTE_TRACE_VALUE_FORMAT), hoặc trạng thái trả về với API NvM."])
+        width = max(len(self.trace_id(api)) for api, _ in self.trace_apis) + 1
+        for i, (api, _) in enumerate(self.trace_apis):
+            o.append(f"#define {self.trace_id(api):<{width}}{i}U")
+        o += [f"#define {self.trace_count():<{width}}{len(self.trace_apis)}U", ""]
+        o += [f"#if (RTE_VFB_TRACE == STD_ON)",
+              f"extern const char* const Rte_{self.swc}_TraceApiName[{self.trace_count()}];  /**< Tên API theo ID */",
+              f"extern const uint8_t Rte_{self.swc}_TraceApiFormat[{self.trace_count()}];    /**< Định dạng giá trị theo ID */",
+              "#endif", ""]
+        return o
+
+    def record(self, r):
+        n = r["count"]
+        o = doc(r["brief"], r.get("details"))
+        o += ["typedef struct {",
+              f"    {self.vt['name']} Value[{n}];     /**< Giá trị đã lọc hoặc giá trị thay thế */",
+              f"    uint32_t TimestampMs[{n}];            /**< Thời điểm chuyển đổi (ms) */",
+              f"    uint32_t AgeMs[{n}];                  /**< Tuổi của mẫu lúc sao chép vào runnable (ms) */",
+              f"    {r['statusType']} Status[{n}];  /**< Trạng thái của mẫu */",
+              f"}} {self.record_type(r['name'])};", ""]
+        runnables = ", ".join(r["runnables"])
+        if r.get("perTask"):
+            o += doc(f"Bản sao implicit của {r['name']} theo task ({runnables})",
+                     ["Mỗi task có một bản sao riêng (_Thread_local), chỉ được ghi khi runnable",
+                      "của task đó bắt đầu (copy-in); các API `Rte_Read_*` đọc bản sao của task",
+                      "đang gọi. Các runnable trên cùng một task dùng chung bản sao."])
+        else:
+            o += doc(f"Bản sao implicit của {r['name']} cho runnable {runnables}",
+                     ["Chỉ được ghi khi runnable bắt đầu (copy-in); các API `Rte_Read_*` đọc",
+                      "trực tiếp bản sao này."])
+        o += [f"extern {self.record_storage(r['name'])}{self.record_type(r['name'])} {self.record_var(r['name'])};", ""]
+        return o
+
+    def last_values_decl(self):
+        lv = self.d.get("lastValues", [])
+        if not lv:
+            return []
+        o = doc("Giá trị mới nhất của các phần tử dữ liệu đi qua RTE",
+                ["Nguồn dữ liệu cho các DataServices mà DCM đọc từ task khác. Giá trị cảm",
+                 "biến được cập nhật khi copy-in với mẫu hợp lệ (chỉ từ một task), giá trị",
+                 "ghi được cập nhật khi ghi thành công."])
+        o += [f"extern volatile {self.vt['name']} {v['name']};" for v in lv]
+        o.append("")
+        for rec in self.records:
+            if any(v.get("record") == rec for v in lv):
+                o += [f"extern volatile {self.vt['name']}* const Rte_{rec}_LastValue[{self.records[rec]['count']}];", ""]
+        return o
+
+    def config_tables_decl(self):
+        o = []
+        for t in self.d.get("configTables", []):
+            o += doc(t["brief"], t.get("details"))
+            o += [f"extern const {t['type']} {t['name']};", ""]
+        return o
+
+    def event_object(self):
+        return f"Rte_{self.swc}_Event"
+
+    def event_mask(self, e):
+        return f"RTE_EV_{self.swc.upper()}_{e['name']}"
+
+    # Sự kiện được đặt qua đối tượng sự kiện (mọi loại trừ timing)
+    def signalled_events(self):
+        return [e for e in self.d.get("events", []) if e["kind"] != "timing"]
+
+    def events_decl(self):
+        events = self.signalled_events()
+        if not events:
+            return []
+        o = doc(f"Đối tượng sự kiện của task {self.swc}",
+                ["Producer, timer và client đặt sự kiện; task của SWC chờ trên đối tượng này",
+                 "và gọi runnable tương ứng. Được khởi tạo trong `Rte_Start`."])
+        o += [f"extern Os_EventType {self.event_object()};", ""]
+        o += doc(f"Mặt nạ các sự kiện RTE của {self.swc}",
+                 ["Timing event không có mặt nạ: task chờ tới mốc thời gian tuyệt đối của chu kỳ."])
+        lines = [f"#define {self.event_mask(e)} ((Os_EventMaskType)0x{1 << i:02X}U)" for i, e in enumerate(events)]
+        width = max(len(line) for line in lines) + 2
+        for line, e in zip(lines, events):
+            o.append(f"{line:<{width}}/**< {e['kind']}: {e['runnable']} - {e['what']} */")
+        o.append("")
+        for e in events:
+            if e["kind"] == "operationInvoked":
+                o += self.operation_client(e)
+        return o
+
+    def inter_runnable_variable(self, v):
+        var = self.irv_var(v)
+        o = doc(f"Biến trao đổi giữa các runnable: {v['what']}",
+                [f"Ghi bởi `{v['writer']}`, đọc bởi " + ", ".join(f"`{r}`" for r in v["readers"]) + ".",
+                 "Các runnable chạy trên các task khác nhau; mỗi lần đọc/ghi là một thao tác",
+                 "atomic trên giá trị mới nhất (explicit), không có thứ tự giữa các biến."])
+        o += [f"extern _Atomic {v['type']} {var};", ""]
+        api = self.irv_api("Write", v["writer"], v)
+        o += doc(f"API ghi {v['what']} từ runnable {v['writer']}", None,
+                 [(v["name"], "Giá trị mới")], "void")
+        o += [f"static inline void {api}({v['type']} {v['name']}) {{",
+              f"    RTE_TRACE_HOOK({self.trace_id(api)}, Rte_Trace_FloatBits({v['name']}));",
+              f"    atomic_store_explicit(&{var}, {v['name']}, memory_order_relaxed);",
+              "}", ""]
+        for r in v["readers"]:
+            api = self.irv_api("Read", r, v)
+            o += doc(f"API đọc {v['what']} từ runnable {r}", None, "void",
+                     f"{v['type']} - Giá trị mới nhất")
+            o += [f"static inline {v['type']} {api}(void) {{",
+                  f"    {v['type']} value = atomic_load_explicit(&{var}, memory_order_relaxed);",
+                  f"    RTE_TRACE_HOOK({self.trace_id(api)}, Rte_Trace_FloatBits(value));",
+                  "    return value;",
+                  "}", ""]
+        return o
+
+    def operation_client(self, e):
+        o = doc(f"API yêu cầu {e['what']}",
+                [f"Đặt sự kiện operation-invoked để task của {self.swc} chạy runnable",
+                 f"`{e['runnable']}`, sau đó trả về ngay mà không chờ runnable chạy xong."],
+                "void", "Std_ReturnType - Trả về E_OK khi yêu cầu đã được ghi nhận")
+        api = f"Rte_Call_{e['port']}_{e['operation']}"
+        o += [f"static inline Std_ReturnType {api}(void) {{",
+              f"    RTE_TRACE_HOOK({self.trace_id(api)}, 0U);",
+              f"    Os_SetEvent(&{self.event_object()}, {self.event_mask(e)});",
+              "    return E_OK;",
+              "}", ""]
+        return o
+
+    def operation(self, op):
+        ret = op.get("return", "Std_ReturnType")
+        o = doc(op["brief"], op.get("details"), "void", op["returns"])
+        o += [f"{ret} {op['name']}(void);", ""]
+        return o
+
+    def implicit_receiver(self, r):
+        rec = self.record_var(r["record"])
+        name = f"Rte_Read_{r['port']}_{r['element']}"
+        p = r["element"]
+        o = doc(f"API đọc {r['what']}",
+                ["Đọc từ bản sao implicit được tạo khi runnable bắt đầu, không truy cập",
+                 "IoHwAb hay ADC."],
+                [(p, f"Con trỏ lưu trữ giá trị {r['what']}")], RET_STATUS)
+        hook = f"    RTE_TRACE_HOOK({self.trace_id(name)}, RTE_PHYSICAL_TO_TRACE({rec}.Value[{r['index']}]));"
+        o += [f"static inline Std_ReturnType {name}(float* {p}) {{",
+              f"    *{p} = {self.vt['toFloat']}({rec}.Value[{r['index']}]);",
+              hook,
+              f"    return ({rec}.Status[{r['index']}] == {self.records[r['record']]['validStatus']}) ? E_OK : E_NOT_OK;",
+              "}", ""]
+        if r.get("fixedType"):
+            conv = r.get("fixedConvert")
+            val = f"{rec}.Value[{r['index']}]"
+            val = f"{conv}({val})" if conv else val
+            o += [self.fixed_if()]
+            o += doc(f"API đọc {r['what']} dạng dấu phẩy tĩnh", None,
+                     [(p, f"Con trỏ lưu trữ {r['what']} dạng {r['fixedUnit']}")], RET_STATUS)
+            o += [f"static inline Std_ReturnType {name}Fixed({r['fixedType']}* {p}) {{",
+                  f"    *{p} = {val};",
+                  hook,
+                  f"    return ({rec}.Status[{r['index']}] == {self.records[r['record']]['validStatus']}) ? E_OK : E_NOT_OK;",
+                  "}", "#endif", ""]
+        return o
+
+    def sample_reader(self, r):
+        rec = self.record_var(r["record"])
+        count = self.records[r["record"]]["count"]
+        o = doc("API đọc mẫu kèm thời điểm và trạng thái",
+                ["Trả về giá trị, thời điểm chuyển đổi, tuổi (tính khi runnable bắt đầu)",
+                 "và trạng thái của mẫu. Mẫu quá tuổi tối đa mang giá trị thay thế."],
+                [("SensorId", "ID của cảm biến"), ("Sample", "Con trỏ lưu trữ mẫu")],
+                ["Std_ReturnType - Trả về E_OK nếu mẫu hợp lệ, E_NOT_OK nếu ID không hợp lệ",
+                 "hoặc mẫu đã được thay thế"])
+        api = f"Rte_Read_{r['port']}_{r['element']}"
+        o += [f"static inline Std_ReturnType {api}({r['idType']} SensorId, {r['sampleType']}* Sample) {{",
+              f"    if ((uint32_t)SensorId >= {count}) {{",
+              "        return E_NOT_OK;",
+              "    }",
+              f"    Sample->Value = {self.vt['toFloat']}({rec}.Value[SensorId]);",
+              f"    Sample->TimestampMs = {rec}.TimestampMs[SensorId];",
+              f"    Sample->AgeMs = {rec}.AgeMs[SensorId];",
+              f"    Sample->Status = {rec}.Status[SensorId];",
+              f"    RTE_TRACE_HOOK({self.trace_id(api)}, RTE_PHYSICAL_TO_TRACE({rec}.Value[SensorId]));",
+              f"    return (Sample->Status == {self.records[r['record']]['validStatus']}) ? E_OK : E_NOT_OK;",
+              "}", ""]
+        return o
+
+    def sender(self, s):
+        name = f"Rte_Write_{s['port']}_{s['element']}"
+        p = s["param"]
+        ret = "Std_ReturnType - Trả về E_OK nếu ghi thành công, E_NOT_OK nếu có lỗi"
+        o = doc(f"API ghi {s['what']}", [f"Chuyển tiếp tới `{s['function']}` và lưu giá trị mới nhất."],
+                [(p, "Giá trị cần ghi")], ret)
+        o += [f"static inline Std_ReturnType {name}(float {p}) {{",
+              f"    RTE_TRACE_HOOK({self.trace_id(name)}, RTE_PHYSICAL_TO_TRACE({self.vt['fromFloat']}({p})));",
+              f"    Std_ReturnType status = {s['function']}({p});",
+              "    if (status == E_OK) {",
+              f"        {s['lastValue']} = {self.vt['fromFloat']}({p});",
+              "    }",
+              "    return status;",
+              "}", ""]
+        if s.get("fixedFunction"):
+            o += [self.fixed_if()]
+            o += doc(f"API ghi {s['what']} dạng dấu phẩy tĩnh", None,
+                     [(p, f"Giá trị cần ghi dạng {s['fixedUnit']}")], ret)
+            o += [f"static inline Std_ReturnType {name}Fixed({s['fixedType']} {p}) {{",
+                  f"    RTE_TRACE_HOOK({self.trace_id(name)}, RTE_PHYSICAL_TO_TRACE({p}));",
+                  f"    Std_ReturnType status = {s['fixedFunction']}({p});",
+                  "    if (status == E_OK) {",
+                  f"        {s['lastValue']} = {p};",
+                  "    }",
+                  "    return status;",
+                  "}", "#endif", ""]
+        return o
+
+    def nv_block(self, n):
+        o = doc(f"API đọc block NvM {n['element']}", n.get("readDetails"),
+                [(n["element"], "Con trỏ lưu trữ dữ liệu")],
+                "Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu có lỗi")
+        api = f"Rte_Read_Rp{n['port']}_{n['element']}"
+        o += [f"static inline Std_ReturnType {api}({n['type']}* {n['element']}) {{",
+              f"    Std_ReturnType status = NvM_ReadBlock({n['block']}, {n['element']});",
+              f"    RTE_TRACE_HOOK({self.trace_id(api)}, status);",
+              "    return status;",
+              "}", ""]
+        o += doc(f"API ghi block NvM {n['element']}", n.get("writeDetails"),
+                 [(n["element"], "Con trỏ tới dữ liệu mới")],
+                 "Std_ReturnType - Trả về E_OK nếu yêu cầu được chấp nhận, E_NOT_OK nếu có lỗi")
+        api = f"Rte_Write_Pp{n['port']}_{n['element']}"
+        o += [f"static inline Std_ReturnType {api}(const {n['type']}* {n['element']}) {{",
+              f"    Std_ReturnType status = NvM_WriteBlock({n['block']}, {n['element']});",
+              f"    RTE_TRACE_HOOK({self.trace_id(api)}, status);"]
+        if n.get("onWrite"):
+            o += ["    if (status == E_OK) {",
+                  f"        (void){n['onWrite']}();",
+                  "    }"]
+        o += ["    return status;", "}", ""]
+        return o
+
+    def data_service(self, ds):
+        if ds.get("irv"):
+            details = [f"Trả về giá trị mới nhất của biến trao đổi `{ds['irv']}` giữa các runnable,",
+                       "không truy cập phần cứng. Dùng cho dịch vụ ReadDataByIdentifier."]
+        else:
+            details = ["Trả về giá trị được lưu lần cuối khi dữ liệu đi qua RTE, không truy cập",
+                       "phần cứng. Dùng cho dịch vụ ReadDataByIdentifier."]
+        o = doc(f"DataServices: đọc giá trị {ds['what']} mới nhất cho DCM", details,
+                [("Data", f"Con trỏ lưu trữ giá trị {ds['what']} ({ds['unit']})")],
+                "Std_ReturnType - Trả về E_OK nếu đọc thành công, E_NOT_OK nếu con trỏ NULL")
+        api = f"Rte_Call_DataServices_{ds['name']}_ReadData"
+        o += [f"static inline Std_ReturnType {api}(float* Data) {{",
+              "    if (Data == NULL) {",
+              "        return E_NOT_OK;",
+              "    }"]
+        if ds.get("irv"):
+            o += [f"    float value = atomic_load_explicit(&{self.irv_var({'name': ds['irv']})}, memory_order_relaxed);",
+                  "    *Data = value;",
+                  f"    RTE_TRACE_HOOK({self.trace_id(api)}, Rte_Trace_FloatBits(value));"]
+        else:
+            o += [f"    {self.vt['name']} value = {ds['source']};",
+                  f"    *Data = {self.vt['toFloat']}(value);",
+                  f"    RTE_TRACE_HOOK({self.trace_id(api)}, RTE_PHYSICAL_TO_TRACE(value));"]
+        o += ["    return E_OK;",
+              "}", ""]
+        return o
+
+    def diagnostic_events(self):
+        events = self.d.get("diagnosticEvents", [])
+        if not events:
+            return []
+        o = doc(f"ID sự kiện chẩn đoán của {self.swc}",
+                ["ID là mã DTC 3 byte mà DEM lưu và DCM báo qua ReadDTCInformation."])
+        width = max(len(self.dem_event_id(ev)) for ev in events) + 1
+        for ev in events:
+            o.append(f"#define {self.dem_event_id(ev):<{width}}{ev['eventId']}UL  /**< {ev['description']} */")
+        o.append("")
+        for ev in events:
+            api = self.event_status_api(ev)
+            o += doc(f"API báo kết quả kiểm tra: {ev['what']}",
+                     ["DEM_EVENT_STATUS_FAILED ghi sự kiện vào bộ nhớ lỗi của DEM,",
+                      "DEM_EVENT_STATUS_PASSED xóa trạng thái lỗi hiện tại (DTC vẫn được lưu).",
+                      "Chỉ nên gọi khi kết quả thay đổi."],
+                     [("EventStatus", "Kết quả kiểm tra (DEM_EVENT_STATUS_PASSED/FAILED)")],
+                     "Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu trạng thái không hợp lệ")
+            o += [f"static inline Std_ReturnType {api}(Dem_EventStatusType EventStatus) {{",
+                  f"    RTE_TRACE_HOOK({self.trace_id(api)}, EventStatus);",
+                  "    if (EventStatus == DEM_EVENT_STATUS_FAILED) {",
+                  f"        Dem_ReportErrorStatus((int){self.dem_event_id(ev)}, \"{ev['description']}\");",
+                  "    } else if (EventStatus == DEM_EVENT_STATUS_PASSED) {",
+                  f"        Dem_ClearErrorStatus((int){self.dem_event_id(ev)});",
+                  "    } else {",
+                  "        return E_NOT_OK;",
+                  "    }",
+                  "    return E_OK;",
+                  "}", ""]
+        return o
+
+    # ---------------------------------------------------------------- source
+    def source(self, json_name):
+        o = [BANNER,
+             f" * @file    Rte_{self.swc}_Cfg.c",
+             f" * @brief   Phần tử dữ liệu và bảng cấu hình RTE của {self.swc}",
+             " *",
+             f" * @details File được sinh bởi Tools/RteGen/rte_gen.py từ {json_name},",
+             " *          không sửa trực tiếp.",
+             " *",
+             " * @version 1.0",
+             " * @date    2024-10-25",
+             " * @author",
+             " *          HALA Academy",
+             " *          Tong Xuan Hoang",
+             BANNER_END, "",
+             f'#include "Rte_{self.swc}.h"', ""]
+        for r in self.records.values():
+            o += [f"{self.record_storage(r['name'])}{self.record_type(r['name'])} {self.record_var(r['name'])};", ""]
+        for v in self.d.get("interRunnableVariables", []):
+            o.append(f"_Atomic {v['type']} {self.irv_var(v)} = {v['init']};")
+        if self.d.get("interRunnableVariables"):
+            o.append("")
+        if self.signalled_events():
+            o += [f"Os_EventType {self.event_object()};", ""]
+        lv = self.d.get("lastValues", [])
+        for v in lv:
+            o.append(f"volatile {self.vt['name']} {v['name']} = 0;")
+        if lv:
+            o.append("")
+        for rec in self.records:
+            entries = [v for v in lv if v.get("record") == rec]
+            if entries:
+                o.append(f"volatile {self.vt['name']}* const Rte_{rec}_LastValue[{self.records[rec]['count']}] = {{")
+                o += [f"    [{v['index']}] = &{v['name']}," for v in entries]
+                o += ["};", ""]
+        o += ["#if (RTE_VFB_TRACE == STD_ON)",
+              f"const char* const Rte_{self.swc}_TraceApiName[{self.trace_count()}] = {{"]
+        o += [f'    [{self.trace_id(api)}] = "{api}",' for api, _ in self.trace_apis]
+        o += ["};", "",
+              f"const uint8_t Rte_{self.swc}_TraceApiFormat[{self.trace_count()}] = {{"]
+        o += [f"    [{self.trace_id(api)}] = {value_format}," for api, value_format in self.trace_apis]
+        o += ["};", "#endif", ""]
+        for t in self.d.get("configTables", []):
+            o.append(f"const {t['type']} {t['name']} = {{")
+            fields = t["fields"]
+            for i, f in enumerate(fields):
+                sep = "," if i < len(fields) - 1 else ""
+                line = f"    .{f['name']} = {f['value']}{sep}"
+                if f.get("comment"):
+                    line = f"{line:<40}// {f['comment']}"
+                o.append(line)
+            o += ["};", ""]
+        return "\n".join(o)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Sinh Rte_<Swc>.h và Rte_<Swc>_Cfg.c từ file mô tả SWC")
+    ap.add_argument("description", help="File mô tả SWC (.json hoặc .yaml)")
+    ap.add_argument("-o", "--output", default=".", help="Thư mục đầu ra")
+    args = ap.parse_args()
+
+    desc = load_description(args.description)
+    gen = Generator(desc)
+    json_name = os.path.basename(args.description)
+
+    os.makedirs(args.output, exist_ok=True)
+    outputs = {
+        f"Rte_{gen.swc}.h": gen.header(json_name),
+        f"Rte_{gen.swc}_Cfg.c": gen.source(json_name),
+    }
+    for name, text in outputs.items():
+        path = os.path.join(args.output, name)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(text)
+        print(f"rte_gen: {path}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Giải mã file trace VFB nhị phân của RTE (Rte_Trace.bin).
+
+Mỗi dòng đầu ra: thời điểm (ms, tính từ bản ghi đầu tiên), task, tên API, giá trị.
+Các bản ghi được sắp xếp lại theo thời điểm vì mỗi task có bộ đệm riêng.
+
+Cách dùng:
+  python3 Tools/RteTrace/rte_trace_dump.py Rte_Trace.bin
+  python3 Tools/RteTrace/rte_trace_dump.py Rte_Trace.bin --api SetTorque --summary
+"""
+
+import argparse
+import collections
+import struct
+import sys
+
+RECORD = struct.Struct("<QIHH")
+DROPPED = 0xFFFF
+FORMAT_FLOAT = 0
+FORMAT_Q16_16 = 1
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 8 or data[:4] != b"RTET":
+        sys.exit(f"rte_trace_dump: {path} không phải file trace RTE")
+    version, count = data[4], struct.unpack_from("<H", data, 6)[0]
+    if version != 1:
+        sys.exit(f"rte_trace_dump: phiên bản {version} không được hỗ trợ")
+    pos = 8
+    apis = []
+    for _ in range(count):
+        value_format, length = data[pos], data[pos + 1]
+        apis.append((data[pos + 2:pos + 2 + length].decode("ascii", "replace"), value_format))
+        pos += 2 + length
+    usable = (len(data) - pos) // RECORD.size * RECORD.size
+    records = [RECORD.unpack_from(data, off) for off in range(pos, pos + usable, RECORD.size)]
+    return apis, records
+
+
+def decode_value(raw, value_format):
+    if value_format == FORMAT_Q16_16:
+        return f"{struct.unpack('<i', struct.pack('<I', raw))[0] / 65536.0:.4f}"
+    if value_format == FORMAT_FLOAT:
+        return f"{struct.unpack('<f', struct.pack('<I', raw))[0]:.4f}"
+    return str(raw)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Giải mã file trace VFB của RTE")
+    ap.add_argument("trace", help="File trace (Rte_Trace.bin)")
+    ap.add_argument("--api", help="Chỉ in các API có tên chứa chuỗi này")
+    ap.add_argument("--summary", action="store_true", help="In số lần gọi mỗi API thay vì từng bản ghi")
+    args = ap.parse_args()
+
+    apis, records = load(args.trace)
+    records.sort(key=lambda r: r[0])
+    start = records[0][0] if records else 0
+
+    calls = collections.Counter()
+    dropped = 0
+    for ts, raw, port, thread in records:
+        if port == DROPPED:
+            dropped += raw
+            name, value_format = "<dropped>", None
+        elif port < len(apis):
+            name, value_format = apis[port]
+        else:
+            name, value_format = f"<id {port}>", None
+        if args.api and args.api not in name:
+            continue
+        calls[name] += 1
+        if args.summary:
+            continue
+        print(f"{(ts - start) / 1e6:12.3f}  T{thread}  {name:<48} {decode_value(raw, value_format)}")
+
+    if args.summary:
+        for name, n in calls.most_common():
+            print(f"{n:10d}  {name}")
+    if dropped:
+        print(f"rte_trace_dump: {dropped} bản ghi bị bỏ do bộ đệm đầy", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
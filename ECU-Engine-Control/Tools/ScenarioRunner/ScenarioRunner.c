@@ -0,0 +1,570 @@
+/******************************************************************************
+ * @file    ScenarioRunner.c
+ * @brief   Bộ chạy kịch bản song song (Monte-Carlo) cho Torque Control
+ *
+ * @details Chạy mọi tổ hợp chu trình lái x bộ tham số x giá trị khởi đầu của nhiễu
+ *          trên tất cả các lõi CPU và tổng hợp sai lệch bám mô-men, tốc độ và DTC.
+ *
+ *          Ngữ cảnh ECU (SWC, RTE, IoHwAb, MCAL mô phỏng, NvM, DEM) là các biến toàn
+ *          cục của tiến trình, nên mỗi kịch bản chạy trong một tiến trình con riêng:
+ *          tiến trình cha khởi tạo ECU một lần, mỗi kịch bản được `fork` từ ảnh đã khởi
+ *          tạo đó (copy-on-write) và không ảnh hưởng tới kịch bản khác. Các task không
+ *          được tạo; runnable được gọi tuần tự theo thứ tự ưu tiên của task trong
+ *          `main.c` trên đồng hồ ảo của Os, nên kịch bản lặp lại được và chạy nhanh
+ *          hơn thời gian thực nhiều lần.
+ *
+ *          Mỗi worker (một tiến trình) có một hàng đợi chỉ số kịch bản trong vùng nhớ
+ *          dùng chung. Worker lấy kịch bản từ đầu hàng đợi của mình; khi hết, nó lấy
+ *          một nửa phần còn lại ở cuối hàng đợi của worker khác (work-stealing), nên
+ *          các kịch bản dài (Highway) không làm một lõi chạy một mình ở cuối đợt.
+ *
+ *          Biên dịch (từ thư mục ECU-Engine-Control):
+ *              gcc -O3 -std=gnu11 -IBSW -IBSW/MCAL -IBSW/Services -IBSW/ECU_Abstraction/IoHwAb
+ *                  -IRTE -ISWC $(find BSW RTE SWC Tools/ScenarioRunner -name "*.c"
+ *                  -not -name Mcal_Config.c) -o scenario_runner -lm -lpthread
+ *
+ *          Sử dụng:
+ *              scenario_runner [-j workers] [-s seeds] [-o results.csv]
+ *                  -j  Số worker (mặc định: số lõi CPU)
+ *                  -s  Số giá trị khởi đầu của nhiễu cho mỗi tổ hợp (mặc định 8)
+ *                  -o  Ghi kết quả của từng kịch bản ra file CSV
+ *          Trả về 0 khi mọi kịch bản chạy hết, 1 nếu có kịch bản lỗi.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "ScenarioRunner.h"
+#include "Os.h"
+#include "Dlt.h"
+#include "NvM.h"
+#include "Plant.h"
+#include "Torque_Control.h"
+#include "Rte_TorqueControl.h"
+#include "IoHwAb_MotorDriver.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#if (RTE_VFB_TRACE == STD_ON)
+#error "ScenarioRunner: mọi kịch bản sẽ ghi chung một file trace, biên dịch với RTE_VFB_TRACE=STD_OFF"
+#endif
+
+#if (ATOMIC_LLONG_LOCK_FREE != 2)
+#error "ScenarioRunner: hàng đợi dùng chung giữa các tiến trình cần atomic 64 bit không khóa"
+#endif
+
+/******************************************************************************
+ * @brief   Các hằng số của bộ chạy kịch bản
+ ******************************************************************************/
+#define SCENARIO_RUNNER_DEFAULT_SEEDS  8U
+#define SCENARIO_RUNNER_NS_PER_MS      1000000ULL
+#define SCENARIO_RUNNER_CACHE_LINE     64
+
+/******************************************************************************
+ * @brief   Dãy chỉ số kịch bản [đầu, cuối) nén trong một từ 64 bit
+ ******************************************************************************/
+#define SCENARIO_RUNNER_RANGE(Head, Tail) (((unsigned long long)(Head) << 32) | (unsigned long long)(Tail))
+#define SCENARIO_RUNNER_HEAD(Range)       ((uint32_t)((Range) >> 32))
+#define SCENARIO_RUNNER_TAIL(Range)       ((uint32_t)(Range))
+
+/******************************************************************************
+ * @brief   Hàng đợi kịch bản của một worker
+ *
+ * @details Chủ hàng đợi lấy ở đầu, worker khác lấy ở cuối; cả hai cập nhật bằng
+ *          compare-and-swap trên cùng một từ nên không cần khóa. Mỗi hàng đợi chiếm
+ *          riêng một cache line.
+ ******************************************************************************/
+typedef struct {
+    _Alignas(SCENARIO_RUNNER_CACHE_LINE) atomic_ullong Range;   /**< SCENARIO_RUNNER_RANGE(đầu, cuối) */
+} ScenarioRunner_QueueType;
+
+/******************************************************************************
+ * @brief   Trạng thái của đợt chạy
+ *
+ * @details Các hàng đợi và kết quả nằm trong vùng nhớ dùng chung, được ánh xạ trước
+ *          khi tạo worker nên có cùng địa chỉ trong mọi tiến trình.
+ ******************************************************************************/
+static ScenarioRunner_QueueType* ScenarioRunner_Queue = NULL;
+static ScenarioRunner_ResultType* ScenarioRunner_Result = NULL;
+static uint32_t ScenarioRunner_NumWorkers = 0U;
+static uint32_t ScenarioRunner_NumSeeds = SCENARIO_RUNNER_DEFAULT_SEEDS;
+static uint32_t ScenarioRunner_NumScenarios = 0U;
+
+/******************************************************************************
+ * @brief   Hàm nội bộ tách chỉ số kịch bản
+ *
+ * @details Chỉ số = (chu trình lái * số bộ tham số + bộ tham số) * số seed + seed.
+ *
+ * @param   Index - Chỉ số kịch bản
+ * @param   Cycle - Chỉ số chu trình lái
+ * @param   Param - Chỉ số bộ tham số
+ * @param   Seed - Chỉ số giá trị khởi đầu của nhiễu
+ * @return  void
+ ******************************************************************************/
+static void ScenarioRunner_Decode(uint32_t Index, uint32_t* Cycle, uint32_t* Param, uint32_t* Seed) {
+    *Seed = Index % ScenarioRunner_NumSeeds;
+    *Param = (Index / ScenarioRunner_NumSeeds) % ScenarioRunner_NumParameterSets;
+    *Cycle = Index / (ScenarioRunner_NumSeeds * ScenarioRunner_NumParameterSets);
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ tính giá trị khởi đầu của bộ sinh nhiễu cho một seed
+ *
+ * @details Seed 0 dùng giá trị của cấu hình mặc định (như ứng dụng ECU); các seed
+ *          khác được trộn bằng hằng số tỉ lệ vàng để các chuỗi nhiễu không tương quan.
+ *
+ * @param   Seed - Chỉ số giá trị khởi đầu của nhiễu
+ * @return  uint32_t - Giá trị khởi đầu, khác 0
+ ******************************************************************************/
+static uint32_t ScenarioRunner_NoiseSeed(uint32_t Seed) {
+    uint32_t value = Plant_Config.NoiseSeed ^ (Seed * 0x9E3779B9U);
+    return (value != 0U) ? value : 1U;
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ khởi tạo ảnh ECU dùng chung cho mọi kịch bản
+ *
+ * @details Giống phần khởi tạo của `main.c` nhưng không có flash: bộ hiệu chuẩn mặc
+ *          định (ROM) được nạp thẳng vào RAM mirror của NvM. Không tạo task nào.
+ *
+ * @param   void
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu có lỗi
+ ******************************************************************************/
+static Std_ReturnType ScenarioRunner_InitEcu(void) {
+    Dlt_Init();
+
+    if (NvM_RestoreBlockDefaults(NVM_BLOCK_TORQUE_CALIBRATION) != E_OK ||
+        NvM_RestoreBlockDefaults(NVM_BLOCK_SENSOR_CALIBRATION) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    Dem_Init();
+    if (Rte_Start() != E_OK) {
+        return E_NOT_OK;
+    }
+
+    // Gồm cả đo thời gian của vòng dòng điện, nên chạy trên đồng hồ thật
+    TorqueControl_Init();
+
+    // In log khởi tạo một lần; bộ đệm log của các kịch bản không được chuyển đi
+    Dlt_MainFunction();
+    return E_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ chạy một kịch bản trong tiến trình con
+ *
+ * @details Áp dụng bộ tham số qua NvM như khi ghi hiệu chuẩn qua RTE, khởi tạo mô
+ *          hình xe với chu trình lái và seed của kịch bản, rồi chạy đồng hồ ảo từng
+ *          mili giây: vòng dòng điện ở mọi chu kỳ PWM, các runnable theo chu kỳ và thứ
+ *          tự ưu tiên của task. Sai lệch bám là mô-men yêu cầu (IRV của Torque Control)
+ *          trừ mô-men thật của động cơ trong mô hình xe, lấy mẫu mỗi mili giây.
+ *
+ * @param   Index - Chỉ số kịch bản
+ * @param   Result - Kết quả của kịch bản (vùng nhớ dùng chung)
+ * @return  void
+ ******************************************************************************/
+static void ScenarioRunner_RunScenario(uint32_t Index, ScenarioRunner_ResultType* Result) {
+    uint32_t cycle, param, seed;
+    ScenarioRunner_Decode(Index, &cycle, &param, &seed);
+    const ScenarioRunner_DriveCycleType* driveCycle = &ScenarioRunner_DriveCycles[cycle];
+    const ScenarioRunner_ParameterSetType* parameterSet = &ScenarioRunner_ParameterSets[param];
+
+    // Bộ tham số: thay các hệ số vòng kín rồi nạp lại hiệu chuẩn
+    NvM_TorqueCalibrationType calibration;
+    if (NvM_ReadBlock(NVM_BLOCK_TORQUE_CALIBRATION, &calibration) != E_OK) {
+        Result->Status = SCENARIO_RUNNER_INIT_FAILED;
+        return;
+    }
+    calibration.TorqueKp = parameterSet->TorqueKp;
+    calibration.TorqueKi = parameterSet->TorqueKi;
+    calibration.TorqueRateLimit = parameterSet->TorqueRateLimit;
+    if (NvM_WriteBlock(NVM_BLOCK_TORQUE_CALIBRATION, &calibration) != E_OK) {
+        Result->Status = SCENARIO_RUNNER_INIT_FAILED;
+        return;
+    }
+    TorqueControl_ReloadCalibration();
+
+    // Mô hình xe: chu trình lái, tải trọng và chuỗi nhiễu của kịch bản
+    static Plant_ConfigType plantConfig;
+    plantConfig = Plant_Config;
+    plantConfig.DriverProfile = driveCycle->Throttle;
+    plantConfig.DriverPayload = driveCycle->Payload;
+    plantConfig.NoiseSeed = ScenarioRunner_NoiseSeed(seed);
+    if (Plant_Init(&plantConfig) != E_OK) {
+        Result->Status = SCENARIO_RUNNER_INIT_FAILED;
+        return;
+    }
+
+    const Intp_AxisF32Type* timeAxis = &driveCycle->Throttle->Axis;
+    const uint32_t durationMs = (uint32_t)(timeAxis->Points[timeAxis->Count - 1U] * 1000.0f + 0.5f);
+    const Plant_VehicleArrayType* vehicle = Plant_GetEcuVehicle();
+
+    double errorSquareSum = 0.0;
+    float errorMax = 0.0f;
+    float speedMax = 0.0f;
+    uint64_t tickNs = 0U;
+    uint32_t tickMs = 0U;
+
+    Os_StartVirtualClock(0U);
+    for (uint64_t nowNs = 0U; tickMs < durationMs; nowNs += IOHWAB_MOTOR_PWM_PERIOD_NS) {
+        Os_SetVirtualTimeNs(nowNs);
+        IoHwAb_MotorDriver_ControlStep();
+        if (nowNs < tickNs) {
+            continue;
+        }
+
+        // Chu kỳ PWM đầu tiên của mili giây: các task chu kỳ theo thứ tự ưu tiên
+        if (tickMs % PLANT_STEP_MS == 0U) {
+            Plant_MainFunction();
+        }
+        if (tickMs % RTE_TORQUECONTROL_ACTUATE_PERIOD_MS == 0U) {
+            TorqueControl_Actuate();
+        }
+        if (tickMs % RTE_SENSOR_ACQUISITION_PERIOD_MS == 0U) {
+            Rte_Run_AnalogSensors_Acquire();
+        }
+        if (tickMs % RTE_TORQUECONTROL_ARBITRATE_PERIOD_MS == 0U) {
+            Rte_Run_TorqueControl_Arbitrate();
+        }
+        if (tickMs % RTE_TORQUECONTROL_MONITOR_PERIOD_MS == 0U && tickMs != 0U) {
+            Rte_Run_TorqueControl_Monitor();   // Lần chạy đầu sau một chu kỳ, như task 100 ms
+        }
+
+        float demand = atomic_load_explicit(&Rte_Irv_TorqueControl_TorqueDemand, memory_order_relaxed);
+        float error = fabsf(demand - vehicle->MotorTorque[0]);
+        errorSquareSum += (double)error * (double)error;
+        errorMax = (error > errorMax) ? error : errorMax;
+        speedMax = (vehicle->Speed[0] > speedMax) ? vehicle->Speed[0] : speedMax;
+
+        tickMs++;
+        tickNs += SCENARIO_RUNNER_NS_PER_MS;
+    }
+
+    // DTC đã báo lỗi trong kịch bản (testFailedSinceLastClear), kể cả đã hết lỗi
+    uint32_t dtc[SCENARIO_RUNNER_MAX_DTCS];
+    uint8_t status[SCENARIO_RUNNER_MAX_DTCS];
+    int numDtcs = Dem_GetDtcSnapshot(dtc, status, SCENARIO_RUNNER_MAX_DTCS);
+    uint8_t dtcCount = 0U;
+    for (int i = 0; i < numDtcs; i++) {
+        if ((status[i] & DEM_UDS_STATUS_TFSLC) != 0U) {
+            Result->Dtc[dtcCount++] = dtc[i];
+        }
+    }
+
+    Result->DtcCount = dtcCount;
+    Result->TrackingRms = (durationMs > 0U) ? (float)sqrt(errorSquareSum / (double)durationMs) : 0.0f;
+    Result->TrackingMax = errorMax;
+    Result->MaxSpeed = speedMax * 3.6f;   // m/s -> km/h
+    Result->SimulatedS = (float)durationMs / 1000.0f;
+    Result->Status = SCENARIO_RUNNER_OK;   // Ghi cuối cùng: kịch bản dừng giữa chừng giữ NOT_RUN
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ lấy kịch bản tiếp theo cho một worker
+ *
+ * @details Lấy ở đầu hàng đợi của worker. Khi hàng đợi rỗng, lấy một nửa phần còn
+ *          lại ở cuối hàng đợi của worker khác: chạy kịch bản đầu tiên của phần lấy
+ *          được, phần còn lại thành hàng đợi mới của worker (chỉ chủ hàng đợi ghi vào
+ *          hàng đợi rỗng của mình).
+ *
+ * @param   WorkerId - Worker cần kịch bản
+ * @param   Index - Chỉ số kịch bản lấy được
+ * @return  Std_ReturnType - Trả về E_OK nếu lấy được, E_NOT_OK khi mọi hàng đợi đã rỗng
+ ******************************************************************************/
+static Std_ReturnType ScenarioRunner_Take(uint32_t WorkerId, uint32_t* Index) {
+    atomic_ullong* own = &ScenarioRunner_Queue[WorkerId].Range;
+    unsigned long long range = atomic_load(own);
+    while (SCENARIO_RUNNER_HEAD(range) < SCENARIO_RUNNER_TAIL(range)) {
+        uint32_t head = SCENARIO_RUNNER_HEAD(range);
+        if (atomic_compare_exchange_weak(own, &range, SCENARIO_RUNNER_RANGE(head + 1U, SCENARIO_RUNNER_TAIL(range)))) {
+            *Index = head;
+            return E_OK;
+        }
+    }
+
+    for (uint32_t i = 1U; i < ScenarioRunner_NumWorkers; i++) {
+        atomic_ullong* victim = &ScenarioRunner_Queue[(WorkerId + i) % ScenarioRunner_NumWorkers].Range;
+        range = atomic_load(victim);
+        while (SCENARIO_RUNNER_HEAD(range) < SCENARIO_RUNNER_TAIL(range)) {
+            uint32_t head = SCENARIO_RUNNER_HEAD(range);
+            uint32_t tail = SCENARIO_RUNNER_TAIL(range);
+            uint32_t count = (tail - head + 1U) / 2U;
+            if (atomic_compare_exchange_weak(victim, &range, SCENARIO_RUNNER_RANGE(head, tail - count))) {
+                atomic_store(own, SCENARIO_RUNNER_RANGE(tail - count + 1U, tail));
+                *Index = tail - count;
+                return E_OK;
+            }
+        }
+    }
+    return E_NOT_OK;
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ thân của một worker
+ *
+ * @details Mỗi kịch bản chạy trong một tiến trình con mới, tạo từ ảnh ECU đã khởi
+ *          tạo của worker (không bị kịch bản trước thay đổi). Tiến trình con bị dừng
+ *          sau SCENARIO_RUNNER_TIMEOUT_S giây; kịch bản dừng bất thường giữ trạng thái
+ *          NOT_RUN.
+ *
+ * @param   WorkerId - Chỉ số của worker
+ * @return  void
+ ******************************************************************************/
+static void ScenarioRunner_Worker(uint32_t WorkerId) {
+    uint32_t index;
+    while (ScenarioRunner_Take(WorkerId, &index) == E_OK) {
+        ScenarioRunner_ResultType* result = &ScenarioRunner_Result[index];
+        uint64_t startNs = Os_GetTimeNs();
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            alarm(SCENARIO_RUNNER_TIMEOUT_S);
+            ScenarioRunner_RunScenario(index, result);
+            _exit(0);
+        }
+        if (pid < 0) {
+            printf("Worker %u: cannot fork scenario %u.\n", (unsigned)WorkerId, (unsigned)index);
+        } else {
+            int status;
+            while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+            }
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                result->Status = SCENARIO_RUNNER_NOT_RUN;
+            }
+        }
+
+        result->WorkerId = (uint16_t)WorkerId;
+        result->RunTimeMs = (float)(Os_GetTimeNs() - startNs) / 1.0e6f;
+    }
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ in bảng tổng hợp
+ *
+ * @details Theo từng tổ hợp bộ tham số x chu trình lái (trung bình sai lệch RMS trên
+ *          các seed, sai lệch lớn nhất, số kịch bản có DTC), tổng hợp của từng bộ tham
+ *          số và số kịch bản ghi từng DTC.
+ *
+ * @param   void
+ * @return  uint32_t - Số kịch bản lỗi
+ ******************************************************************************/
+static uint32_t ScenarioRunner_Report(void) {
+    uint32_t failed = 0U;
+
+    printf("\n%-10s %-10s %5s %10s %10s %10s %6s\n",
+           "Params", "Cycle", "Runs", "RMS [Nm]", "Max [Nm]", "Speed", "DTC");
+    for (uint32_t p = 0; p < ScenarioRunner_NumParameterSets; p++) {
+        uint32_t setRuns = 0U, setDtcRuns = 0U;
+        double setRms = 0.0;
+        float setMax = 0.0f;
+
+        for (uint32_t c = 0; c < ScenarioRunner_NumDriveCycles; c++) {
+            uint32_t runs = 0U, dtcRuns = 0U;
+            double rms = 0.0;
+            float max = 0.0f, speed = 0.0f;
+
+            for (uint32_t s = 0; s < ScenarioRunner_NumSeeds; s++) {
+                const ScenarioRunner_ResultType* result =
+                    &ScenarioRunner_Result[(c * ScenarioRunner_NumParameterSets + p) * ScenarioRunner_NumSeeds + s];
+                if (result->Status != SCENARIO_RUNNER_OK) {
+                    failed++;
+                    continue;
+                }
+                runs++;
+                rms += result->TrackingRms;
+                max = (result->TrackingMax > max) ? result->TrackingMax : max;
+                speed = (result->MaxSpeed > speed) ? result->MaxSpeed : speed;
+                dtcRuns += (result->DtcCount != 0U) ? 1U : 0U;
+            }
+
+            printf("%-10s %-10s %5u %10.2f %10.2f %6.1f km/h %6u\n",
+                   ScenarioRunner_ParameterSets[p].Name, ScenarioRunner_DriveCycles[c].Name, (unsigned)runs,
+                   (runs != 0U) ? rms / runs : 0.0, max, speed, (unsigned)dtcRuns);
+            setRuns += runs;
+            setDtcRuns += dtcRuns;
+            setRms += rms;
+            setMax = (max > setMax) ? max : setMax;
+        }
+
+        printf("%-10s %-10s %5u %10.2f %10.2f %11s %6u\n\n",
+               ScenarioRunner_ParameterSets[p].Name, "(all)", (unsigned)setRuns,
+               (setRuns != 0U) ? setRms / setRuns : 0.0, setMax, "", (unsigned)setDtcRuns);
+    }
+
+    // Số kịch bản đã ghi từng DTC
+    uint32_t dtcCode[SCENARIO_RUNNER_MAX_DTCS];
+    uint32_t dtcRuns[SCENARIO_RUNNER_MAX_DTCS];
+    uint32_t numDtcs = 0U;
+    for (uint32_t i = 0; i < ScenarioRunner_NumScenarios; i++) {
+        const ScenarioRunner_ResultType* result = &ScenarioRunner_Result[i];
+        for (uint8_t d = 0; d < result->DtcCount; d++) {
+            uint32_t k = 0U;
+            while (k < numDtcs && dtcCode[k] != result->Dtc[d]) {
+                k++;
+            }
+            if (k == numDtcs) {
+                if (numDtcs == SCENARIO_RUNNER_MAX_DTCS) {
+                    continue;
+                }
+                dtcCode[numDtcs] = result->Dtc[d];
+                dtcRuns[numDtcs++] = 0U;
+            }
+            dtcRuns[k]++;
+        }
+    }
+    if (numDtcs == 0U) {
+        printf("No DTC recorded.\n");
+    }
+    for (uint32_t k = 0; k < numDtcs; k++) {
+        printf("DTC 0x%06lX: %u scenario(s)\n", (unsigned long)dtcCode[k], (unsigned)dtcRuns[k]);
+    }
+    return failed;
+}
+
+/******************************************************************************
+ * @brief   Hàm nội bộ ghi kết quả của từng kịch bản ra file CSV
+ *
+ * @param   Path - Đường dẫn file
+ * @return  Std_ReturnType - Trả về E_OK nếu thành công, E_NOT_OK nếu không ghi được
+ ******************************************************************************/
+static Std_ReturnType ScenarioRunner_WriteCsv(const char* Path) {
+    FILE* file = fopen(Path, "w");
+    if (file == NULL) {
+        return E_NOT_OK;
+    }
+
+    fprintf(file, "scenario,cycle,params,seed,status,tracking_rms_nm,tracking_max_nm,max_speed_kmh,"
+                  "simulated_s,dtc_count,dtcs,worker,run_time_ms\n");
+    for (uint32_t i = 0; i < ScenarioRunner_NumScenarios; i++) {
+        const ScenarioRunner_ResultType* result = &ScenarioRunner_Result[i];
+        uint32_t cycle, param, seed;
+        ScenarioRunner_Decode(i, &cycle, &param, &seed);
+
+        fprintf(file, "%u,%s,%s,%u,%u,%.4f,%.4f,%.2f,%.3f,%u,", (unsigned)i,
+                ScenarioRunner_DriveCycles[cycle].Name, ScenarioRunner_ParameterSets[param].Name,
+                (unsigned)seed, (unsigned)result->Status, result->TrackingRms, result->TrackingMax,
+                result->MaxSpeed, result->SimulatedS, (unsigned)result->DtcCount);
+        for (uint8_t d = 0; d < result->DtcCount; d++) {
+            fprintf(file, "%s0x%06lX", (d != 0U) ? " " : "", (unsigned long)result->Dtc[d]);
+        }
+        fprintf(file, ",%u,%.1f\n", (unsigned)result->WorkerId, result->RunTimeMs);
+    }
+    return (fclose(file) == 0) ? E_OK : E_NOT_OK;
+}
+
+int main(int argc, char* argv[]) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t workers = (cores > 0) ? (uint32_t)cores : 1U;
+    const char* csvPath = NULL;
+    int option;
+
+    while ((option = getopt(argc, argv, "j:s:o:h")) != -1) {
+        switch (option) {
+            case 'j': workers = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's': ScenarioRunner_NumSeeds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'o': csvPath = optarg; break;
+            default:
+                printf("Usage: %s [-j workers] [-s seeds] [-o results.csv]\n", argv[0]);
+                return (option == 'h') ? 0 : 2;
+        }
+    }
+    if (workers == 0U || workers > SCENARIO_RUNNER_MAX_WORKERS ||
+        ScenarioRunner_NumSeeds == 0U || ScenarioRunner_NumSeeds > SCENARIO_RUNNER_MAX_SEEDS) {
+        printf("Invalid arguments: 1 <= workers <= %u, 1 <= seeds <= %u.\n",
+               (unsigned)SCENARIO_RUNNER_MAX_WORKERS, (unsigned)SCENARIO_RUNNER_MAX_SEEDS);
+        return 2;
+    }
+
+    ScenarioRunner_NumScenarios = ScenarioRunner_NumDriveCycles * ScenarioRunner_NumParameterSets *
+                                  ScenarioRunner_NumSeeds;
+    ScenarioRunner_NumWorkers = (workers < ScenarioRunner_NumScenarios) ? workers : ScenarioRunner_NumScenarios;
+
+    if (ScenarioRunner_InitEcu() != E_OK) {
+        printf("ECU initialization failed.\n");
+        return 1;
+    }
+
+    // Hàng đợi và kết quả dùng chung giữa các tiến trình; mmap trả về vùng nhớ đã xóa về 0 (NOT_RUN)
+    size_t queueSize = ScenarioRunner_NumWorkers * sizeof(ScenarioRunner_QueueType);
+    size_t resultSize = ScenarioRunner_NumScenarios * sizeof(ScenarioRunner_ResultType);
+    void* shared = mmap(NULL, queueSize + resultSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        printf("Cannot map shared memory.\n");
+        return 1;
+    }
+    ScenarioRunner_Queue = (ScenarioRunner_QueueType*)shared;
+    ScenarioRunner_Result = (ScenarioRunner_ResultType*)((uint8_t*)shared + queueSize);
+
+    // Chia đều các dãy chỉ số liên tiếp; work-stealing cân bằng phần chênh lệch thời gian chạy
+    for (uint32_t w = 0; w < ScenarioRunner_NumWorkers; w++) {
+        uint32_t head = (uint32_t)((uint64_t)ScenarioRunner_NumScenarios * w / ScenarioRunner_NumWorkers);
+        uint32_t tail = (uint32_t)((uint64_t)ScenarioRunner_NumScenarios * (w + 1U) / ScenarioRunner_NumWorkers);
+        atomic_init(&ScenarioRunner_Queue[w].Range, SCENARIO_RUNNER_RANGE(head, tail));
+    }
+
+    printf("Running %u scenarios (%u drive cycles x %u parameter sets x %u seeds) on %u workers...\n",
+           (unsigned)ScenarioRunner_NumScenarios, (unsigned)ScenarioRunner_NumDriveCycles,
+           (unsigned)ScenarioRunner_NumParameterSets, (unsigned)ScenarioRunner_NumSeeds,
+           (unsigned)ScenarioRunner_NumWorkers);
+    fflush(stdout);   // Không in lặp lại phần đệm trong các tiến trình con
+
+    uint64_t startNs = Os_GetTimeNs();
+    for (uint32_t w = 0; w < ScenarioRunner_NumWorkers; w++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            ScenarioRunner_Worker(w);
+            fflush(stdout);
+            _exit(0);
+        }
+        if (pid < 0) {
+            // Các worker đã tạo lấy hết kịch bản của hàng đợi này
+            printf("Cannot start worker %u.\n", (unsigned)w);
+        }
+    }
+    while (wait(NULL) > 0 || errno == EINTR) {
+    }
+    float wallS = (float)(Os_GetTimeNs() - startNs) / 1.0e9f;
+
+    uint32_t failed = ScenarioRunner_Report();
+
+    // Tải của các worker (số kịch bản đã chạy) và tốc độ so với thời gian thực
+    uint32_t runsMin = UINT32_MAX, runsMax = 0U;
+    double simulatedS = 0.0;
+    for (uint32_t w = 0; w < ScenarioRunner_NumWorkers; w++) {
+        uint32_t runs = 0U;
+        for (uint32_t i = 0; i < ScenarioRunner_NumScenarios; i++) {
+            runs += (ScenarioRunner_Result[i].WorkerId == w && ScenarioRunner_Result[i].RunTimeMs > 0.0f) ? 1U : 0U;
+        }
+        runsMin = (runs < runsMin) ? runs : runsMin;
+        runsMax = (runs > runsMax) ? runs : runsMax;
+    }
+    for (uint32_t i = 0; i < ScenarioRunner_NumScenarios; i++) {
+        simulatedS += ScenarioRunner_Result[i].SimulatedS;
+    }
+    printf("\nSimulated %.0f s in %.2f s wall time (%.0fx real time), %u-%u scenarios per worker, %u failed.\n",
+           simulatedS, wallS, (wallS > 0.0f) ? simulatedS / wallS : 0.0,
+           (unsigned)runsMin, (unsigned)runsMax, (unsigned)failed);
+
+    if (csvPath != NULL) {
+        if (ScenarioRunner_WriteCsv(csvPath) != E_OK) {
+            printf("Cannot write %s.\n", csvPath);
+            failed++;
+        } else {
+            printf("Results written to %s.\n", csvPath);
+        }
+    }
+
+    (void)munmap(shared, queueSize + resultSize);
+    return (failed == 0U) ? 0 : 1;
+}
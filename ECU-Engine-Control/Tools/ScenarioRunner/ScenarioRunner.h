@@ -0,0 +1,93 @@
+/******************************************************************************
+ * @file    ScenarioRunner.h
+ * @brief   Header file cho bộ chạy kịch bản song song của Torque Control
+ *
+ * @details Một kịch bản là một tổ hợp (chu trình lái, bộ tham số hiệu chuẩn, giá trị
+ *          khởi đầu của nhiễu cảm biến). Mỗi kịch bản chạy trong một ngữ cảnh ECU
+ *          riêng (SWC, RTE, MCAL mô phỏng, mô hình xe, DEM) theo đồng hồ ảo, nhanh
+ *          hơn thời gian thực, và trả về các chỉ số: sai lệch bám mô-men, tốc độ tối
+ *          đa và các DTC đã ghi.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#ifndef SCENARIO_RUNNER_H
+#define SCENARIO_RUNNER_H
+
+#include "Std_Types.h"
+#include "Intp.h"
+#include "Dem.h"
+
+/******************************************************************************
+ * @brief   Các giới hạn của bộ chạy kịch bản
+ ******************************************************************************/
+#define SCENARIO_RUNNER_MAX_WORKERS   256U                    /**< Số tiến trình worker tối đa */
+#define SCENARIO_RUNNER_MAX_SEEDS     10000U                  /**< Số giá trị khởi đầu của nhiễu tối đa */
+#define SCENARIO_RUNNER_MAX_DTCS      MAX_DIAGNOSTIC_EVENTS   /**< Số DTC lưu cho mỗi kịch bản */
+#define SCENARIO_RUNNER_TIMEOUT_S     60U                     /**< Thời gian chạy tối đa của một kịch bản (s) */
+
+/******************************************************************************
+ * @brief   Chu trình lái
+ *
+ * @details Vị trí bàn đạp ga theo thời gian; kịch bản kết thúc tại điểm chia cuối
+ *          của trục thời gian.
+ ******************************************************************************/
+typedef struct {
+    const char* Name;                   /**< Tên chu trình */
+    Intp_CurveF32Type* Throttle;        /**< Bàn đạp ga (0..1) theo thời gian (s) */
+    float Payload;                      /**< Tải trọng (kg) */
+} ScenarioRunner_DriveCycleType;
+
+/******************************************************************************
+ * @brief   Bộ tham số hiệu chuẩn cần đánh giá
+ *
+ * @details Thay các hệ số vòng kín của bộ hiệu chuẩn mặc định (ROM của NvM); các
+ *          trường khác giữ giá trị mặc định.
+ ******************************************************************************/
+typedef struct {
+    const char* Name;                   /**< Tên bộ tham số */
+    float TorqueKp;                     /**< Hệ số tỉ lệ của vòng kín mô-men */
+    float TorqueKi;                     /**< Hệ số tích phân (1/s) */
+    float TorqueRateLimit;              /**< Giới hạn tốc độ thay đổi lệnh mô-men (Nm/s) */
+} ScenarioRunner_ParameterSetType;
+
+/******************************************************************************
+ * @brief   Trạng thái chạy của một kịch bản
+ ******************************************************************************/
+typedef enum {
+    SCENARIO_RUNNER_NOT_RUN = 0,        /**< Chưa chạy hoặc tiến trình kịch bản dừng bất thường */
+    SCENARIO_RUNNER_OK,                 /**< Chạy hết chu trình lái */
+    SCENARIO_RUNNER_INIT_FAILED         /**< Cấu hình của kịch bản không hợp lệ */
+} ScenarioRunner_StatusType;
+
+/******************************************************************************
+ * @brief   Kết quả của một kịch bản
+ *
+ * @details Được tiến trình kịch bản ghi vào vùng nhớ dùng chung; tiến trình cha tổng
+ *          hợp sau khi mọi worker kết thúc.
+ ******************************************************************************/
+typedef struct {
+    uint8_t Status;                     /**< ScenarioRunner_StatusType */
+    uint8_t DtcCount;                   /**< Số DTC đã báo lỗi trong kịch bản (testFailedSinceLastClear) */
+    uint16_t WorkerId;                  /**< Worker đã chạy kịch bản */
+    uint32_t Dtc[SCENARIO_RUNNER_MAX_DTCS];  /**< Mã các DTC đã báo lỗi */
+    float TrackingRms;                  /**< Căn quân phương của sai lệch mô-men yêu cầu - thực tế (Nm) */
+    float TrackingMax;                  /**< Sai lệch lớn nhất (Nm) */
+    float MaxSpeed;                     /**< Tốc độ xe lớn nhất (km/h) */
+    float SimulatedS;                   /**< Thời gian mô phỏng (s) */
+    float RunTimeMs;                    /**< Thời gian chạy thực tế, gồm cả tạo tiến trình (ms) */
+} ScenarioRunner_ResultType;
+
+/******************************************************************************
+ * @brief   Bảng kịch bản (ScenarioRunner_Cfg.c)
+ ******************************************************************************/
+extern const ScenarioRunner_DriveCycleType ScenarioRunner_DriveCycles[];
+extern const uint32_t ScenarioRunner_NumDriveCycles;
+extern const ScenarioRunner_ParameterSetType ScenarioRunner_ParameterSets[];
+extern const uint32_t ScenarioRunner_NumParameterSets;
+
+#endif /* SCENARIO_RUNNER_H */
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * @file    ScenarioRunner_Cfg.c
+ * @brief   Bảng kịch bản của bộ chạy kịch bản Torque Control
+ *
+ * @details Các chu trình lái và các bộ tham số hiệu chuẩn cần đánh giá. Mỗi tổ hợp
+ *          được chạy với mọi giá trị khởi đầu của nhiễu cảm biến (tham số `-s`).
+ *          Bộ tham số đầu tiên là bộ hiệu chuẩn mặc định, dùng làm mốc so sánh.
+ *
+ * @version 1.0
+ * @date    2024-10-25
+ * @author
+ *          HALA Academy
+ *          Tong Xuan Hoang
+ ******************************************************************************/
+
+#include "ScenarioRunner.h"
+
+/******************************************************************************
+ * @brief   Chu trình đô thị: tăng tốc, thả trôi và dừng nhiều lần
+ ******************************************************************************/
+#define SCENARIO_URBAN_POINTS 12U
+
+static const float Scenario_UrbanTime[SCENARIO_URBAN_POINTS] = {
+    0.0f, 2.0f, 8.0f, 10.0f, 14.0f, 16.0f, 22.0f, 24.0f, 30.0f, 32.0f, 40.0f, 45.0f
+};
+static const float Scenario_UrbanThrottle[SCENARIO_URBAN_POINTS] = {
+    0.0f, 0.4f, 0.4f, 0.0f, 0.0f, 0.5f, 0.5f, 0.1f, 0.1f, 0.35f, 0.35f, 0.0f
+};
+static float Scenario_UrbanInvDelta[SCENARIO_URBAN_POINTS - 1U];
+static Intp_CurveF32Type Scenario_UrbanCurve = {
+    .Axis = { Scenario_UrbanTime, Scenario_UrbanInvDelta, SCENARIO_URBAN_POINTS },
+    .Values = Scenario_UrbanThrottle
+};
+
+/******************************************************************************
+ * @brief   Chu trình cao tốc: tăng tốc lên tốc độ cao, giữ ga rồi giảm ga
+ ******************************************************************************/
+#define SCENARIO_HIGHWAY_POINTS 5U
+
+static const float Scenario_HighwayTime[SCENARIO_HIGHWAY_POINTS] = { 0.0f, 5.0f, 60.0f, 70.0f, 90.0f };
+static const float Scenario_HighwayThrottle[SCENARIO_HIGHWAY_POINTS] = { 0.0f, 0.7f, 0.7f, 0.4f, 0.0f };
+static float Scenario_HighwayInvDelta[SCENARIO_HIGHWAY_POINTS - 1U];
+static Intp_CurveF32Type Scenario_HighwayCurve = {
+    .Axis = { Scenario_HighwayTime, Scenario_HighwayInvDelta, SCENARIO_HIGHWAY_POINTS },
+    .Values = Scenario_HighwayThrottle
+};
+
+/******************************************************************************
+ * @brief   Đạp và nhả ga đột ngột: kiểm tra đáp ứng của vòng kín
+ ******************************************************************************/
+#define SCENARIO_TIP_IN_POINTS 14U
+
+static const float Scenario_TipInTime[SCENARIO_TIP_IN_POINTS] = {
+    0.0f, 2.0f, 2.1f, 5.0f, 5.1f, 8.0f, 8.1f, 11.0f, 11.1f, 14.0f, 14.1f, 17.0f, 17.1f, 20.0f
+};
+static const float Scenario_TipInThrottle[SCENARIO_TIP_IN_POINTS] = {
+    0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.2f, 0.2f, 0.9f, 0.9f, 0.0f, 0.0f
+};
+static float Scenario_TipInInvDelta[SCENARIO_TIP_IN_POINTS - 1U];
+static Intp_CurveF32Type Scenario_TipInCurve = {
+    .Axis = { Scenario_TipInTime, Scenario_TipInInvDelta, SCENARIO_TIP_IN_POINTS },
+    .Values = Scenario_TipInThrottle
+};
+
+/******************************************************************************
+ * @brief   Đầy tải: tăng tốc và giữ ga với tải trọng gần tối đa (có bù tải)
+ ******************************************************************************/
+#define SCENARIO_FULL_LOAD_POINTS 4U
+
+static const float Scenario_FullLoadTime[SCENARIO_FULL_LOAD_POINTS] = { 0.0f, 3.0f, 35.0f, 40.0f };
+static const float Scenario_FullLoadThrottle[SCENARIO_FULL_LOAD_POINTS] = { 0.0f, 0.8f, 0.8f, 0.0f };
+static float Scenario_FullLoadInvDelta[SCENARIO_FULL_LOAD_POINTS - 1U];
+static Intp_CurveF32Type Scenario_FullLoadCurve = {
+    .Axis = { Scenario_FullLoadTime, Scenario_FullLoadInvDelta, SCENARIO_FULL_LOAD_POINTS },
+    .Values = Scenario_FullLoadThrottle
+};
+
+/******************************************************************************
+ * @brief   Danh sách chu trình lái
+ ******************************************************************************/
+const ScenarioRunner_DriveCycleType ScenarioRunner_DriveCycles[] = {
+    { "Urban",    &Scenario_UrbanCurve,    150.0f },
+    { "Highway",  &Scenario_HighwayCurve,  300.0f },
+    { "TipIn",    &Scenario_TipInCurve,    150.0f },
+    { "FullLoad", &Scenario_FullLoadCurve, 900.0f }
+};
+const uint32_t ScenarioRunner_NumDriveCycles = sizeof(ScenarioRunner_DriveCycles) / sizeof(ScenarioRunner_DriveCycles[0]);
+
+/******************************************************************************
+ * @brief   Danh sách bộ tham số hiệu chuẩn
+ *
+ * @details Giá trị phải hợp lệ theo `Pid_Configure`; bộ không hợp lệ bị Torque
+ *          Control bỏ qua và kịch bản chạy với hiệu chuẩn mặc định.
+ ******************************************************************************/
+const ScenarioRunner_ParameterSetType ScenarioRunner_ParameterSets[] = {
+    { "Default",  0.5f, 20.0f, 2000.0f },
+    { "HighGain", 1.0f, 40.0f, 2000.0f },
+    { "LowGain",  0.2f,  5.0f, 2000.0f },
+    { "SlowRamp", 0.5f, 20.0f,  200.0f }
+};
+const uint32_t ScenarioRunner_NumParameterSets = sizeof(ScenarioRunner_ParameterSets) / sizeof(ScenarioRunner_ParameterSets[0]);
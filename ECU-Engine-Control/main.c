@@ -1,32 +1,191 @@
 #include "Os.h"
 #include "Torque_Control.h"
+#include "Rte_TorqueControl.h"
+#include "Dem.h"
+#include "Dcm.h"
+#include "Fls.h"
+#include "NvM.h"
+#include "IoHwAb_MotorDriver.h"
+#include "Rte_Trace.h"
+#include "Dlt.h"
+#include "Plant.h"
 #include <stdio.h>
 
-// Task để khởi tạo và cập nhật hệ thống điều khiển mô-men xoắn
-void* Task_TorqueControl(void* arg) {
-    // Gọi hàm khởi tạo Torque Control
-    TorqueControl_Init();
+// Ưu tiên của các task chu kỳ theo rate-monotonic: chu kỳ ngắn hơn có ưu tiên cao hơn.
+// Các task nền (log, NvM, chẩn đoán, trace) chạy với ưu tiên mặc định
+#define TASK_PRIORITY_MOTOR_CONTROL         90  // Chu kỳ PWM
+#define TASK_PRIORITY_PLANT                 85  // PLANT_STEP_MS, môi trường mô phỏng chạy trước ECU
+#define TASK_PRIORITY_TORQUE_CONTROL_1MS    80
+#define TASK_PRIORITY_SENSOR_ACQUISITION    70  // RTE_SENSOR_ACQUISITION_PERIOD_MS
+#define TASK_PRIORITY_TORQUE_CONTROL_10MS   60
+#define TASK_PRIORITY_TORQUE_CONTROL_100MS  40
+
+// Task 1 ms của Torque Control: gửi lệnh mô-men xoắn tới động cơ
+void* Task_TorqueControl1ms(void* arg) {
+    Rte_Task_TorqueControl_1ms();
+
+    return NULL;
+}
+
+// Task 10 ms của Torque Control: mô-men yêu cầu, vòng kín và nạp lại hiệu chuẩn
+void* Task_TorqueControl10ms(void* arg) {
+    Rte_Task_TorqueControl_10ms();
+
+    return NULL;
+}
+
+// Task 100 ms của Torque Control: tải trọng và giám sát
+void* Task_TorqueControl100ms(void* arg) {
+    Rte_Task_TorqueControl_100ms();
+
+    return NULL;
+}
+
+// Task thu thập cảm biến: đọc ADC và ghi vào bộ đệm của RTE, độc lập với Torque Control
+void* Task_SensorAcquisition(void* arg) {
+    while (1) {
+        Rte_Run_AnalogSensors_Acquire();
+        Os_Delay(RTE_SENSOR_ACQUISITION_PERIOD_MS);
+    }
+
+    return NULL;
+}
+
+// Task vòng dòng điện: chạy một chu kỳ FOC mỗi chu kỳ PWM theo mốc thời gian tuyệt đối
+void* Task_MotorControl(void* arg) {
+    uint64_t deadline = Os_GetTimeNs();
+
+    while (1) {
+        IoHwAb_MotorDriver_ControlStep();
+
+        deadline += IOHWAB_MOTOR_PWM_PERIOD_NS;
+        uint64_t now = Os_GetTimeNs();
+        if (now > deadline) {
+            // Trễ quá một chu kỳ: bỏ qua các chu kỳ đã lỡ thay vì chạy dồn
+            deadline = now;
+        }
+        Os_SleepUntilNs(deadline);
+    }
+
+    return NULL;
+}
+
+// Task mô hình xe: tích phân bước cố định theo mốc thời gian tuyệt đối, đọc PWM và cấp tín hiệu cho ADC
+void* Task_Plant(void* arg) {
+    uint64_t deadline = Os_GetTimeNs();
 
-    // Liên tục cập nhật hệ thống điều khiển mô-men xoắn
     while (1) {
-        TorqueControl_Update();
-        
-        // Tạm dừng 1 giây trước khi cập nhật tiếp
-        Os_Delay(1000);
+        Plant_MainFunction();
+
+        deadline += (uint64_t)PLANT_STEP_MS * 1000000U;
+        uint64_t now = Os_GetTimeNs();
+        if (now > deadline) {
+            // Mô hình không theo kịp thời gian thực: bỏ qua các bước đã lỡ
+            deadline = now;
+        }
+        Os_SleepUntilNs(deadline);
     }
 
     return NULL;
 }
 
+// Task nền của NvM: ghi các block đang chờ xuống flash
+void* Task_NvM(void* arg) {
+    while (1) {
+        NvM_MainFunction();
+        Os_Delay(NVM_MAIN_FUNCTION_PERIOD_MS);
+    }
+
+    return NULL;
+}
+
+// Cấu hình bộ nhớ flash mô phỏng (nội dung được lưu trong file giữa các lần chạy)
+static const Fls_ConfigType Fls_Config = {
+    .FilePath = "Fls_Emulation.bin"
+};
+
+// Task log: định dạng và in các bản ghi log của mọi task
+void* Task_Dlt(void* arg) {
+    while (1) {
+        Dlt_MainFunction();
+        Os_Delay(DLT_MAIN_FUNCTION_PERIOD_MS);
+    }
+
+    return NULL;
+}
+
+#if (RTE_VFB_TRACE == STD_ON)
+// Task trace VFB: chuyển các bản ghi trace của RTE xuống file
+void* Task_RteTrace(void* arg) {
+    while (1) {
+        Rte_Trace_MainFunction();
+        Os_Delay(RTE_TRACE_DRAIN_PERIOD_MS);
+    }
+
+    return NULL;
+}
+#endif
+
 int main(void) {
     // Khởi tạo hệ điều hành
     Os_Init();
 
-    // Tạo task chung cho Torque Control (khởi tạo + cập nhật)
-    Os_CreateTask(Task_TorqueControl, "Torque Control");
+    // Khởi tạo dịch vụ log trước mọi module có ghi log
+    Dlt_Init();
+
+    // Khởi tạo bộ nhớ flash mô phỏng dùng cho NvM và việc nạp dữ liệu qua UDS
+    Fls_Init(&Fls_Config);
+
+    // Nạp dữ liệu hiệu chuẩn vào RAM trước khi các SWC khởi tạo
+    NvM_Init();
+    NvM_ReadAll();
+
+    // Khởi tạo dịch vụ chẩn đoán trước khi các task bắt đầu chạy
+    Dem_Init();
+    Dcm_Init();
+
+    // Khởi tạo RTE và Torque Control trước khi các task dùng chung dữ liệu bắt đầu chạy
+    Rte_Start();
+    TorqueControl_Init();
+
+    // Khởi tạo mô hình xe sau PWM (động cơ) để các kênh ADC có tín hiệu ngay từ lần đọc đầu tiên
+    if (Plant_Init(&Plant_Config) != E_OK) {
+        printf("Plant model configuration invalid, ADC channels stay random.\n");
+    }
+
+    // Tạo task log (in các log khởi tạo và log của các task)
+    Os_CreateTask(Task_Dlt, "Dlt", OS_PRIORITY_DEFAULT);
+
+    // Tạo task mô hình xe
+    Os_CreateTask(Task_Plant, "Plant", TASK_PRIORITY_PLANT);
+
+    // Tạo task thu thập cảm biến (producer của dữ liệu cảm biến trong RTE)
+    Os_CreateTask(Task_SensorAcquisition, "Sensor Acquisition", TASK_PRIORITY_SENSOR_ACQUISITION);
+
+    // Tạo các task của Torque Control
+    Os_CreateTask(Task_TorqueControl1ms, "Torque Control 1ms", TASK_PRIORITY_TORQUE_CONTROL_1MS);
+    Os_CreateTask(Task_TorqueControl10ms, "Torque Control 10ms", TASK_PRIORITY_TORQUE_CONTROL_10MS);
+    Os_CreateTask(Task_TorqueControl100ms, "Torque Control 100ms", TASK_PRIORITY_TORQUE_CONTROL_100MS);
+
+    // Tạo task vòng dòng điện của mô-tơ
+    Os_CreateTask(Task_MotorControl, "Motor Control", TASK_PRIORITY_MOTOR_CONTROL);
+
+    // Tạo task nền ghi dữ liệu NvM
+    Os_CreateTask(Task_NvM, "NvM", OS_PRIORITY_DEFAULT);
+
+    // Tạo task chẩn đoán: xử lý hàng đợi yêu cầu UDS độc lập với Torque Control
+    Os_CreateTask(Dcm_Task, "Dcm", OS_PRIORITY_DEFAULT);
+
+#if (RTE_VFB_TRACE == STD_ON)
+    // Tạo task trace VFB
+    Os_CreateTask(Task_RteTrace, "Rte Trace", OS_PRIORITY_DEFAULT);
+#endif
 
     // Chờ các task hoàn thành
     Os_Shutdown();
+    Dlt_MainFunction();
+    NvM_WriteAll();
+    Fls_DeInit();
 
     return 0;
 }